@@ -0,0 +1,41 @@
+# Name:     convert1.pl
+# Date:     10/17/2026
+# Purpose:  Converts a scored CDD file to the binary format and back to text and verifies that the
+#           round trip leaves the CDD file (including the order of its statements) and its reports unchanged.
+
+require "../verilog/regress_subs.pl";
+
+# Initialize the diagnostic environment
+&initialize( "convert1", 0, @ARGV );
+
+# Simulate the design
+if( $SIMULATOR eq "IV" ) {
+  system( "iverilog -DDUMP convert1.v; ./a.out" ) && die;
+} elsif( $SIMULATOR eq "CVER" ) {
+  system( "cver -q +define+DUMP convert1.v" ) && die;
+} elsif( $SIMULATOR eq "VCS" ) {
+  system( "vcs +define+DUMP convert1.v; ./simv" ) && die;
+} elsif( $SIMULATOR eq "VERIWELL" ) {
+  system( "veriwell +define+DUMP convert1.v" ) && die;
+}
+
+# Score the design and keep a copy of the text CDD file
+&runScoreCommand( "-t main -vcd convert1.vcd -o convert1.cdd -v convert1.v -D DUMP" );
+system( "cp convert1.cdd convert1a.cdd" ) && die;
+
+# Convert the CDD file to binary and back to text
+&runCommand( "$COVERED $COVERED_GFLAGS convert -b convert1.cdd $CHECK_MEM_CMD" );
+&runCommand( "$COVERED $COVERED_GFLAGS convert -t convert1.cdd $CHECK_MEM_CMD" );
+
+# The round trip must not change the CDD file
+&runCommand( "./cdd_diff convert1.cdd convert1a.cdd" );
+
+# Generate reports
+&runReportCommand( "-d v -e -m ltcfam -o convert1.rptM convert1.cdd" );
+&runReportCommand( "-d v -e -m ltcfam -i -o convert1.rptI convert1.cdd" );
+
+# Perform the file comparison checks
+&checkTest( "convert1", 2, 0 );
+
+exit 0;
+
@@ -0,0 +1,116 @@
+# Name:     merge13.pl
+# Date:     10/17/2026
+# Purpose:  Verifies that merging with the -j option creates the same CDD file as a sequential merge
+#           when CDD files are specified more than once, with and without exclusion reason conflicts.
+
+require "../verilog/regress_subs.pl";
+
+# Initialize the diagnostic environment
+&initialize( "merge13", 0, @ARGV );
+
+# Simulate the CDD files to merge
+&run( "merge13a" ) && die;
+&run( "merge13b" ) && die;
+
+# Keep a copy of merge13b without any exclusions
+system( "cp merge13b.cdd merge13c.cdd" ) && die;
+
+# Exclude variable "a" from toggle coverage in merge13a
+&runCommand( "echo The output variable a is not being used > merge13a.excl" );
+&runExcludeCommand( "-m T01 merge13a.cdd < merge13a.excl" );
+system( "rm -f merge13a.excl" ) && die;
+
+# Allow the timestamps to be different
+sleep( 1 );
+
+# Exclude variable "a" from toggle coverage (with different message) in merge13b
+&runCommand( "echo I dont like the variable a > merge13b.excl" );
+&runExcludeCommand( "-m T01 merge13b.cdd < merge13b.excl" );
+system( "rm -f merge13b.excl" ) && die;
+
+# Compare parallel merges against the sequential merge for each exclusion reason resolution
+foreach $er ("all", "new", "old") {
+  &compareMerge( $er, "merge13a.cdd merge13b.cdd merge13a.cdd" );
+  &compareMerge( $er, "merge13a.cdd merge13c.cdd merge13a.cdd merge13c.cdd" );
+  &compareMerge( $er, "merge13c.cdd merge13a.cdd merge13a.cdd merge13b.cdd merge13c.cdd" );
+}
+
+# Remove the generated CDD files
+&checkTest( "merge13", 4, 5 );
+
+exit 0;
+
+
+sub compareMerge {
+
+  my( $er )    = $_[0];
+  my( $files ) = $_[1];
+
+  &runMergeCommand( "-er ${er} -o merge13.cdd ${files}" );
+
+  foreach $jobs (2, 3, 4) {
+    &runMergeCommand( "-er ${er} -j ${jobs} -o merge13.1.cdd ${files}" );
+    &runCommand( "./cdd_diff merge13.cdd merge13.1.cdd" );
+    system( "rm -f merge13.1.cdd" ) && die;
+  }
+
+}
+
+sub run {
+
+  my( $bname )  = $_[0];
+  my( $retval ) = 0;
+  my( $fmt )    = "";
+
+  # If we are using the VPI, run the score command and add the needed pieces to the simulation runs
+  if( $USE_VPI == 1 ) {
+    &convertCfg( "vpi", 0, 0, "${bname}.cfg" );
+    &runScoreCommand( "-f ${bname}.cfg" );
+    $vpi_args = "+covered_cdd=${bname}.cdd";
+    if( $COVERED_GFLAGS eq "-D" ) {
+      $vpi_args .= " +covered_debug";
+    } 
+  } 
+    
+  # Simulate the design
+  if( $SIMULATOR eq "IV" ) {
+    if( $USE_VPI == 1 ) {
+      &runCommand( "iverilog -y lib -m ../../lib/vpi/covered.vpi ${bname}.v covered_vpi.v; ./a.out ${vpi_args}" );
+    } else {
+      &runCommand( "iverilog -DDUMP -y lib ${bname}.v; ./a.out" );
+    }
+  } elsif( $SIMULATOR eq "CVER" ) {
+    if( $USE_VPI == 1 ) {
+      &runCommand( "cver -q +libext+.v+ -y lib +loadvpi=../../lib/vpi/covered.cver.so:vpi_compat_bootstrap ${bname}.v covered_vpi.v ${vpi_args}" );
+    } else {
+      &runCommand( "cver -q +define+DUMP +libext+.v+ -y lib ${bname}.v" );
+    }
+  } elsif( $SIMULATOR eq "VCS" ) {
+    if( $USE_VPI == 1 ) {
+      &runCommand( "vcs +v2k -sverilog +libext+.v+ -y lib +vpi -load ../../lib/vpi/covered.vcs.so:covered_register ${bname}.v covered_vpi.v; ./simv ${vpi_args}" );
+    } else {
+      &runCommand( "vcs +define+DUMP +v2k -sverilog +libext+.v+ -y lib ${bname}.v; ./simv" );
+    }
+  } else {
+    die "Illegal SIMULATOR value (${SIMULATOR})\n";
+  }
+
+  # If we are doing VCD/LXT simulation, run the score command post-process
+  if( $USE_VPI == 0 ) {
+
+    # Convert configuration file
+    if( $DUMPTYPE eq "VCD" ) {
+      &convertCfg( "vcd", 0, 0, "${bname}.cfg" );
+    } elsif( $DUMPTYPE eq "LXT" ) {
+      &convertCfg( "lxt", 0, 0, "${bname}.cfg" );
+    }
+
+    # Score CDD file
+    &runScoreCommand( "-f ${bname}.cfg -D DUMP" );
+
+  }
+
+  return $retval;
+
+}
+
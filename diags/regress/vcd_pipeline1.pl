@@ -0,0 +1,40 @@
+# Name:     vcd_pipeline1.pl
+# Date:     10/17/2026
+# Purpose:  Scores the same VCD dumpfile with the single-threaded reader and with the -vcd-pipeline
+#           option and verifies that both CDD files contain the same coverage information.
+
+require "../verilog/regress_subs.pl";
+
+# Initialize the diagnostic environment
+&initialize( "vcd_pipeline1", 0, @ARGV );
+
+# Simulate the design
+if( $SIMULATOR eq "IV" ) {
+  system( "iverilog -DDUMP -y lib vcd_pipeline1.v; ./a.out" ) && die;
+} elsif( $SIMULATOR eq "CVER" ) {
+  system( "cver -q +define+DUMP +libext+.v+ -y lib vcd_pipeline1.v" ) && die;
+} elsif( $SIMULATOR eq "VCS" ) {
+  system( "vcs +define+DUMP +v2k -sverilog +libext+.v+ -y lib vcd_pipeline1.v; ./simv" ) && die;
+} elsif( $SIMULATOR eq "VERIWELL" ) {
+  system( "veriwell +define+DUMP +libext+.v+ -y lib vcd_pipeline1.v" ) && die;
+}
+
+# Score the dumpfile with the single-threaded reader and set the result aside
+&runScoreCommand( "-t main -vcd vcd_pipeline1.vcd -o vcd_pipeline1.cdd -y lib -v vcd_pipeline1.v -F fsm=state,next_state -D DUMP" );
+system( "mv vcd_pipeline1.cdd vcd_pipeline1a.cdd" ) && die;
+
+# Score the same dumpfile with the reader thread
+&runScoreCommand( "-t main -vcd vcd_pipeline1.vcd -o vcd_pipeline1.cdd -y lib -v vcd_pipeline1.v -F fsm=state,next_state -D DUMP -vcd-pipeline" );
+
+# Both runs must produce the same CDD file (-vcd-pipeline is not recorded in the score arguments)
+&runCommand( "./cdd_diff vcd_pipeline1.cdd vcd_pipeline1a.cdd" );
+
+# Generate reports
+&runReportCommand( "-d v -e -m ltcfam -o vcd_pipeline1.rptM vcd_pipeline1.cdd" );
+&runReportCommand( "-d v -e -m ltcfam -i -o vcd_pipeline1.rptI vcd_pipeline1.cdd" );
+
+# Perform the file comparison checks
+&checkTest( "vcd_pipeline1", 2, 0 );
+
+exit 0;
+
@@ -0,0 +1,46 @@
+# Name:     verilator_threads1.pl
+# Date:     10/17/2026
+# Purpose:  Runs the same inlined Verilator model once with a single thread and once Verilated with
+#           --threads 4 (Verilator 4.0 or later) and verifies that folding the per-thread coverage
+#           counter shards into the CDD file produces the same coverage as the single-threaded run.
+
+require "../verilog/regress_subs.pl";
+
+# Initialize the diagnostic environment
+&initialize( "verilator_threads1", 0, @ARGV );
+
+# Create the CDD file and the instrumented Verilog for the model
+system( "rm -rf covered" ) && die;
+&convertCfg( "inline", 0, 1, "verilator_threads1.cfg" );
+&runScoreCommand( "-f verilator_threads1.cfg -D DUMP" );
+system( "cp verilator_threads1.cdd verilator_threads1.base.cdd" ) && die;
+
+# Simulate the model with a single thread and set the resulting CDD file aside
+&runModel( "verilator_threads1.1", "" );
+system( "mv verilator_threads1.cdd verilator_threads1.single.cdd" ) && die;
+system( "cp verilator_threads1.base.cdd verilator_threads1.cdd" ) && die;
+
+# Simulate the same model with its evaluation spread across four threads
+&runModel( "verilator_threads1.4", "--threads 4" );
+
+# The merged shards must match the single-threaded run
+&runCommand( "./cdd_diff verilator_threads1.cdd verilator_threads1.single.cdd" );
+system( "rm -f verilator_threads1.base.cdd verilator_threads1.single.cdd" ) && die;
+system( "mv verilator_threads1.cdd verilator_threads1.verilator.cdd" ) && die;
+
+# Perform the file comparison checks
+&checkTest( "verilator_threads1.verilator", 1, 5 );
+
+exit 0;
+
+
+sub runModel {
+
+  my( $mdir, $threads ) = @_;
+
+  &runCommand( "verilator --cc --Mdir ${mdir} -Wno-WIDTH ${threads} --exe verilator_threads1.cc ${TOPDIR}verilator_threads1.verilator.v" );
+  &runCommand( "cd ${mdir}; ${MAKE} -f Vverilator_threads1.mk USER_CPPFLAGS=\"-I../../../src -DCOVERED_INLINED\" LIBS=\"-L../../../lib/run -lcovered -lpthread\"; ./Vverilator_threads1" );
+  system( "rm -rf ${mdir}" ) && die;
+
+}
+
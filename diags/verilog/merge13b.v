@@ -0,0 +1,29 @@
+/*
+ Name:        merge13b.v
+ Date:        10/17/2026
+ Purpose:     See ../regress/merge13.pl for details.
+*/
+
+module main;
+
+wire a;
+reg  b, c;
+
+dut_and dut(
+  .a(a),
+  .b(b),
+  .c(c)
+);
+
+initial begin
+`ifdef DUMP
+        $dumpfile( "merge13b.vcd" );
+        $dumpvars( 0, main );
+`endif
+	b = 1'b0;
+	c = 1'b1;
+        #10;
+        $finish;
+end
+
+endmodule
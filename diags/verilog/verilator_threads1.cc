@@ -0,0 +1,38 @@
+#include <verilated.h>             // Defines common routines
+#include "Vverilator_threads1.h"   // From Verilating "verilator_threads1.v"
+#ifdef COVERED_INLINED
+#include "Vverilator_threads1_main.h"
+#endif
+
+Vverilator_threads1 *top;          // Instantiation of module
+
+unsigned int main_time = 0;        // Current simulation time
+
+double sc_time_stamp () {          // Called by $time in Verilog
+  return main_time;
+}
+
+int main() {
+
+  top = new Vverilator_threads1;   // Create instance (evaluated by multiple threads if Verilated with --threads)
+
+#ifdef COVERED_INLINED
+  covered_initialize( top, "../verilator_threads1.cdd" );
+#endif
+
+  top->verilatorclock = 0;
+
+  while( !Verilated::gotFinish() ) {
+    top->verilatorclock = (main_time % 2);   // Toggle clock
+    top->eval();                   // Evaluate model
+    main_time++;                   // Time passes...
+  }
+
+  top->final();                    // Done simulating
+
+#ifdef COVERED_INLINED
+  covered_close( "../verilator_threads1.cdd" );
+#endif
+
+}
+
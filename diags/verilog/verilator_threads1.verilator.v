@@ -0,0 +1,57 @@
+module main(
+  input wire verilatorclock
+);
+
+reg [31:0] lfsr0, lfsr1, lfsr2, lfsr3;
+reg [7:0]  cnt0,  cnt1,  cnt2,  cnt3;
+
+initial begin
+	lfsr0 = 32'h00000001;
+	lfsr1 = 32'h0badf00d;
+	lfsr2 = 32'h12345678;
+	lfsr3 = 32'hdeadbeef;
+	cnt0  = 8'h0;
+	cnt1  = 8'h0;
+	cnt2  = 8'h0;
+	cnt3  = 8'h0;
+end
+
+always @(posedge verilatorclock) begin
+  lfsr0 <= {lfsr0[30:0], (lfsr0[31] ^ lfsr0[21] ^ lfsr0[1] ^ lfsr0[0])};
+  if( lfsr0[3:0] == 4'h5 )
+    cnt0 <= cnt0 + 1;
+  else if( lfsr0[7] & lfsr0[9] )
+    cnt0 <= cnt0 - 1;
+end
+
+always @(posedge verilatorclock) begin
+  lfsr1 <= {lfsr1[30:0], (lfsr1[31] ^ lfsr1[21] ^ lfsr1[1] ^ lfsr1[0])};
+  if( lfsr1[5:2] == 4'ha )
+    cnt1 <= cnt1 + 1;
+  else if( lfsr1[8] | lfsr1[11] )
+    cnt1 <= cnt1 - 1;
+end
+
+always @(posedge verilatorclock) begin
+  lfsr2 <= {lfsr2[30:0], (lfsr2[31] ^ lfsr2[21] ^ lfsr2[1] ^ lfsr2[0])};
+  if( lfsr2[1:0] == 2'h3 )
+    cnt2 <= cnt2 + 1;
+  else if( lfsr2[12] & ~lfsr2[14] )
+    cnt2 <= cnt2 - 1;
+end
+
+always @(posedge verilatorclock) begin
+  lfsr3 <= {lfsr3[30:0], (lfsr3[31] ^ lfsr3[21] ^ lfsr3[1] ^ lfsr3[0])};
+  if( lfsr3[6:4] == 3'h2 )
+    cnt3 <= cnt3 + 1;
+  else if( lfsr3[20] ^ lfsr3[25] )
+    cnt3 <= cnt3 - 1;
+end
+
+/* coverage off */
+always @(posedge verilatorclock) begin
+  if( $time >= 20000 ) $finish;
+end
+/* coverage on */
+
+endmodule
@@ -0,0 +1,270 @@
+/*
+ Copyright (c) 2006-2010 Trevor Williams
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ See the GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License along with this program;
+ if not, write to the Free Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+*/
+
+/*!
+ \file     convert.c
+ \date     10/17/2026
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#ifdef HAVE_STRING_H
+#include <string.h>
+#endif
+#include <stdlib.h>
+
+#include "binding.h"
+#include "convert.h"
+#include "db.h"
+#include "defines.h"
+#include "profiler.h"
+#include "util.h"
+
+
+extern db**         db_list;
+extern unsigned int curr_db;
+extern char         user_msg[USER_MSG_LENGTH];
+
+
+/*!
+ Name of the CDD file to convert.
+*/
+static char* convert_cdd = NULL;
+
+/*!
+ Name of the CDD file to write the converted database to (the input CDD file is overwritten if this is NULL).
+*/
+static char* convert_output = NULL;
+
+/*!
+ Set to TRUE if the -b option was specified (write a binary CDD file).
+*/
+static bool convert_to_binary = FALSE;
+
+/*!
+ Set to TRUE if the -t option was specified (write a text CDD file).
+*/
+static bool convert_to_text = FALSE;
+
+/*!
+ Set to TRUE if the -z option was specified (write a compressed CDD file).
+*/
+static bool convert_compress = FALSE;
+
+
+/*!
+ Outputs usage information to standard output for convert command.
+*/
+static void convert_usage() {
+
+  printf( "\n" );
+  printf( "Usage:  covered convert (-h | ([<options>] <database_file>)\n" );
+  printf( "\n" );
+  printf( "   -h                           Displays this help information.\n" );
+  printf( "\n" );
+  printf( "   Options:\n" );
+  printf( "      -b                        Writes the database in the binary CDD format.\n" );
+  printf( "      -t                        Writes the database in the text CDD format.\n" );
+  printf( "                                  If neither -b nor -t is specified, a text CDD file is converted\n" );
+  printf( "                                  to the binary format and a binary CDD file is converted to the\n" );
+  printf( "                                  text format (unless -z is specified, in which case the format\n" );
+  printf( "                                  is kept).\n" );
+  printf( "      -z                        Writes the database as a block-compressed CDD file.  If this option\n" );
+  printf( "                                  is not specified, the database is written uncompressed.\n" );
+  printf( "      -o <filename>             Name of CDD file to write the converted database to.  If this option\n" );
+  printf( "                                  is not specified, the specified database file is overwritten.\n" );
+  printf( "\n" );
+
+}
+
+/*!
+ \return Returns TRUE if the help option was parsed.
+
+ \throws anonymous Throw Throw Throw Throw
+
+ Parses the convert argument list, placing all parsed values into
+ global variables.  If an argument is found that is not valid
+ for the convert operation, an error message is displayed to the
+ user.
+*/
+static bool convert_parse_args(
+  int          argc,      /*!< Number of arguments in argument list argv */
+  int          last_arg,  /*!< Index of last parsed argument from list */
+  const char** argv       /*!< Argument list passed to this program */
+) {
+
+  int  i;
+  bool help_found = FALSE;
+
+  i = last_arg + 1;
+
+  while( (i < argc) && !help_found ) {
+
+    if( strncmp( "-h", argv[i], 2 ) == 0 ) {
+
+      convert_usage();
+      help_found = TRUE;
+
+    } else if( strncmp( "-b", argv[i], 2 ) == 0 ) {
+
+      convert_to_binary = TRUE;
+
+    } else if( strncmp( "-t", argv[i], 2 ) == 0 ) {
+
+      convert_to_text = TRUE;
+
+    } else if( strncmp( "-z", argv[i], 2 ) == 0 ) {
+
+      convert_compress = TRUE;
+
+    } else if( strncmp( "-o", argv[i], 2 ) == 0 ) {
+
+      if( check_option_value( argc, argv, i ) ) {
+        i++;
+        if( convert_output != NULL ) {
+          print_output( "Only one -o option may be present on the command-line.  Using first value...", WARNING, __FILE__, __LINE__ );
+        } else if( is_legal_filename( argv[i] ) ) {
+          convert_output = strdup_safe( argv[i] );
+        } else {
+          unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "Output file \"%s\" is not writable", argv[i] );
+          assert( rv < USER_MSG_LENGTH );
+          print_output( user_msg, FATAL, __FILE__, __LINE__ );
+          Throw 0;
+        }
+      } else {
+        Throw 0;
+      }
+
+    } else if( strncmp( "-", argv[i], 1 ) == 0 ) {
+
+      unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "Unknown convert option (%s) specified.", argv[i] );
+      assert( rv < USER_MSG_LENGTH );
+      print_output( user_msg, FATAL, __FILE__, __LINE__ );
+      Throw 0;
+
+    } else if( (i + 1) == argc ) {
+
+      if( file_exists( argv[i] ) ) {
+        convert_cdd = strdup_safe( argv[i] );
+      } else {
+        unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "Specified CDD file (%s) does not exist", argv[i] );
+        assert( rv < USER_MSG_LENGTH );
+        print_output( user_msg, FATAL, __FILE__, __LINE__ );
+        Throw 0;
+      }
+
+    } else {
+
+      unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "Unknown convert argument (%s) specified.", argv[i] );
+      assert( rv < USER_MSG_LENGTH );
+      print_output( user_msg, FATAL, __FILE__, __LINE__ );
+      Throw 0;
+
+    }
+
+    i++;
+
+  }
+
+  if( !help_found ) {
+
+    /* Check to make sure that the user has specified a CDD file */
+    if( convert_cdd == NULL ) {
+      print_output( "A CDD file must be specified", FATAL, __FILE__, __LINE__ );
+      Throw 0;
+    }
+
+    if( convert_to_binary && convert_to_text ) {
+      print_output( "The -b and -t options cannot both be specified", FATAL, __FILE__, __LINE__ );
+      Throw 0;
+    }
+
+  }
+
+  return( help_found );
+
+}
+
+/*!
+ Performs the convert command.
+*/
+void command_convert(
+  int          argc,      /*!< Number of arguments in command-line to parse */
+  int          last_arg,  /*!< Index of last parsed argument from list */
+  const char** argv       /*!< List of arguments from command-line to parse */
+) { PROFILE(COMMAND_CONVERT);
+
+  unsigned int rv;
+  bool         error = FALSE;
+
+  /* Output header information */
+  rv = snprintf( user_msg, USER_MSG_LENGTH, COVERED_HEADER );
+  assert( rv < USER_MSG_LENGTH );
+  print_output( user_msg, HEADER, __FILE__, __LINE__ );
+
+  Try {
+
+    /* Parse convert command-line */
+    if( !convert_parse_args( argc, last_arg, argv ) ) {
+
+      const char* ofile = (convert_output != NULL) ? convert_output : convert_cdd;
+
+      /* Read in database */
+      rv = snprintf( user_msg, USER_MSG_LENGTH, "Reading CDD file \"%s\"", convert_cdd );
+      assert( rv < USER_MSG_LENGTH );
+      print_output( user_msg, NORMAL, __FILE__, __LINE__ );
+
+      (void)db_read( convert_cdd, READ_MODE_REPORT_NO_MERGE );
+      bind_perform( TRUE, 0 );
+
+      /* Select the format of the written database */
+      if( convert_to_binary || convert_to_text ) {
+        db_list[curr_db]->binary = convert_to_binary;
+      } else if( !convert_compress ) {
+        db_list[curr_db]->binary = !db_list[curr_db]->binary;
+      }
+      db_list[curr_db]->compressed = convert_compress;
+
+      rv = snprintf( user_msg, USER_MSG_LENGTH, "Writing %s%s CDD file \"%s\"", (convert_compress ? "compressed " : ""),
+                     (db_list[curr_db]->binary ? "binary" : "text"), ofile );
+      assert( rv < USER_MSG_LENGTH );
+      print_output( user_msg, NORMAL, __FILE__, __LINE__ );
+
+      db_write( ofile, FALSE, FALSE );
+
+    }
+
+  } Catch_anonymous {
+    error = TRUE;
+  }
+
+  /* Close down the database */
+  db_close();
+
+  /* Deallocate other allocated variables */
+  free_safe( convert_cdd, (strlen( convert_cdd ) + 1) );
+  free_safe( convert_output, (strlen( convert_output ) + 1) );
+
+  if( error ) {
+    Throw 0;
+  }
+
+  PROFILE_END;
+
+}
+
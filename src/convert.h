@@ -0,0 +1,30 @@
+#ifndef __CONVERT_H__
+#define __CONVERT_H__
+
+/*
+ Copyright (c) 2006-2010 Trevor Williams
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ See the GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License along with this program;
+ if not, write to the Free Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+*/
+
+/*!
+ \file     convert.h
+ \date     10/17/2026
+ \brief    Contains functions for convert command.
+*/
+
+
+/*! \brief Parses command-line for convert options and performs convert command. */
+void command_convert( int argc, int last_arg, const char** argv );
+
+#endif
+
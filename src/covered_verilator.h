@@ -18,22 +18,77 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
   int db_verilator_initialize( const char* );
   int db_verilator_close( const char* );
-  int db_add_line_coverage( uint32_t, uint32_t );
+  int db_verilator_shard_create( uint32_t***, unsigned char***, uint64_t*** );
 }
 #endif /* __cplusplus */
 
-inline void covered_line( uint32_t inst_index, uint32_t expr_index ) {
+/*
+ The coverage hooks below only update the counter arrays of the calling thread's shard, so the model may be
+ evaluated by several threads (verilator --threads) without any locking on the hit path.  The shards are
+ allocated the first time a thread hits a coverage point and are folded into the coverage database when
+ covered_close is called.
+*/
 
-  if( !db_add_line_coverage( inst_index, expr_index ) ) {
-    fprintf( stderr, "Covered Error!\n" );
-    exit( 1 );
+struct covered_shard {
+  uint32_t**      line_cnt;
+  unsigned char** comb_hits;
+  uint64_t**      tog;
+};
+
+inline covered_shard& covered_get_shard() {
+
+  static thread_local covered_shard shard = { NULL, NULL, NULL };
+
+  if( shard.line_cnt == NULL ) {
+    if( !db_verilator_shard_create( &shard.line_cnt, &shard.comb_hits, &shard.tog ) ) {
+      fprintf( stderr, "Covered Error!\n" );
+      exit( 1 );
+    }
   }
 
+  return( shard );
+
+}
+
+inline void covered_line( uint32_t inst_index, uint32_t expr_index ) {
+
+  covered_get_shard().line_cnt[inst_index][expr_index]++;
+
+}
+
+inline void covered_unary( uint32_t inst_index, uint32_t expr_index, uint32_t value ) {
+
+  covered_get_shard().comb_hits[inst_index][expr_index] |= (1 << (value != 0));
+
+}
+
+inline void covered_comb( uint32_t inst_index, uint32_t expr_index, uint32_t value ) {
+
+  covered_get_shard().comb_hits[inst_index][expr_index] |= (0x80 | (1 << (value & 0x3)));
+
+}
+
+inline void covered_event( uint32_t inst_index, uint32_t expr_index, uint32_t value ) {
+
+  covered_get_shard().comb_hits[inst_index][expr_index] |= ((value != 0) << 1);
+
+}
+
+inline void covered_toggle( uint32_t inst_index, uint32_t sig_index, uint64_t value ) {
+
+  uint64_t* tog  = &covered_get_shard().tog[inst_index][sig_index * 3];
+  uint64_t  prev = tog[0];
+
+  tog[1] |= (~prev & value);
+  tog[2] |= (prev & ~value);
+  tog[0]  = value;
+
 }
 
 #ifndef COVERED_METRICS_ONLY
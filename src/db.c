@@ -29,6 +29,9 @@
 #endif
 #include <stdlib.h>
 #include <assert.h>
+#if defined(RUNLIB) && defined(HAVE_PTHREAD_H) && defined(HAVE_LIBPTHREAD)
+#include <pthread.h>
+#endif
 
 #include "attr.h"
 #include "binding.h"
@@ -36,6 +39,7 @@
 #include "defines.h"
 #include "enumerate.h"
 #include "expr.h"
+#include "fastlz.h"
 #include "fsm.h"
 #include "func_unit.h"
 #include "gen_item.h"
@@ -208,132 +212,1077 @@ db* db_create() { PROFILE(DB_CREATE);
 
   db* new_db;  /* Pointer to new database structure */
 
-  /* Allocate new database */
-  new_db                       = (db*)malloc_safe( sizeof( db ) );
-  new_db->inst_head            = NULL;
-  new_db->inst_tail            = NULL;
-  new_db->insts                = NULL;
-  new_db->inst_num             = 0;
-  new_db->funit_head           = NULL;
-  new_db->funit_tail           = NULL;
-  new_db->fver_head            = NULL;
-  new_db->fver_tail            = NULL;
-  new_db->leading_hierarchies  = NULL;
-  new_db->leading_hier_num     = 0;
-  new_db->leading_hiers_differ = FALSE;
+  /* Allocate new database */
+  new_db                       = (db*)malloc_safe( sizeof( db ) );
+  new_db->inst_head            = NULL;
+  new_db->inst_tail            = NULL;
+  new_db->insts                = NULL;
+  new_db->inst_num             = 0;
+  new_db->funit_head           = NULL;
+  new_db->funit_tail           = NULL;
+  new_db->fver_head            = NULL;
+  new_db->fver_tail            = NULL;
+  new_db->leading_hierarchies  = NULL;
+  new_db->leading_hier_num     = 0;
+  new_db->leading_hiers_differ = FALSE;
+  new_db->binary               = FALSE;
+  new_db->compressed           = FALSE;
+
+  /* Add this new database to the database array */
+  db_list = (db**)realloc_safe( db_list, (sizeof( db ) * db_size), (sizeof( db ) * (db_size + 1)) );
+  db_list[db_size] = new_db;
+  db_size++;
+
+  PROFILE_END;
+
+  return( new_db );
+
+}
+
+/*!
+ Deallocates all memory associated with the databases.
+*/
+void db_close() { PROFILE(DB_CLOSE);
+  
+  unsigned int i, j;
+
+  for( i=0; i<db_size; i++ ) {
+
+    if( db_list[i]->inst_head != NULL ) {
+
+      /* Remove memory allocated for inst_head */
+      inst_link_delete_list( db_list[i]->inst_head );
+      db_list[i]->inst_head = NULL;
+      db_list[i]->inst_tail = NULL;
+
+      /* Remove memory allocated for all functional units */
+      funit_link_delete_list( &(db_list[i]->funit_head), &(db_list[i]->funit_tail), TRUE );
+
+    }
+
+    /* Deallocate the insts array */
+    if( db_list[i]->insts != NULL ) {
+      free_safe( db_list[i]->insts, (sizeof( funit_inst* ) * db_list[i]->inst_num) );
+      db_list[i]->insts = NULL;
+    }
+
+    /* Deallocate all information regarding hierarchies */
+    for( j=0; j<db_list[i]->leading_hier_num; j++ ) {
+      free_safe( db_list[i]->leading_hierarchies[j], (strlen( db_list[i]->leading_hierarchies[j] ) + 1) );
+    }
+    free_safe( db_list[i]->leading_hierarchies, (sizeof( char* ) * db_list[i]->leading_hier_num) );
+
+    /* Deallocate the file version information */
+    str_link_delete_list( db_list[i]->fver_head );
+    db_list[i]->fver_head = NULL;
+    db_list[i]->fver_tail = NULL;
+
+    /* Deallocate database structure */
+    free_safe( db_list[i], sizeof( db ) );
+
+  }
+
+  /* Clear the global functional unit */
+  global_funit = NULL;
+
+  /* Deallocate preprocessor define tree */
+  tree_dealloc( def_table );
+  def_table = NULL;
+
+  /* Deallocate the binding list */
+  bind_dealloc();
+
+  /* Deallocate database information */
+  info_dealloc();
+
+  /* Free memory associated with current instance scope */
+  assert( curr_inst_scope_size == 0 );
+
+  /* Deallocate the exclusion identifier container, if it exists */
+  free_safe( exclusion_id, db_get_exclusion_id_size() );
+
+  /* Finally, deallocate the database list */
+  free_safe( db_list, (sizeof( db ) * db_size) );
+  db_list = NULL;
+  db_size = 0;
+  curr_db = 0;
+
+  PROFILE_END;
+
+}
+
+#ifndef RUNLIB
+/*!
+ \return Returns TRUE if the top module specified in the -t option is the top-level module
+         of the simulation; otherwise, returns FALSE.
+
+ Iterates through the signal list of the top-level module.  Returns TRUE if no signals with
+ type INPUT, OUTPUT or INOUT were found; otherwise, returns FALSE.  Called by the parse_design()
+ function.
+*/
+bool db_check_for_top_module() { PROFILE(DB_CHECK_FOR_TOP_MODULE);
+
+  bool        retval;
+  funit_inst* top_inst;
+
+  /* Get the top-most instance */
+  instance_get_leading_hierarchy( db_list[curr_db]->inst_tail->inst, NULL, &top_inst );
+
+  /* Check to see if the signal list is void of ports */
+  retval = funit_is_top_module( top_inst->funit );
+
+  PROFILE_END;
+
+  return( retval );
+
+}
+#endif /* RUNLIB */
+
+/*!
+ Renaming cdd_bin_header_s structure for convenience.
+*/
+typedef struct cdd_bin_header_s cdd_bin_header;
+
+/*!
+ Renaming cdd_bin_section_s structure for convenience.
+*/
+typedef struct cdd_bin_section_s cdd_bin_section;
+
+/*!
+ Renaming cdd_cmp_header_s structure for convenience.
+*/
+typedef struct cdd_cmp_header_s cdd_cmp_header;
+
+/*!
+ Renaming cdd_cmp_block_s structure for convenience.
+*/
+typedef struct cdd_cmp_block_s cdd_cmp_block;
+
+/*!
+ Header found at the start of a binary CDD file.  All values in a binary CDD file are stored in the byte order
+ of the machine that wrote it (the byte_order field allows a reader to reject files written with another byte order).
+*/
+struct cdd_bin_header_s {
+  char   magic[8];      /*!< Contains the db_bin_magic string */
+  uint32 version;       /*!< Binary CDD container version (see CDD_BIN_VERSION) */
+  uint32 byte_order;    /*!< Contains the value 0x01020304 */
+  uint64 table_offset;  /*!< File offset of the section table (the record stream ends at this offset) */
+  uint32 section_num;   /*!< Number of entries in the section table */
+  uint32 reserved;      /*!< Unused (written as 0) */
+};
+
+/*!
+ Entry in the section table of a binary CDD file.  A section extends from its offset to the offset of the next
+ section (or to the section table for the last section).
+*/
+struct cdd_bin_section_s {
+  uint64 offset;        /*!< File offset of the first record of this section */
+  uint32 kind;          /*!< Kind of section (see \ref cdd_sections for legal values) */
+  uint32 reserved;      /*!< Unused (written as 0) */
+};
+
+/*!
+ Header found at the start of a compressed CDD file.  It is followed by a sequence of blocks (each made up of a
+ cdd_cmp_block header and its data) that ends with a block header whose raw_len is 0.  The decompressed blocks
+ form a text or binary CDD file.
+*/
+struct cdd_cmp_header_s {
+  char   magic[8];      /*!< Contains the db_cmp_magic string */
+  uint32 version;       /*!< Compressed CDD container version (see CDD_CMP_VERSION) */
+  uint32 byte_order;    /*!< Contains the value 0x01020304 */
+  uint32 block_size;    /*!< Maximum number of uncompressed bytes in a block */
+  uint32 reserved;      /*!< Unused (written as 0) */
+};
+
+/*!
+ Header of a single block of a compressed CDD file.  Each block is compressed with FastLZ independently of all
+ other blocks.  A block whose data did not shrink is stored uncompressed (cmp_len is then equal to raw_len).
+*/
+struct cdd_cmp_block_s {
+  uint32 raw_len;       /*!< Number of bytes in the block after decompression (0 marks the end of the file) */
+  uint32 cmp_len;       /*!< Number of bytes of block data that follow this header */
+};
+
+/*!
+ Magic string found at the start of a binary CDD file.  Its first character is not a digit so a binary CDD file
+ can never be mistaken for a text CDD file.
+*/
+static const char db_bin_magic[8] = { '\211', 'C', 'D', 'D', '\r', '\n', '\032', '\n' };
+
+/*!
+ Set to TRUE while a binary CDD file is being read or written.
+*/
+static bool db_bin_mode = FALSE;
+
+/*!
+ Buffer containing the binary record currently being built (record header included).
+*/
+/*@null@*/ static char* db_bin_rec = NULL;
+
+/*!
+ Number of bytes allocated for the db_bin_rec buffer.
+*/
+static unsigned int db_bin_rec_size = 0;
+
+/*!
+ Number of bytes currently stored in the db_bin_rec buffer.
+*/
+static unsigned int db_bin_rec_len = 0;
+
+/*!
+ File offset of the header of the text block currently being written.
+*/
+static long db_bin_text_offset = 0;
+
+/*!
+ Section table of the binary CDD file currently being written.
+*/
+/*@null@*/ static cdd_bin_section* db_bin_sections = NULL;
+
+/*!
+ Number of entries stored in the db_bin_sections array.
+*/
+static unsigned int db_bin_section_num = 0;
+
+/*!
+ Number of entries allocated for the db_bin_sections array.
+*/
+static unsigned int db_bin_section_size = 0;
+
+/*!
+ Buffer containing the text block currently being read.
+*/
+/*@null@*/ static char* db_bin_text = NULL;
+
+/*!
+ Number of bytes allocated for the db_bin_text buffer.
+*/
+static unsigned int db_bin_text_size = 0;
+
+/*!
+ Pointer to the next unread character of the db_bin_text buffer.
+*/
+/*@null@*/ static char* db_bin_text_ptr = NULL;
+
+/*!
+ Pointer to the end of the text block stored in the db_bin_text buffer.
+*/
+/*@null@*/ static char* db_bin_text_end = NULL;
+
+/*!
+ Pointer to the end of the binary record that is currently being parsed.
+*/
+/*@null@*/ static const char* db_bin_rec_end = NULL;
+
+/*!
+ File offset of the next record to read from the binary CDD file.
+*/
+static uint64 db_bin_pos = 0;
+
+/*!
+ File offset of the end of the record stream of the binary CDD file being read.
+*/
+static uint64 db_bin_end = 0;
+
+/*!
+ Magic string found at the start of a compressed CDD file.
+*/
+static const char db_cmp_magic[8] = { '\211', 'C', 'D', 'Z', '\r', '\n', '\032', '\n' };
+
+/*!
+ Set to TRUE while a compressed CDD file is being read.
+*/
+static bool db_cmp_mode = FALSE;
+
+/*!
+ Buffer containing the data of the compressed block currently being read.
+*/
+/*@null@*/ static char* db_cmp_in = NULL;
+
+/*!
+ Buffer containing the decompressed data of the current block of the compressed CDD file being read.
+*/
+/*@null@*/ static char* db_cmp_out = NULL;
+
+/*!
+ Pointer to the next unread byte of the db_cmp_out buffer.
+*/
+/*@null@*/ static char* db_cmp_ptr = NULL;
+
+/*!
+ Pointer to the end of the valid data of the db_cmp_out buffer.
+*/
+/*@null@*/ static char* db_cmp_end = NULL;
+
+/*!
+ \return Returns TRUE if another block was read and decompressed; otherwise, returns FALSE at the end of the file.
+
+ \throws anonymous Throw Throw
+
+ Reads the next block of the compressed CDD file being read and decompresses it into the db_cmp_out buffer.
+*/
+static bool db_cmp_fill(
+  FILE* file  /*!< Pointer to compressed CDD file being read */
+) {
+
+  cdd_cmp_block blk;
+  bool          retval = FALSE;
+
+  if( fread( &blk, 1, sizeof( blk ), file ) != sizeof( blk ) ) {
+    print_output( "Unexpected end of compressed CDD file", FATAL, __FILE__, __LINE__ );
+    Throw 0;
+  }
+
+  if( blk.raw_len > 0 ) {
+
+    if( (blk.raw_len > CDD_CMP_BLOCK_SIZE) || (blk.cmp_len > blk.raw_len) || (fread( db_cmp_in, 1, blk.cmp_len, file ) != blk.cmp_len) ||
+        ((blk.cmp_len < blk.raw_len) && (fastlz_decompress( db_cmp_in, blk.cmp_len, db_cmp_out, blk.raw_len ) != (int)blk.raw_len)) ) {
+      print_output( "Compressed CDD file is corrupted", FATAL, __FILE__, __LINE__ );
+      Throw 0;
+    }
+
+    /* Blocks that did not shrink are stored uncompressed */
+    if( blk.cmp_len == blk.raw_len ) {
+      memcpy( db_cmp_out, db_cmp_in, blk.raw_len );
+    }
+
+    db_cmp_ptr = db_cmp_out;
+    db_cmp_end = db_cmp_out + blk.raw_len;
+    retval     = TRUE;
+
+  }
+
+  return( retval );
+
+}
+
+/*!
+ \return Returns the number of bytes read.
+
+ \throws anonymous db_cmp_fill
+
+ Reads up to the given number of bytes from the CDD file being read, decompressing it if it is a compressed CDD file.
+*/
+static size_t db_src_read(
+  FILE*  file,  /*!< Pointer to CDD file being read */
+  void*  data,  /*!< Pointer to storage for the read data */
+  size_t size   /*!< Number of bytes to read */
+) {
+
+  size_t num = 0;
+
+  if( !db_cmp_mode ) {
+
+    num = fread( data, 1, size, file );
+
+  } else {
+
+    while( (num < size) && ((db_cmp_ptr < db_cmp_end) || db_cmp_fill( file )) ) {
+      size_t len = ((size_t)(db_cmp_end - db_cmp_ptr) < (size - num)) ? (size_t)(db_cmp_end - db_cmp_ptr) : (size - num);
+      memcpy( ((char*)data + num), db_cmp_ptr, len );
+      db_cmp_ptr += len;
+      num        += len;
+    }
+
+  }
+
+  return( num );
+
+}
+
+/*!
+ Moves the read position of the CDD file being read back to its start (after the compressed CDD file header).
+ This is only called after the first few bytes of the file have been examined.
+*/
+static void db_src_rewind(
+  FILE* file  /*!< Pointer to CDD file being read */
+) {
+
+  if( !db_cmp_mode ) {
+    rewind( file );
+  } else {
+    /* The file header is always read from the first block (which is still in the buffer) */
+    db_cmp_ptr = db_cmp_out;
+  }
+
+}
+
+/*!
+ \return Returns FALSE if the end of the file is encountered; otherwise, returns TRUE.
+
+ \throws anonymous db_cmp_fill
+
+ Reads the next line of the CDD file being read (see util_readline), decompressing it if it is a compressed CDD file.
+*/
+static bool db_src_readline(
+            FILE*         file,      /*!< Pointer to CDD file being read */
+  /*@out@*/ char**        line,      /*!< Pointer to string which will contain read line minus newline character */
+  /*@out@*/ unsigned int* line_size  /*!< Pointer to number of characters allocated for line */
+) {
+
+  bool eol = FALSE;
+
+  if( !db_cmp_mode ) {
+
+    eol = util_readline( file, line, line_size );
+
+  } else {
+
+    unsigned int i = 0;
+
+    if( *line == NULL ) {
+      *line_size = 128;
+      *line      = (char*)malloc_safe( *line_size );
+    }
+
+    while( !eol && ((db_cmp_ptr < db_cmp_end) || db_cmp_fill( file )) ) {
+
+      char*        nl  = (char*)memchr( db_cmp_ptr, '\n', (db_cmp_end - db_cmp_ptr) );
+      unsigned int len = (nl == NULL) ? (db_cmp_end - db_cmp_ptr) : (nl - db_cmp_ptr);
+
+      if( (i + len) >= *line_size ) {
+        unsigned int size = *line_size;
+        while( (i + len) >= size ) size *= 2;
+        *line      = (char*)realloc_safe( *line, *line_size, size );
+        *line_size = size;
+      }
+
+      memcpy( (*line + i), db_cmp_ptr, len );
+      i          += len;
+      db_cmp_ptr += len;
+
+      if( nl != NULL ) {
+        db_cmp_ptr++;
+        eol = TRUE;
+      }
+
+    }
+
+    /* A partial line at the end of the file is dropped (as util_readline does) */
+    if( eol ) {
+      (*line)[i] = '\0';
+    } else {
+      free_safe( *line, *line_size );
+      *line = NULL;
+    }
+
+  }
+
+  return( eol );
+
+}
+
+/*!
+ \return Returns TRUE if the given file is a compressed CDD file; otherwise, returns FALSE.
+
+ \throws anonymous Throw Throw
+
+ Checks the start of the given CDD file for the compressed CDD header.  If it is found, the header is validated and the
+ file is set up to be decompressed as it is read; otherwise, the file is rewound so that it is read as is.
+*/
+static bool db_cmp_read_header(
+  FILE* file  /*!< Pointer to CDD file being read */
+) {
+
+  cdd_cmp_header hdr;
+  bool           retval = FALSE;
+
+  if( (fread( hdr.magic, 1, sizeof( hdr.magic ), file ) == sizeof( hdr.magic )) &&
+      (memcmp( hdr.magic, db_cmp_magic, sizeof( hdr.magic ) ) == 0) ) {
+
+    if( fread( &(hdr.version), 1, (sizeof( hdr ) - sizeof( hdr.magic )), file ) != (sizeof( hdr ) - sizeof( hdr.magic )) ) {
+      print_output( "Unexpected end of compressed CDD file", FATAL, __FILE__, __LINE__ );
+      Throw 0;
+    }
+
+    if( (hdr.byte_order != 0x01020304) || (hdr.version != CDD_CMP_VERSION) || (hdr.block_size > CDD_CMP_BLOCK_SIZE) ) {
+      print_output( "CDD file being read is incompatible with this version of Covered", FATAL, __FILE__, __LINE__ );
+      Throw 0;
+    }
+
+    db_cmp_in   = (char*)malloc_safe( CDD_CMP_BLOCK_SIZE );
+    db_cmp_out  = (char*)malloc_safe( CDD_CMP_BLOCK_SIZE );
+    db_cmp_ptr  = db_cmp_out;
+    db_cmp_end  = db_cmp_out;
+    db_cmp_mode = TRUE;
+    retval      = TRUE;
+
+  } else {
+
+    rewind( file );
+
+  }
+
+  return( retval );
+
+}
+
+/*!
+ \throws anonymous Throw Throw
+
+ Compresses the contents of the given uncompressed CDD file into the given compressed CDD file.
+*/
+static void db_cmp_write(
+  FILE* in,  /*!< Pointer to uncompressed CDD file to compress (it is read from its start) */
+  FILE* out  /*!< Pointer to compressed CDD file to write */
+) {
+
+  cdd_cmp_header hdr;
+  cdd_cmp_block  blk;
+  char*          raw = (char*)malloc_safe( CDD_CMP_BLOCK_SIZE );
+  char*          cmp = (char*)malloc_safe( CDD_CMP_BLOCK_SIZE + (CDD_CMP_BLOCK_SIZE / 16) + 66 );  /* FastLZ may expand a block */
+  bool           ok;
+
+  memcpy( hdr.magic, db_cmp_magic, sizeof( hdr.magic ) );
+  hdr.version    = CDD_CMP_VERSION;
+  hdr.byte_order = 0x01020304;
+  hdr.block_size = CDD_CMP_BLOCK_SIZE;
+  hdr.reserved   = 0;
+
+  rewind( in );
+
+  ok = (fwrite( &hdr, 1, sizeof( hdr ), out ) == sizeof( hdr ));
+
+  do {
+
+    blk.raw_len = fread( raw, 1, CDD_CMP_BLOCK_SIZE, in );
+
+    if( blk.raw_len > 0 ) {
+
+      /* FastLZ cannot compress very small blocks and blocks that do not shrink are stored uncompressed */
+      blk.cmp_len = (blk.raw_len < 16) ? blk.raw_len : fastlz_compress( raw, blk.raw_len, cmp );
+      if( blk.cmp_len >= blk.raw_len ) {
+        blk.cmp_len = blk.raw_len;
+        ok          = ok && (fwrite( &blk, 1, sizeof( blk ), out ) == sizeof( blk )) && (fwrite( raw, 1, blk.raw_len, out ) == blk.raw_len);
+      } else {
+        ok          = ok && (fwrite( &blk, 1, sizeof( blk ), out ) == sizeof( blk )) && (fwrite( cmp, 1, blk.cmp_len, out ) == blk.cmp_len);
+      }
+
+    } else {
+
+      /* Write the end of file marker */
+      blk.cmp_len = 0;
+      ok          = ok && !ferror( in ) && (fwrite( &blk, 1, sizeof( blk ), out ) == sizeof( blk ));
+
+    }
+
+  } while( ok && (blk.raw_len > 0) );
+
+  free_safe( raw, CDD_CMP_BLOCK_SIZE );
+  free_safe( cmp, (CDD_CMP_BLOCK_SIZE + (CDD_CMP_BLOCK_SIZE / 16) + 66) );
+
+  if( !ok ) {
+    print_output( "Unable to write compressed CDD file", FATAL, __FILE__, __LINE__ );
+    Throw 0;
+  }
+
+}
+
+/*!
+ Deallocates the buffers used for reading a compressed CDD file and leaves compressed mode.
+*/
+static void db_cmp_reset() {
+
+  if( db_cmp_mode ) {
+    free_safe( db_cmp_in, CDD_CMP_BLOCK_SIZE );
+    free_safe( db_cmp_out, CDD_CMP_BLOCK_SIZE );
+  }
+
+  db_cmp_in   = NULL;
+  db_cmp_out  = NULL;
+  db_cmp_ptr  = NULL;
+  db_cmp_end  = NULL;
+  db_cmp_mode = FALSE;
+
+}
+
+/*!
+ \throws anonymous Throw
+
+ Writes the given data to the binary CDD file, displaying an error if the write fails.
+*/
+static void db_bin_write(
+  FILE*       file,  /*!< Pointer to binary CDD file being written */
+  const void* data,  /*!< Pointer to data to write */
+  size_t      size   /*!< Number of bytes to write */
+) {
+
+  if( fwrite( data, 1, size, file ) != size ) {
+    print_output( "Unable to write binary CDD file", FATAL, __FILE__, __LINE__ );
+    Throw 0;
+  }
+
+}
+
+/*!
+ \throws anonymous Throw
+
+ Reads the given number of bytes from the binary CDD file, displaying an error if the file ends early.
+*/
+static void db_bin_read(
+  FILE*  file,  /*!< Pointer to binary CDD file being read */
+  void*  data,  /*!< Pointer to storage for the read data */
+  size_t size   /*!< Number of bytes to read */
+) {
+
+  if( db_src_read( file, data, size ) != size ) {
+    print_output( "Unexpected end of binary CDD file", FATAL, __FILE__, __LINE__ );
+    Throw 0;
+  }
+
+}
+
+/*!
+ \throws anonymous db_bin_write
+
+ Writes the binary CDD file header at the current file position.
+*/
+static void db_bin_write_header(
+  FILE*  file,          /*!< Pointer to binary CDD file being written */
+  uint64 table_offset,  /*!< File offset of the section table */
+  uint32 section_num    /*!< Number of entries in the section table */
+) {
+
+  cdd_bin_header hdr;
+
+  memcpy( hdr.magic, db_bin_magic, sizeof( hdr.magic ) );
+  hdr.version      = CDD_BIN_VERSION;
+  hdr.byte_order   = 0x01020304;
+  hdr.table_offset = table_offset;
+  hdr.section_num  = section_num;
+  hdr.reserved     = 0;
+
+  db_bin_write( file, &hdr, sizeof( hdr ) );
+
+}
+
+/*!
+ \return Returns TRUE if the given file is a binary CDD file; otherwise, returns FALSE.
+
+ \throws anonymous Throw Throw db_bin_read
+
+ Checks the start of the given CDD file for the binary CDD header.  If it is found, the header is validated and the
+ record stream is set up for reading by db_read_record; otherwise, the file is rewound so that it is read as a text
+ CDD file.
+*/
+static bool db_bin_read_header(
+  FILE* file  /*!< Pointer to CDD file being read */
+) {
+
+  cdd_bin_header hdr;
+  bool           retval = FALSE;
+
+  if( (db_src_read( file, hdr.magic, sizeof( hdr.magic ) ) == sizeof( hdr.magic )) &&
+      (memcmp( hdr.magic, db_bin_magic, sizeof( hdr.magic ) ) == 0) ) {
+
+    db_bin_read( file, &(hdr.version), (sizeof( hdr ) - sizeof( hdr.magic )) );
+
+    if( hdr.byte_order != 0x01020304 ) {
+      print_output( "Binary CDD file was written by a machine with a different byte order.  Convert it to a text CDD file on that machine first.", FATAL, __FILE__, __LINE__ );
+      Throw 0;
+    }
+
+    if( hdr.version != CDD_BIN_VERSION ) {
+      print_output( "CDD file being read is incompatible with this version of Covered", FATAL, __FILE__, __LINE__ );
+      Throw 0;
+    }
+
+    db_bin_mode     = TRUE;
+    db_bin_pos      = sizeof( hdr );
+    db_bin_end      = hdr.table_offset;
+    db_bin_text_ptr = NULL;
+    db_bin_text_end = NULL;
+    retval          = TRUE;
+
+  } else {
+
+    db_src_rewind( file );
+
+  }
+
+  return( retval );
+
+}
+
+/*!
+ Deallocates the buffers used for reading or writing a binary CDD file and leaves binary mode.
+*/
+static void db_bin_reset() {
+
+  free_safe( db_bin_rec, db_bin_rec_size );
+  free_safe( db_bin_text, db_bin_text_size );
+  free_safe( db_bin_sections, (sizeof( cdd_bin_section ) * db_bin_section_size) );
+
+  db_bin_rec          = NULL;
+  db_bin_rec_size     = 0;
+  db_bin_rec_len      = 0;
+  db_bin_text         = NULL;
+  db_bin_text_size    = 0;
+  db_bin_text_ptr     = NULL;
+  db_bin_text_end     = NULL;
+  db_bin_sections     = NULL;
+  db_bin_section_num  = 0;
+  db_bin_section_size = 0;
+  db_bin_mode         = FALSE;
+
+}
+
+/*!
+ \return Returns TRUE if a binary CDD file is currently being read or written; otherwise, returns FALSE.
+*/
+bool db_bin_is_active() { PROFILE(DB_BIN_IS_ACTIVE);
+
+  PROFILE_END;
+
+  return( db_bin_mode );
+
+}
+
+/*!
+ Adds an entry of the given kind to the section table of the binary CDD file being written.  The section starts
+ at the current file position.  Does nothing if a text CDD file is being written.
+*/
+void db_bin_add_section(
+  FILE*  file,  /*!< Pointer to CDD file being written */
+  uint32 kind   /*!< Kind of section to add (see \ref cdd_sections for legal values) */
+) { PROFILE(DB_BIN_ADD_SECTION);
+
+  if( db_bin_mode ) {
+
+    if( db_bin_section_num == db_bin_section_size ) {
+      unsigned int new_size = (db_bin_section_size == 0) ? 64 : (db_bin_section_size * 2);
+      db_bin_sections     = (cdd_bin_section*)realloc_safe( db_bin_sections, (sizeof( cdd_bin_section ) * db_bin_section_size), (sizeof( cdd_bin_section ) * new_size) );
+      db_bin_section_size = new_size;
+    }
+
+    db_bin_sections[db_bin_section_num].offset   = (uint64)ftell( file );
+    db_bin_sections[db_bin_section_num].kind     = kind;
+    db_bin_sections[db_bin_section_num].reserved = 0;
+    db_bin_section_num++;
+
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ \throws anonymous db_bin_write
+
+ Starts a text block record in the binary CDD file being written.  All text database lines written to the file
+ up to the matching call to db_bin_end_text are stored in this record.  Does nothing if a text CDD file is being
+ written.
+*/
+void db_bin_start_text(
+  FILE* file  /*!< Pointer to CDD file being written */
+) { PROFILE(DB_BIN_START_TEXT);
+
+  if( db_bin_mode ) {
+
+    uint32 hdr[2];
+
+    hdr[0] = DB_TYPE_TEXT_BLOCK;
+    hdr[1] = 0;
+
+    db_bin_text_offset = ftell( file );
+    db_bin_write( file, hdr, sizeof( hdr ) );
+
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ \throws anonymous db_bin_write
+
+ Finishes the text block record started by db_bin_start_text by storing its length in the record header.  An
+ empty text block is removed from the file.  Does nothing if a text CDD file is being written.
+*/
+void db_bin_end_text(
+  FILE* file  /*!< Pointer to CDD file being written */
+) { PROFILE(DB_BIN_END_TEXT);
+
+  if( db_bin_mode ) {
+
+    long   end = ftell( file );
+    uint32 len = (uint32)(end - db_bin_text_offset - (2 * sizeof( uint32 )));
+
+    if( len == 0 ) {
+      (void)fseek( file, db_bin_text_offset, SEEK_SET );
+    } else {
+      (void)fseek( file, (db_bin_text_offset + sizeof( uint32 )), SEEK_SET );
+      db_bin_write( file, &len, sizeof( uint32 ) );
+      (void)fseek( file, end, SEEK_SET );
+    }
+
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ Appends the given data to the binary record currently being built.
+*/
+void db_bin_put(
+  const void*  data,  /*!< Pointer to data to append */
+  unsigned int size   /*!< Number of bytes to append */
+) { PROFILE(DB_BIN_PUT);
+
+  if( (db_bin_rec_len + size) > db_bin_rec_size ) {
+    unsigned int new_size = (db_bin_rec_size == 0) ? 256 : db_bin_rec_size;
+    while( (db_bin_rec_len + size) > new_size ) {
+      new_size *= 2;
+    }
+    db_bin_rec      = (char*)realloc_safe( db_bin_rec, db_bin_rec_size, new_size );
+    db_bin_rec_size = new_size;
+  }
+
+  memcpy( (db_bin_rec + db_bin_rec_len), data, size );
+  db_bin_rec_len += size;
+
+  PROFILE_END;
+
+}
+
+/*!
+ Appends the given string (or the lack of one if str is NULL) to the binary record currently being built.
+*/
+void db_bin_put_str(
+  const char* str  /*!< Pointer to string to append (may be NULL) */
+) { PROFILE(DB_BIN_PUT_STR);
+
+  uint32 len = (str == NULL) ? 0 : (strlen( str ) + 1);
+
+  db_bin_put( &len, sizeof( uint32 ) );
+
+  if( len > 0 ) {
+    db_bin_put( str, len );
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ Starts building a binary record of the given type.  The record contents are appended with db_bin_put and the
+ record is written to the CDD file with db_bin_end_record.
+*/
+void db_bin_start_record(
+  uint32 type  /*!< Type of record to build (one of the DB_TYPE_* values) */
+) { PROFILE(DB_BIN_START_RECORD);
+
+  uint32 len = 0;
+
+  db_bin_rec_len = 0;
+  db_bin_put( &type, sizeof( uint32 ) );
+  db_bin_put( &len,  sizeof( uint32 ) );
+
+  PROFILE_END;
+
+}
+
+/*!
+ \throws anonymous db_bin_write
+
+ Writes the binary record built since the last call to db_bin_start_record to the given CDD file.
+*/
+void db_bin_end_record(
+  FILE* file  /*!< Pointer to binary CDD file being written */
+) { PROFILE(DB_BIN_END_RECORD);
+
+  uint32 len = db_bin_rec_len - (2 * sizeof( uint32 ));
+
+  memcpy( (db_bin_rec + sizeof( uint32 )), &len, sizeof( uint32 ) );
+  db_bin_write( file, db_bin_rec, db_bin_rec_len );
+
+  PROFILE_END;
+
+}
+
+/*!
+ \throws anonymous Throw
+
+ Copies the given number of bytes from the binary record being parsed into the given storage and advances the
+ record pointer past them.
+*/
+void db_bin_get(
+            char**       line,  /*!< Pointer to current position in binary record */
+  /*@out@*/ void*        data,  /*!< Pointer to storage for the read data */
+            unsigned int size   /*!< Number of bytes to read */
+) { PROFILE(DB_BIN_GET);
+
+  if( (*line > db_bin_rec_end) || ((unsigned int)(db_bin_rec_end - *line) < size) ) {
+    print_output( "Binary CDD record is shorter than expected.  Unable to read.", FATAL, __FILE__, __LINE__ );
+    Throw 0;
+  }
+
+  memcpy( data, *line, size );
+  *line += size;
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns a pointer to the string stored at the current position of the binary record being parsed (or NULL
+         if no string was stored).  The string is owned by the record buffer.
+
+ \throws anonymous Throw db_bin_get
+*/
+char* db_bin_get_str(
+  char** line  /*!< Pointer to current position in binary record */
+) { PROFILE(DB_BIN_GET_STR);
+
+  char*  str = NULL;
+  uint32 len;
+
+  db_bin_get( line, &len, sizeof( uint32 ) );
 
-  /* Add this new database to the database array */
-  db_list = (db**)realloc_safe( db_list, (sizeof( db ) * db_size), (sizeof( db ) * (db_size + 1)) );
-  db_list[db_size] = new_db;
-  db_size++;
+  if( len > 0 ) {
+    if( (*line > db_bin_rec_end) || ((unsigned int)(db_bin_rec_end - *line) < len) || ((*line)[len - 1] != '\0') ) {
+      print_output( "Binary CDD record is shorter than expected.  Unable to read.", FATAL, __FILE__, __LINE__ );
+      Throw 0;
+    }
+    str    = *line;
+    *line += len;
+  }
 
   PROFILE_END;
 
-  return( new_db );
+  return( str );
 
 }
 
 /*!
- Deallocates all memory associated with the databases.
-*/
-void db_close() { PROFILE(DB_CLOSE);
-  
-  unsigned int i, j;
+ \return Returns TRUE if a record was read; otherwise, returns FALSE if the end of the CDD file has been reached
+         (in which case the line buffer is deallocated).
 
-  for( i=0; i<db_size; i++ ) {
+ \throws anonymous Throw db_bin_read
 
-    if( db_list[i]->inst_head != NULL ) {
+ Reads the next record from the given CDD file into the given line buffer.  For a text database line (read from a
+ text CDD file or from a text block of a binary CDD file), rest points just past the line's type value (or is set
+ to NULL if the line does not start with one) and packed is set to FALSE.  For a binary record, rest points to
+ the start of the record data and packed is set to TRUE; the record is then parsed with db_bin_get.
+*/
+bool db_read_record(
+            FILE*         file,       /*!< Pointer to CDD file being read */
+  /*@out@*/ char**        line,       /*!< Pointer to buffer that will contain the read record */
+  /*@out@*/ unsigned int* line_size,  /*!< Pointer to number of bytes allocated for line */
+  /*@out@*/ int*          type,       /*!< Set to the DB_TYPE_* value of the read record */
+  /*@out@*/ char**        rest,       /*!< Set to point to the record contents following the type */
+  /*@out@*/ bool*         packed      /*!< Set to TRUE if the read record is a binary record */
+) { PROFILE(DB_READ_RECORD);
 
-      /* Remove memory allocated for inst_head */
-      inst_link_delete_list( db_list[i]->inst_head );
-      db_list[i]->inst_head = NULL;
-      db_list[i]->inst_tail = NULL;
+  bool retval = TRUE;
 
-      /* Remove memory allocated for all functional units */
-      funit_link_delete_list( &(db_list[i]->funit_head), &(db_list[i]->funit_tail), TRUE );
+  *packed = FALSE;
 
-    }
+  if( !db_bin_mode ) {
 
-    /* Deallocate the insts array */
-    if( db_list[i]->insts != NULL ) {
-      free_safe( db_list[i]->insts, (sizeof( funit_inst* ) * db_list[i]->inst_num) );
-      db_list[i]->insts = NULL;
+    if( (retval = db_src_readline( file, line, line_size )) ) {
+      *rest = *line;
+      if( !util_scan_int( rest, type, 10 ) ) {
+        *rest = NULL;
+      }
     }
 
-    /* Deallocate all information regarding hierarchies */
-    for( j=0; j<db_list[i]->leading_hier_num; j++ ) {
-      free_safe( db_list[i]->leading_hierarchies[j], (strlen( db_list[i]->leading_hierarchies[j] ) + 1) );
-    }
-    free_safe( db_list[i]->leading_hierarchies, (sizeof( char* ) * db_list[i]->leading_hier_num) );
+  } else {
 
-    /* Deallocate the file version information */
-    str_link_delete_list( db_list[i]->fver_head );
-    db_list[i]->fver_head = NULL;
-    db_list[i]->fver_tail = NULL;
+    Try {
 
-    /* Deallocate database structure */
-    free_safe( db_list[i], sizeof( db ) );
+      /* Read the next record from the file if the current text block has been consumed */
+      while( retval && !*packed && (db_bin_text_ptr == db_bin_text_end) ) {
 
-  }
+        uint32 hdr[2];
 
-  /* Clear the global functional unit */
-  global_funit = NULL;
+        if( db_bin_pos >= db_bin_end ) {
 
-  /* Deallocate preprocessor define tree */
-  tree_dealloc( def_table );
-  def_table = NULL;
+          retval = FALSE;
 
-  /* Deallocate the binding list */
-  bind_dealloc();
+        } else {
 
-  /* Deallocate database information */
-  info_dealloc();
+          db_bin_read( file, hdr, sizeof( hdr ) );
+          db_bin_pos += sizeof( hdr ) + hdr[1];
 
-  /* Free memory associated with current instance scope */
-  assert( curr_inst_scope_size == 0 );
+          if( hdr[0] == DB_TYPE_TEXT_BLOCK ) {
 
-  /* Deallocate the exclusion identifier container, if it exists */
-  free_safe( exclusion_id, db_get_exclusion_id_size() );
+            if( hdr[1] > db_bin_text_size ) {
+              db_bin_text      = (char*)realloc_safe( db_bin_text, db_bin_text_size, hdr[1] );
+              db_bin_text_size = hdr[1];
+            }
+            db_bin_read( file, db_bin_text, hdr[1] );
+            db_bin_text_ptr = db_bin_text;
+            db_bin_text_end = db_bin_text + hdr[1];
 
-  /* Finally, deallocate the database list */
-  free_safe( db_list, (sizeof( db ) * db_size) );
-  db_list = NULL;
-  db_size = 0;
-  curr_db = 0;
+          } else {
 
-  PROFILE_END;
+            if( *line == NULL ) {
+              *line_size = (hdr[1] > 128) ? hdr[1] : 128;
+              *line      = (char*)malloc_safe( *line_size );
+            } else if( hdr[1] > *line_size ) {
+              *line      = (char*)realloc_safe( *line, *line_size, hdr[1] );
+              *line_size = hdr[1];
+            }
+            db_bin_read( file, *line, hdr[1] );
+            db_bin_rec_end = *line + hdr[1];
+            *type          = (int)hdr[0];
+            *rest          = *line;
+            *packed        = TRUE;
 
-}
+          }
 
-#ifndef RUNLIB
-/*!
- \return Returns TRUE if the top module specified in the -t option is the top-level module
-         of the simulation; otherwise, returns FALSE.
+        }
 
- Iterates through the signal list of the top-level module.  Returns TRUE if no signals with
- type INPUT, OUTPUT or INOUT were found; otherwise, returns FALSE.  Called by the parse_design()
- function.
-*/
-bool db_check_for_top_module() { PROFILE(DB_CHECK_FOR_TOP_MODULE);
+      }
 
-  bool        retval;
-  funit_inst* top_inst;
+      /* Otherwise, copy the next line of the current text block */
+      if( retval && !*packed ) {
 
-  /* Get the top-most instance */
-  instance_get_leading_hierarchy( db_list[curr_db]->inst_tail->inst, NULL, &top_inst );
+        char*        nl  = (char*)memchr( db_bin_text_ptr, '\n', (db_bin_text_end - db_bin_text_ptr) );
+        unsigned int len = (nl == NULL) ? (db_bin_text_end - db_bin_text_ptr) : (nl - db_bin_text_ptr);
 
-  /* Check to see if the signal list is void of ports */
-  retval = funit_is_top_module( top_inst->funit );
+        if( *line == NULL ) {
+          *line_size = (len >= 128) ? (len + 1) : 128;
+          *line      = (char*)malloc_safe( *line_size );
+        } else if( len >= *line_size ) {
+          *line      = (char*)realloc_safe( *line, *line_size, (len + 1) );
+          *line_size = len + 1;
+        }
+        memcpy( *line, db_bin_text_ptr, len );
+        (*line)[len] = '\0';
+        db_bin_text_ptr += (nl == NULL) ? len : (len + 1);
+
+        *rest = *line;
+        if( !util_scan_int( rest, type, 10 ) ) {
+          *rest = NULL;
+        }
+
+      }
+
+    } Catch_anonymous {
+      free_safe( *line, *line_size );
+      *line = NULL;
+      Throw 0;
+    }
+
+    /* The line buffer is deallocated when the end of the file is reached (as util_readline does) */
+    if( !retval && (*line != NULL) ) {
+      free_safe( *line, *line_size );
+      *line = NULL;
+    }
+
+  }
 
   PROFILE_END;
 
   return( retval );
 
 }
-#endif /* RUNLIB */
 
 /*!
- \throws anonymous Throw Throw instance_db_write
+ \throws anonymous Throw Throw instance_db_write db_cmp_write
 
  Opens specified database for writing.  If database open successful,
  iterates through functional unit, expression and signal lists, displaying each
@@ -347,20 +1296,54 @@ void db_write(
 ) { PROFILE(DB_WRITE);
 
   FILE*      db_handle;  /* Pointer to database file being written */
+  FILE*      cmp_handle; /* Pointer to compressed CDD file being written */
   inst_link* instl;      /* Pointer to current instance link */
+  bool       binary;     /* Set to TRUE if a binary CDD file is written */
+  bool       compress;   /* Set to TRUE if a compressed CDD file is written */
 
-  if( (db_handle = fopen( file, "w" )) != NULL ) {
+  /* Score data is written in the binary format if the database was read from a binary CDD file */
+  binary   = !parse_mode && db_list[curr_db]->binary;
+  compress = db_list[curr_db]->compressed;
+
+  /*
+   The binary format seeks back into the file while it is written, so a compressed CDD file is first written
+   uncompressed to a temporary file and then compressed into the real file.
+  */
+  if( compress ) {
+    if( (cmp_handle = fopen( file, "wb" )) != NULL ) {
+      if( (db_handle = tmpfile()) == NULL ) {
+        unsigned int rv = fclose( cmp_handle );
+        assert( rv == 0 );
+      }
+    } else {
+      db_handle = NULL;
+    }
+  } else {
+    cmp_handle = NULL;
+    db_handle  = fopen( file, (binary ? "wb" : "w") );
+  }
+
+  if( db_handle != NULL ) {
 
     unsigned int rv;
 
     Try {
 
+      /* Write a placeholder header (it is completed once the section table has been written) */
+      if( binary ) {
+        db_bin_mode = TRUE;
+        db_bin_write_header( db_handle, 0, 0 );
+      }
+
       /* Reset expression IDs */
       curr_expr_id = 1;
 
       /* Iterate through instance tree */
       assert( db_list[curr_db]->inst_head != NULL );
+      db_bin_add_section( db_handle, CDD_SECTION_INFO );
+      db_bin_start_text( db_handle );
       info_db_write( db_handle );
+      db_bin_end_text( db_handle );
 
       instl = db_list[curr_db]->inst_head;
       while( instl != NULL ) {
@@ -389,15 +1372,39 @@ void db_write(
 
       }
 
+      /* Write the section table and complete the header */
+      if( binary ) {
+        uint64 table_offset = (uint64)ftell( db_handle );
+        db_bin_write( db_handle, db_bin_sections, (sizeof( cdd_bin_section ) * db_bin_section_num) );
+        rewind( db_handle );
+        db_bin_write_header( db_handle, table_offset, db_bin_section_num );
+      }
+
+      if( compress ) {
+        db_cmp_write( db_handle, cmp_handle );
+      }
+
     } Catch_anonymous {
+      db_bin_reset();
       rv = fclose( db_handle );
       assert( rv == 0 );
+      if( compress ) {
+        rv = fclose( cmp_handle );
+        assert( rv == 0 );
+      }
       Throw 0;
     }
 
+    db_bin_reset();
+
     rv = fclose( db_handle );
     assert( rv == 0 );
 
+    if( compress ) {
+      rv = fclose( cmp_handle );
+      assert( rv == 0 );
+    }
+
   } else {
 
     unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "Could not open %s for writing", obf_file( file ) );
@@ -432,7 +1439,9 @@ bool db_read(
   char*        curr_line     = NULL;   /* Pointer to current line being read from db */
   unsigned int curr_line_size;         /* Allocated number of bytes for curr_line */
   char*        rest_line;              /* Pointer to rest of the current line */
-  int          chars_read;             /* Number of characters currently read on line */
+  bool         packed;                 /* Set to TRUE if the current record is a binary record */
+  bool         binary;                 /* Set to TRUE if the CDD file is a binary CDD file */
+  bool         compressed;             /* Set to TRUE if the CDD file is a compressed CDD file */
   char         parent_scope[4096];     /* Scope of parent functional unit to the current instance */
   char         back[4096];             /* Current functional unit instance name */
   char         funit_scope[4096];      /* Current scope of functional unit instance */
@@ -469,15 +1478,16 @@ bool db_read(
 
     Try {
 
-      while( !stop_reading && util_readline( db_handle, &curr_line, &curr_line_size ) ) {
+      compressed = db_cmp_read_header( db_handle );
+      binary     = db_bin_read_header( db_handle );
+
+      while( !stop_reading && db_read_record( db_handle, &curr_line, &curr_line_size, &type, &rest_line, &packed ) ) {
 
         one_line_read = TRUE;
 
         Try {
 
-          if( sscanf( curr_line, "%d%n", &type, &chars_read ) == 1 ) {
-
-            rest_line = curr_line + chars_read;
+          if( rest_line != NULL ) {
 
             if( type == DB_TYPE_INFO ) {
           
@@ -486,6 +1496,12 @@ bool db_read(
   
               if( !stop_reading ) {
 
+                /* The format of the first CDD read into the database is used when the database is written */
+                if( db_list[curr_db]->leading_hier_num == 1 ) {
+                  db_list[curr_db]->binary     = binary;
+                  db_list[curr_db]->compressed = compressed;
+                }
+
                 /* If we are in report mode or merge mode and this CDD file has not been scored, bow out now */
                 if( (info_suppl.part.scored == 0) &&
                     ((read_mode == READ_MODE_REPORT_NO_MERGE) ||
@@ -526,21 +1542,33 @@ bool db_read(
               assert( !merge_mode );
 
               /* Parse rest of line for signal info */
-              vsignal_db_read( &rest_line, curr_funit );
+              if( packed ) {
+                vsignal_db_read_bin( &rest_line, curr_funit );
+              } else {
+                vsignal_db_read( &rest_line, curr_funit );
+              }
  
             } else if( type == DB_TYPE_EXPRESSION ) {
 
               assert( !merge_mode );
 
               /* Parse rest of line for expression info */
-              expression_db_read( &rest_line, curr_funit, (read_mode == READ_MODE_NO_MERGE) );
+              if( packed ) {
+                expression_db_read_bin( &rest_line, curr_funit, (read_mode == READ_MODE_NO_MERGE) );
+              } else {
+                expression_db_read( &rest_line, curr_funit, (read_mode == READ_MODE_NO_MERGE) );
+              }
   
             } else if( type == DB_TYPE_STATEMENT ) {
 
               assert( !merge_mode );
 
               /* Parse rest of line for statement info */
-              statement_db_read( &rest_line, curr_funit, read_mode );
+              if( packed ) {
+                statement_db_read_bin( &rest_line, curr_funit, read_mode );
+              } else {
+                statement_db_read( &rest_line, curr_funit, read_mode );
+              }
 
             } else if( type == DB_TYPE_FSM ) {
 
@@ -708,11 +1736,17 @@ bool db_read(
 
     } Catch_anonymous {
 
-      unsigned int rv = fclose( db_handle );
+      unsigned int rv;
+      db_bin_reset();
+      db_cmp_reset();
+      rv = fclose( db_handle );
       assert( rv == 0 );
       Throw 0;
 
     }
+
+    db_bin_reset();
+    db_cmp_reset();
  
     rv = fclose( db_handle );
     assert( rv == 0 );
@@ -3477,6 +4511,59 @@ void db_set_symbol_string(
 
 }
 
+/*!
+ Sets the value of all symbol table entries matching the specified symbol to the specified
+ value string.  Neither the symbol nor the value need to be NULL-terminated, allowing the
+ VCD reader to pass slices of its read buffer without copying them first.
+*/
+void db_set_symbol_slice(
+  const char*  sym,        /*!< Name of symbol to set value to */
+  unsigned int sym_len,    /*!< Number of characters in sym */
+  const char*  value,      /*!< String version of value to set symbol table entry to */
+  unsigned int value_len   /*!< Number of characters in value */
+) { PROFILE(DB_SET_SYMBOL_SLICE);
+
+#ifdef DEBUG_MODE
+  if( debug_mode ) {
+    unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "In db_set_symbol_slice, sym: %.*s, value: %.*s", sym_len, sym, value_len, value );
+    assert( rv < USER_MSG_LENGTH );
+    print_output( user_msg, DEBUG, __FILE__, __LINE__ );
+  }
+#endif
+
+  /* Set value of all matching occurrences in current timestep. */
+  symtable_set_value_slice( sym, sym_len, value, value_len );
+
+  PROFILE_END;
+
+}
+
+/*!
+ Sets the value of the symbol table entry at the specified index to the specified value string.
+ This is used by dumpfile readers that identify signals by integer handles (FST and LXT), where the
+ symbol table index is the handle itself and no VCD symbol needs to be generated.
+*/
+void db_set_symbol_index(
+  unsigned int index,      /*!< Symbol table index of symbol to set value to */
+  const char*  value,      /*!< String version of value to set symbol table entry to */
+  unsigned int value_len   /*!< Number of characters in value */
+) { PROFILE(DB_SET_SYMBOL_INDEX);
+
+#ifdef DEBUG_MODE
+  if( debug_mode ) {
+    unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "In db_set_symbol_index, index: %u, value: %.*s", index, value_len, value );
+    assert( rv < USER_MSG_LENGTH );
+    print_output( user_msg, DEBUG, __FILE__, __LINE__ );
+  }
+#endif
+
+  /* Set value of the matching symbol table entry in current timestep. */
+  symtable_set_value_index( index, value, value_len );
+
+  PROFILE_END;
+
+}
+
 /*!
  \return Returns TRUE if simulation should continue to advance; otherwise, returns FALSE
          to indicate that simulation should stop immediately.
@@ -3609,6 +4696,143 @@ void db_check_dumpfile_scopes() { PROFILE(DB_CHECK_DUMPFILE_SCOPES);
 #endif /* RUNLIB */
 
 #ifdef RUNLIB
+/*!
+ Renaming verilator_shard_s structure for convenience.
+*/
+typedef struct verilator_shard_s verilator_shard;
+
+/*!
+ Structure containing the coverage counter arrays that are updated by the covered_* hooks of one thread of a
+ Verilator model.  Each thread allocates its own shard the first time it hits a coverage point so that the hooks
+ never write memory that another thread writes; the shards are combined when the database is closed.
+*/
+struct verilator_shard_s {
+  uint32**         line_cnt;   /*!< Line coverage counters, indexed by instance ID and expression index */
+  unsigned char**  comb_hits;  /*!< Combinational logic coverage bitmaps, indexed by instance ID and expression index
+                                    (bits 0-3 are set for each value combination seen, bit 7 if the expression has two operands) */
+  uint64**         tog;        /*!< Toggle state, indexed by instance ID and (signal index * 3) (the last value seen followed
+                                    by the bits that toggled from 0 to 1 and the bits that toggled from 1 to 0) */
+  verilator_shard* next;       /*!< Pointer to next shard in list */
+};
+
+/*!
+ List of coverage counter shards allocated by the threads of the Verilator model.
+*/
+static verilator_shard* verilator_shards = NULL;
+
+#if defined(HAVE_PTHREAD_H) && defined(HAVE_LIBPTHREAD)
+/*!
+ Mutex that serializes the allocation of coverage counter shards (the coverage hooks themselves are lock-free).
+*/
+static pthread_mutex_t verilator_shard_mutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+/*!
+ \return Returns TRUE if a new coverage counter shard was allocated for the calling thread; otherwise, returns FALSE.
+
+ Allocates the coverage counter arrays of a new shard for all instances in the current database, adds the shard to
+ the shard list and passes the arrays back to the calling thread.  Called once by each thread of the Verilator
+ model before it updates any coverage counter.
+*/
+bool db_verilator_shard_create(
+  /*@out@*/ uint32***         line_cnt,   /*!< Pointer to thread's line coverage counters */
+  /*@out@*/ unsigned char***  comb_hits,  /*!< Pointer to thread's combinational logic coverage bitmaps */
+  /*@out@*/ uint64***         tog         /*!< Pointer to thread's toggle state */
+) { PROFILE(DB_VERILATOR_SHARD_CREATE);
+
+  bool retval = TRUE;
+
+#if defined(HAVE_PTHREAD_H) && defined(HAVE_LIBPTHREAD)
+  pthread_mutex_lock( &verilator_shard_mutex );
+#endif
+
+  if( db_list != NULL ) {
+
+    unsigned int     inst_num = db_list[curr_db]->inst_num;
+    unsigned int     i;
+    verilator_shard* shard    = (verilator_shard*)malloc_safe( sizeof( verilator_shard ) );
+
+    shard->line_cnt  = (uint32**)calloc_safe( (inst_num + 1), sizeof( uint32* ) );
+    shard->comb_hits = (unsigned char**)calloc_safe( (inst_num + 1), sizeof( unsigned char* ) );
+    shard->tog       = (uint64**)calloc_safe( (inst_num + 1), sizeof( uint64* ) );
+    shard->next      = verilator_shards;
+    verilator_shards = shard;
+
+    for( i=0; i<inst_num; i++ ) {
+      func_unit* funit = (db_list[curr_db]->insts[i] != NULL) ? db_list[curr_db]->insts[i]->funit : NULL;
+      if( funit != NULL ) {
+        shard->line_cnt[i]  = (uint32*)calloc_safe( (funit->exp_size + 1), sizeof( uint32 ) );
+        shard->comb_hits[i] = (unsigned char*)calloc_safe( (funit->exp_size + 1), sizeof( unsigned char ) );
+        shard->tog[i]       = (uint64*)calloc_safe( ((funit->sig_size * 3) + 1), sizeof( uint64 ) );
+      }
+    }
+
+    *line_cnt  = shard->line_cnt;
+    *comb_hits = shard->comb_hits;
+    *tog       = shard->tog;
+
+  } else {
+
+    print_output( "Attempting to gather coverage without calling covered_initialize(...)", FATAL, __FILE__, __LINE__ );
+    retval = FALSE;
+
+  }
+
+#if defined(HAVE_PTHREAD_H) && defined(HAVE_LIBPTHREAD)
+  pthread_mutex_unlock( &verilator_shard_mutex );
+#endif
+
+  PROFILE_END;
+
+  return( retval );
+
+}
+
+/*!
+ Adds the contents of all coverage counter shards to the expressions and signals of the current database and
+ deallocates the shards.  Line counts are summed and the coverage bitmaps are ORed together.  Must be called
+ after all threads of the Verilator model have stopped updating their shards.
+*/
+static void db_verilator_fold_shards() { PROFILE(DB_VERILATOR_FOLD_SHARDS);
+
+  unsigned int inst_num = db_list[curr_db]->inst_num;
+
+  while( verilator_shards != NULL ) {
+
+    verilator_shard* shard = verilator_shards;
+    unsigned int     i, j;
+
+    for( i=0; i<inst_num; i++ ) {
+      func_unit* funit = (db_list[curr_db]->insts[i] != NULL) ? db_list[curr_db]->insts[i]->funit : NULL;
+      if( funit != NULL ) {
+        for( j=0; j<funit->exp_size; j++ ) {
+          funit->exps[j]->exec_num += shard->line_cnt[i][j];
+          if( shard->comb_hits[i][j] != 0 ) {
+            expression_set_comb_coverage( funit->exps[j], shard->comb_hits[i][j] );
+          }
+        }
+        for( j=0; j<funit->sig_size; j++ ) {
+          vector_set_toggles( funit->sigs[j]->value, shard->tog[i][(j * 3) + 1], shard->tog[i][(j * 3) + 2] );
+        }
+        free_safe( shard->line_cnt[i],  (sizeof( uint32 ) * (funit->exp_size + 1)) );
+        free_safe( shard->comb_hits[i], (sizeof( unsigned char ) * (funit->exp_size + 1)) );
+        free_safe( shard->tog[i],       (sizeof( uint64 ) * ((funit->sig_size * 3) + 1)) );
+      }
+    }
+
+    free_safe( shard->line_cnt,  (sizeof( uint32* ) * (inst_num + 1)) );
+    free_safe( shard->comb_hits, (sizeof( unsigned char* ) * (inst_num + 1)) );
+    free_safe( shard->tog,       (sizeof( uint64* ) * (inst_num + 1)) );
+
+    verilator_shards = shard->next;
+    free_safe( shard, sizeof( verilator_shard ) );
+
+  }
+
+  PROFILE_END;
+
+}
+
 /*!
  \return Returns TRUE if the given CDD file was read in without error.
 
@@ -3643,8 +4867,8 @@ bool db_verilator_initialize(
 /*!
  \return Returns TRUE if the given CDD file was written without error.
 
- Writes the database to the given CDD filename and deallocates all memory
- associated with the database.
+ Folds the gathered coverage counts into the database, writes the database to the given CDD
+ filename and deallocates all memory associated with the database.
 */
 bool db_verilator_close(
   const char* cdd_name  /*!< Name of CDD file to write */
@@ -3652,6 +4876,9 @@ bool db_verilator_close(
 
   bool retval = TRUE;
 
+  /* Add the coverage gathered by each thread to the database */
+  db_verilator_fold_shards();
+
   /* Set the scored bit */
   info_set_scored();
 
@@ -3669,30 +4896,5 @@ bool db_verilator_close(
 
   return( retval );
 
-}
-
-/*!
- Gathers line coverage for the specified expression.
-*/
-bool db_add_line_coverage(
-  uint32 inst_index,  /*!< Index of instance to lookup */
-  uint32 expr_index   /*!< Index of expression to set */
-) { PROFILE(DB_ADD_LINE_COVERAGE);
-
-  bool retval = TRUE;
-
-  /* Perform line coverage on the given expression */
-  if( db_list != NULL ) {
-    printf( "In db_add_line_coverage, inst_index: %u, expr_index: %u, %s\n", inst_index, expr_index, expression_string( db_list[curr_db]->insts[inst_index]->funit->exps[expr_index] ) );
-    expression_set_line_coverage( db_list[curr_db]->insts[inst_index]->funit->exps[expr_index] );
-  } else {
-    print_output( "Attempting to gather coverage without calling covered_initialize(...)", FATAL, __FILE__, __LINE__ );
-    retval = FALSE;
-  }
-
-  PROFILE_END;
-
-  return( retval );
-
 }
 #endif /* RUNLIB */
@@ -36,6 +36,68 @@ void db_close();
 /*! \brief Checks to see if the module specified by the -t option is the top-level module of the simulator. */
 bool db_check_for_top_module();
 
+/*! \brief Returns TRUE if a binary CDD file is currently being read or written. */
+bool db_bin_is_active();
+
+/*! \brief Adds an entry to the section table of the binary CDD file being written. */
+void db_bin_add_section(
+  FILE*  file,
+  uint32 kind
+);
+
+/*! \brief Starts a text block record in the binary CDD file being written. */
+void db_bin_start_text(
+  FILE* file
+);
+
+/*! \brief Finishes the current text block record in the binary CDD file being written. */
+void db_bin_end_text(
+  FILE* file
+);
+
+/*! \brief Appends data to the binary record currently being built. */
+void db_bin_put(
+  const void*  data,
+  unsigned int size
+);
+
+/*! \brief Appends a string to the binary record currently being built. */
+void db_bin_put_str(
+  const char* str
+);
+
+/*! \brief Starts building a binary record of the given type. */
+void db_bin_start_record(
+  uint32 type
+);
+
+/*! \brief Writes the binary record currently being built to the CDD file. */
+void db_bin_end_record(
+  FILE* file
+);
+
+/*! \brief Reads data from the binary record currently being parsed. */
+void db_bin_get(
+            char**       line,
+  /*@out@*/ void*        data,
+            unsigned int size
+);
+
+/*! \brief Reads a string from the binary record currently being parsed. */
+char* db_bin_get_str(
+  char** line
+);
+
+/*! \brief Reads the next text line or binary record from a CDD file. */
+bool db_read_record(
+            FILE*         file,
+  /*@out@*/ char**        line,
+  /*@out@*/ unsigned int* line_size,
+  /*@out@*/ int*          type,
+  /*@out@*/ char**        rest,
+  /*@out@*/ bool*         packed
+);
+
 /*! \brief Writes contents of expressions, functional units and vsignals to database file. */
 void db_write(
   const char* file,
@@ -392,6 +454,21 @@ void db_set_symbol_string(
   const char* value
 );
 
+/*! \brief Sets the found symbol value to specified value slice.  Called by VCD reader. */
+void db_set_symbol_slice(
+  const char*  sym,
+  unsigned int sym_len,
+  const char*  value,
+  unsigned int value_len
+);
+
+/*! \brief Sets the value of the symbol table entry at the given index. */
+void db_set_symbol_index(
+  unsigned int index,
+  const char*  value,
+  unsigned int value_len
+);
+
 /*! \brief Performs a timestep for all signal changes during this timestep. */
 bool db_do_timestep(
   uint64 time,
@@ -407,18 +484,17 @@ bool db_verilator_initialize(
   const char* cdd_name
 );
 
+/*! \brief Allocates the coverage counter arrays for the calling thread of a Verilator model. */
+bool db_verilator_shard_create(
+  /*@out@*/ uint32***         line_cnt,
+  /*@out@*/ unsigned char***  comb_hits,
+  /*@out@*/ uint64***         tog
+);
+
 /*! \brief Called after simulation has completed to write the database contents to the CDD. */
 bool db_verilator_close(
   const char* cdd_name
 );
 
-/*!
- Gathers line coverage for the specified expression.
-*/
-bool db_add_line_coverage(
-  uint32 inst_index,
-  uint32 expr_index
-);
-
 #endif
 
@@ -54,6 +54,24 @@
 */
 #define CDD_VERSION        24
 
+/*!
+ Contains the version number of the binary CDD file container (header, record and section table
+ layout) that this version of Covered can write and read.
+*/
+#define CDD_BIN_VERSION    1
+
+/*!
+ Contains the version number of the compressed CDD file container (header and block layout) that this
+ version of Covered can write and read.
+*/
+#define CDD_CMP_VERSION    1
+
+/*!
+ Maximum number of uncompressed bytes stored in a single block of a compressed CDD file.  Each block is
+ compressed independently so that blocks can be decompressed one at a time while the CDD file is read.
+*/
+#define CDD_CMP_BLOCK_SIZE 65536
+
 /*!
  This contains the header information specified when executing this tool.
 */
@@ -291,6 +309,31 @@
 */
 #define DB_TYPE_INST_ONLY     15
 
+/*!
+ Specifies a binary CDD record that contains one or more text database lines.  This type is
+ never found in a text CDD file.
+*/
+#define DB_TYPE_TEXT_BLOCK    16
+
+/*! @} */
+
+/*!
+ \addtogroup cdd_sections Binary CDD sections
+
+ The following defines specify the kind of each entry in the section table of a binary CDD file.
+
+ @{
+*/
+
+/*! Section containing the general information, score arguments, message and merged CDD lines */
+#define CDD_SECTION_INFO      1
+
+/*! Section containing a functional unit instance and all of its expressions, signals, statements, etc. */
+#define CDD_SECTION_FUNIT     2
+
+/*! Section containing a placeholder instance (no functional unit attached) */
+#define CDD_SECTION_INST_ONLY 3
+
 /*! @} */
 
 /*!
@@ -357,6 +400,12 @@
 /*! Specified that the oldest exclusion reasons should be used. */
 #define MERGE_ER_OLD     5
 
+/*!
+ Used by the worker processes of a parallel merge when the specified resolution depends on the order that CDD files
+ are merged in.  Any exclusion reason conflict stops the worker so that the merge can be performed sequentially.
+*/
+#define MERGE_ER_ABORT   6
+
 /*! @} */
 
 /*!
@@ -1583,6 +1632,21 @@ typedef unsigned long ulong;
 /*! Mods a bit position by an unsigned long */
 #define UL_MOD(x)  (((unsigned int)x) &  UL_MOD_VAL)
 
+/*! Returns the number of unsigned long elements required to store a vector with a bit width of width */
+#define UL_SIZE(width)  (UL_DIV((width) - 1) + 1)
+
+/*! Returns a pointer to the given plane of a value array that holds width bits per plane */
+#define UL_PLANE(value,width,plane)  ((value) + ((plane) * UL_SIZE(width)))
+
+/*! Returns a pointer to the given plane (one of the VTYPE_INDEX_* values) of a VDATA_UL vector */
+#define VEC_PLANE(vec,plane)  UL_PLANE((vec)->value.ul, (vec)->width, plane)
+
+/*!
+ Number of unsigned long elements that a vector can store without allocating its value array.  This
+ is large enough to hold all planes of a single-word value, signal or expression vector.
+*/
+#define VECTOR_INLINE_SIZE  VTYPE_INDEX_EXP_NUM
+
 /*------------------------------------------------------------------------------*/
 
 union esuppl_u;
@@ -1865,6 +1929,9 @@ struct fsm_s;
 struct fsm_table_arc_s;
 struct fsm_table_s;
 struct statement_s;
+struct exp_inst_s;
+struct exp_prog_s;
+struct exp_frame_s;
 struct stmt_iter_s;
 struct stmt_link_s;
 struct stmt_loop_link_s;
@@ -1880,6 +1947,7 @@ struct sym_sig_s;
 struct sym_exp_s;
 struct sym_mem_s;
 struct symtable_s;
+struct sym_hash_s;
 struct static_expr_s;
 struct vector_width_s;
 struct exp_bind_s;
@@ -1899,6 +1967,7 @@ struct stmt_blk_s;
 struct thread_s;
 struct thr_link_s;
 struct thr_list_s;
+struct dly_entry_s;
 struct perf_stat_s;
 struct port_info_s;
 struct param_oride_s;
@@ -2001,6 +2070,21 @@ typedef struct fsm_table_s fsm_table;
 */
 typedef struct statement_s statement;
 
+/*!
+ Renaming exp_inst structure for convenience.
+*/
+typedef struct exp_inst_s exp_inst;
+
+/*!
+ Renaming exp_prog structure for convenience.
+*/
+typedef struct exp_prog_s exp_prog;
+
+/*!
+ Renaming exp_frame structure for convenience.
+*/
+typedef struct exp_frame_s exp_frame;
+
 /*!
  Renaming statement iterator structure for convenience.
 */
@@ -2076,6 +2160,11 @@ typedef struct sym_mem_s sym_mem;
 */
 typedef struct symtable_s symtable;
 
+/*!
+ Renaming symbol hash entry structure for convenience.
+*/
+typedef struct sym_hash_s sym_hash;
+
 /*!
  Renaming static expression structure for convenience.
 */
@@ -2153,6 +2242,11 @@ typedef struct thr_link_s thr_link;
 */
 typedef struct thr_list_s thr_list;
 
+/*!
+ Renaming dly_entry structure for convenience.
+*/
+typedef struct dly_entry_s dly_entry;
+
 /*!
  Renaming perf_stat structure for convenience.
 */
@@ -2343,10 +2437,11 @@ struct vector_s {
   unsigned int width;                /*!< Bit width of this vector */
   vsuppl       suppl;                /*!< Supplemental field */
   union {
-    ulong** ul;                      /*!< Machine sized unsigned integer array for value, signal, expression and memory types */
+    ulong*  ul;                      /*!< Machine sized unsigned integer planes (stored back-to-back, see VEC_PLANE) for value, signal, expression and memory types */
     rv64*   r64;                     /*!< 64-bit floating point value */
     rv32*   r32;                     /*!< 32-bit floating point value (shortreal) */
   } value;
+  ulong        small[VECTOR_INLINE_SIZE];  /*!< Inline plane storage for vectors too small to need a heap value array */
 };
 
 /*!
@@ -2500,6 +2595,8 @@ struct statement_s {
   int         conn_id;               /*!< Current connection ID (used to make sure that we do not infinitely loop
                                           in connecting statements together) */
   func_unit*  funit;                 /*!< Pointer to statement's functional unit that it belongs to */
+  thread*     wait_head;             /*!< Pointer to head of circular list of threads waiting on this statement */
+  exp_prog*   prog;                  /*!< Pointer to compiled program of the root expression tree (created when the simulator is initialized) */
   union {
     uint32  all;
     struct {
@@ -2531,6 +2628,46 @@ struct statement_s {
   } suppl;                           /*!< Supplemental bits for statements */
 };
 
+/*!
+ Single instruction of a compiled expression program.  Programs are stored in post-order so that the
+ instructions of child expressions always come before the instruction of their parent expression.
+*/
+struct exp_inst_s {
+  expression* expr;                  /*!< Pointer to expression evaluated by this instruction */
+  int         left;                  /*!< Index of instruction that evaluates the left child (-1 if there is no left child) */
+  int         right;                 /*!< Index of instruction that evaluates the right child (-1 if there is no right child) */
+  union {
+    uint8 all;
+    struct {
+      uint8 lhs       : 1;           /*!< Set to 1 if the expression is part of a LHS (this instruction does nothing) */
+      uint8 case_op   : 1;           /*!< Set to 1 if the left child must always be evaluated (CASE, CASEX and CASEZ) */
+      uint8 skip_left : 1;           /*!< Set to 1 if the left child must never be evaluated (DLY_OP with a DELAY on the left) */
+      uint8 dly_op    : 1;           /*!< Set to 1 if the right child must not be evaluated the first time the thread executes */
+      uint8 operate   : 1;           /*!< Set to 1 if the expression must be operated on even if neither child changed */
+      uint8 direct    : 1;           /*!< Set to 1 if func can be called directly (the expression is not attached to an FSM) */
+    } part;
+  } suppl;
+  bool (*func)( expression*, thread*, const sim_time* );  /*!< Operation function of the expression (from exp_op_info) */
+};
+
+/*!
+ Compiled version of a statement's root expression tree that is executed by sim_expression_program.
+*/
+struct exp_prog_s {
+  exp_inst*    insts;                /*!< Array of instructions (the last instruction evaluates the root expression) */
+  unsigned int size;                 /*!< Number of elements in the insts array */
+  unsigned int depth;                /*!< Maximum number of interpreter frames needed to execute this program */
+};
+
+/*!
+ Interpreter frame used when executing a compiled expression program.
+*/
+struct exp_frame_s {
+  int   inst;                        /*!< Index of instruction whose child is being evaluated */
+  uint8 phase;                       /*!< Specifies which child is being evaluated (1=left, 2=right) */
+  bool  left_changed;                /*!< Set to TRUE if the left child expression changed value (valid when phase is 2) */
+};
+
 /*!
  Statement link iterator.
 */
@@ -2695,6 +2832,7 @@ struct func_unit_s {
     thread*   thr;                   /*!< Pointer to a single thread that this statement is associated with */
     thr_list* tlist;                 /*!< Pointer to a list of threads that this statement is currently associated with */
   } elem;                            /*!< Pointer element */
+  unsigned int    thr_size;          /*!< Number of threads currently associated with this functional unit */
 };
 
 /*!
@@ -2738,7 +2876,11 @@ struct sym_exp_s {
 };
 
 /*!
- Stores symbol name of signal along with pointer to signal itself into a lookup table
+ Stores the signals, expressions or FSM table referenced by a VCD symbol along with the last value
+ seen for that symbol in the current timestep.  Entries live in a dense array indexed by the decoded
+ VCD symbol (see symtable.c).  The value is decoded from the dumpfile when it is stored, so it is kept
+ as a packed 4-state value (UL_SIZE(width) lower value words followed by as many upper value words)
+ or, for real signals, as a double.
 */
 struct symtable_s {
   union {
@@ -2746,10 +2888,22 @@ struct symtable_s {
     sym_exp*   exp;                  /*!< Pointer to expression symtable entry */
     fsm*       table;                /*!< Pointer to FSM table symtable entry */
   } entry;
+  ulong*       value;                /*!< Packed 4-state (or real) value last stored for this symbol */
+  unsigned int width;                /*!< Number of bits in value */
   char         entry_type;           /*!< Specifies if this entry represents a signal (1), expression (2) or fsm (3) */
-  char*        value;                /*!< String representation of last current value */
-  unsigned int size;                 /*!< Number of bytes allowed storage for value */
-  symtable*    table[94];            /*!< Array of symbol tables for next level (only enough for printable characters) */
+  bool         pending;              /*!< Set if a value has been stored for this symbol in the current timestep */
+  bool         real;                 /*!< Set if value holds a real number instead of a 4-state value */
+};
+
+/*!
+ Holds a symbol table entry whose VCD symbol does not decode to an index within the dense
+ symbol table array.  These entries are chained in a small hash table keyed on the symbol string.
+*/
+struct sym_hash_s {
+  char*        sym;                  /*!< VCD symbol of this entry (NULL-terminated) */
+  unsigned int sym_len;              /*!< Number of characters in sym */
+  symtable     symtab;               /*!< Symbol table entry for this symbol */
+  sym_hash*    next;                 /*!< Pointer to next entry in the same hash bucket */
 };
 
 /*!
@@ -2942,6 +3096,8 @@ struct thread_s {
   thread*    queue_next;             /*!< Pointer to next thread in active/delayed queue */
   thread*    all_prev;               /*!< Pointer to previous thread in all pool */
   thread*    all_next;               /*!< Pointer to next thread in all pool */
+  thread*    wait_prev;              /*!< Pointer to previous thread waiting on the same statement (valid in the waiting state) */
+  thread*    wait_next;              /*!< Pointer to next thread waiting on the same statement (valid in the waiting state) */
   sim_time   curr_time;              /*!< Set to the current simulation time for this thread */
 };
 
@@ -2962,6 +3118,15 @@ struct thr_list_s {
   thr_link* next;                    /*!< Pointer to next thread link in list to use for newly added threads */
 };
 
+/*!
+ Element of the delay queue overflow heap.  Threads whose wakeup time is too far in the future to
+ be stored in the timing wheel are placed in this heap, ordered by time and then by insertion order.
+*/
+struct dly_entry_s {
+  thread* thr;                       /*!< Pointer to delayed thread */
+  uint64  seq;                       /*!< Insertion sequence number (keeps threads with the same wakeup time in FIFO order) */
+};
+
 /*!
  Performance statistic container used for simulation-time performance characteristics.
 */
@@ -3135,6 +3300,8 @@ struct db_s {
   funit_link*  funit_tail;            /*!< Pointer to tail of functional unit list */
   str_link*    fver_head;             /*!< Pointer to head of file version list */
   str_link*    fver_tail;             /*!< Pointer to head of file version list */
+  bool         binary;                /*!< Set to TRUE if the first CDD read into this database was a binary CDD */
+  bool         compressed;            /*!< Set to TRUE if the first CDD read into this database was a compressed CDD */
 };
 
 /*!
@@ -833,8 +833,9 @@
  \par
  The simulation engine in Covered is closely tied to the VCD parser.  When the VCD parser is
  parsing the value change portion of the VCD file, value changes are recorded by associating
- a value to the signal specified by the VCD symbol.  The symbol and value are stored in a tree
- structure for quick lookup.  Entries in this table are sorted/searched by symbol string value.
+ a value to the signal specified by the VCD symbol.  The value is stored in a symbol table entry
+ for quick lookup.  Entries in this table are kept in an array that is indexed by the VCD symbol,
+ decoded as a base-94 number.
  When a timestep is encountered in the VCD table, the simulation engine is invoked for that
  timestep in which it carries out two operations.
  
@@ -44,6 +44,7 @@ extern unsigned int curr_db;
 extern isuppl       info_suppl;
 extern char         user_msg[USER_MSG_LENGTH];
 extern int          merge_er_value;
+extern bool         merge_er_conflict;
 
 /*!
  Name of CDD file that will be read, modified with exclusion modifications and written back.
@@ -1061,6 +1062,13 @@ void exclude_resolve_reason(
       }
       break;
 
+    case MERGE_ER_ABORT :
+      merge_er_conflict = TRUE;
+      Throw 0;
+      /*@-unreachable@*/
+      break;
+      /*@=unreachable@*/
+
     default :
       assert( 0 );
       break;
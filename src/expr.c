@@ -136,6 +136,7 @@
 #include <math.h>
 
 #include "binding.h"
+#include "db.h"
 #include "defines.h"
 #include "expr.h"
 #include "fsm.h"
@@ -448,9 +449,8 @@ static void expression_create_tmp_vecs(
           /* Allocate the memory */
           exp->elem.tvecs = (vecblk*)malloc_safe( sizeof( vecblk ) );
           for( i=0; i<EXPR_TMP_VECS( exp->op ); i++ ) {
-            vector* vec = vector_create( width, VTYPE_VAL, VDATA_UL, TRUE );
-            vector_init_ulong( &(exp->elem.tvecs->vec[i]), vec->value.ul, 0, hdata, TRUE, width, VTYPE_VAL );
-            free_safe( vec, sizeof( vector ) );
+            vector* vec = &(exp->elem.tvecs->vec[i]);
+            vector_init_ulong( vec, vector_alloc_ulong( vec, width, VTYPE_VAL ), 0, hdata, TRUE, width, VTYPE_VAL );
           }
         }
         break;
@@ -588,8 +588,6 @@ static void expression_create_value(
 
     if( ((data == TRUE) || (exp->suppl.part.gen_expr == 1)) && (width > 0) ) {
 
-      vector* vec = NULL;
-
       if( width > MAX_BIT_WIDTH ) {
         unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "Found an expression width (%d) that exceeds the maximum currently allowed by Covered (%d)",
                                     width, MAX_BIT_WIDTH );
@@ -598,10 +596,8 @@ static void expression_create_value(
         Throw 0;
       }
 
-      vec = vector_create( width, VTYPE_EXP, VDATA_UL, TRUE );
       assert( exp->value->value.ul == NULL );
-      vector_init_ulong( exp->value, vec->value.ul, 0x0, 0x0, TRUE, width, vec->suppl.part.type );
-      free_safe( vec, sizeof( vector ) );
+      vector_init_ulong( exp->value, vector_alloc_ulong( exp->value, width, VTYPE_EXP ), 0x0, 0x0, TRUE, width, VTYPE_EXP );
 
       /* Create the temporary vectors now, if needed */
       expression_create_tmp_vecs( exp, width );
@@ -1595,7 +1591,199 @@ void expression_db_write_tree(
 #endif /* RUNLIB */
 
 /*!
- \throws anonymous expression_create Throw Throw Throw Throw Throw vector_db_read
+ Appends the specified expression to the binary CDD file as a binary record.  The record contains the same
+ information as the line written by expression_db_write.
+*/
+void expression_db_write_bin(
+  expression* expr,       /*!< Pointer to expression to write to database file */
+  FILE*       file,       /*!< Pointer to database file to write to */
+  bool        ids_issued  /*!< Set to TRUE if IDs were issued prior to calling this function */
+) { PROFILE(EXPRESSION_DB_WRITE_BIN);
+
+  uint32 fields[10];  /* Fixed-width fields of expression record */
+
+  assert( expr != NULL );
+
+  fields[0] = (uint32)expression_get_id( expr, ids_issued );
+  fields[1] = expr->line;
+  fields[2] = expr->ppfline;
+  fields[3] = expr->pplline;
+  fields[4] = expr->col.all;
+  fields[5] = (((expr->op == EXP_OP_DASSIGN) || (expr->op == EXP_OP_ASSIGN)) && (expr->exec_num == 0)) ? (uint32)1 : expr->exec_num;
+  fields[6] = expr->op;
+  fields[7] = (expr->suppl.all & ESUPPL_MERGE_MASK);
+  fields[8] = (uint32)((expr->op == EXP_OP_STATIC) ? 0 : expression_get_id( expr->right, ids_issued ));
+  fields[9] = (uint32)((expr->op == EXP_OP_STATIC) ? 0 : expression_get_id( expr->left,  ids_issued ));
+
+  db_bin_start_record( DB_TYPE_EXPRESSION );
+  db_bin_put( fields, sizeof( fields ) );
+
+  if( ESUPPL_OWNS_VEC( expr->suppl ) ) {
+    vector_db_write_bin( expr->value, (expr->op == EXP_OP_STATIC), FALSE );
+  }
+
+  db_bin_put_str( (expr->name != NULL) ? expr->name : ((expr->sig != NULL) ? expr->sig->name : NULL) );
+
+  db_bin_end_record( file );
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns TRUE if all of the fixed fields of an expression line were parsed; otherwise, returns FALSE.
+
+ Parses the fixed fields of an expression database line (see expression_db_write) and advances the
+ line pointer past them.
+*/
+static bool expression_db_scan(
+            char**        line,      /*!< Pointer to line to parse */
+  /*@out@*/ int*          id,        /*!< Expression ID */
+  /*@out@*/ unsigned int* linenum,   /*!< Line number */
+  /*@out@*/ unsigned int* ppfline,   /*!< First line number of the preprocessed file */
+  /*@out@*/ unsigned int* pplline,   /*!< Last line number of the preprocessed file */
+  /*@out@*/ unsigned int* column,    /*!< Column information */
+  /*@out@*/ uint32*       exec_num,  /*!< Execution number */
+  /*@out@*/ uint32*       op,        /*!< Expression operation */
+  /*@out@*/ esuppl*       suppl,     /*!< Supplemental field */
+  /*@out@*/ int*          right_id,  /*!< ID of right child */
+  /*@out@*/ int*          left_id    /*!< ID of left child */
+) {
+
+  return( util_scan_int( line, id, 10 ) && util_scan_uint( line, linenum, 10 ) && util_scan_uint( line, ppfline, 10 ) &&
+          util_scan_uint( line, pplline, 10 ) && util_scan_uint( line, column, 16 ) && util_scan_uint( line, exec_num, 16 ) &&
+          util_scan_uint( line, op, 16 ) && util_scan_uint( line, &(suppl->all), 16 ) && util_scan_int( line, right_id, 10 ) &&
+          util_scan_int( line, left_id, 10 ) );
+
+}
+
+/*!
+ \throws anonymous expression_create Throw Throw Throw
+
+ Creates a new expression from the fields of an expression that were read from the database file, links it
+ to its child expressions and adds it to the expression array of the specified functional unit.  The given
+ vector becomes the value of the new expression (it is deallocated if the expression cannot be created).
+*/
+static void expression_db_build(
+  func_unit*   curr_funit,  /*!< Pointer to current functional unit that instantiates this expression */
+  bool         eval,        /*!< If TRUE, evaluate expression if children are static */
+  unsigned int linenum,     /*!< Line number of expression */
+  unsigned int ppfline,     /*!< First line of expression in preprocessed file */
+  unsigned int pplline,     /*!< Last line of expression in preprocessed file */
+  unsigned int column,      /*!< Column alignment information */
+  uint32       exec_num,    /*!< Execution number of expression */
+  uint32       op,          /*!< Expression operation */
+  esuppl       suppl,       /*!< Supplemental value of expression */
+  int          right_id,    /*!< Expression ID of right child (0 if there is no right child) */
+  int          left_id,     /*!< Expression ID of left child (0 if there is no left child) */
+  vector*      vec,         /*!< Pointer to read vector value (NULL if the expression does not own its vector) */
+  char*        name         /*!< Name of signal/functional unit that expression is bound to (NULL if not bound) */
+) {
+
+  expression* expr;   /* Pointer to newly created expression */
+  expression* right;  /* Pointer to current expression's right expression */
+  expression* left;   /* Pointer to current expression's left expression */
+
+  /* Find functional unit instance name */
+  if( curr_funit == NULL ) {
+
+    unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "Internal error:  expression (%d) in database written before its functional unit", curr_expr_id );
+    assert( rv < USER_MSG_LENGTH );
+    print_output( user_msg, FATAL, __FILE__, __LINE__ );
+    vector_dealloc( vec );
+    Throw 0;
+
+  } else {
+
+    /* Find right expression */
+    if( right_id == 0 ) {
+      right = NULL;
+    } else if( (right = exp_link_find( right_id, curr_funit->exps, curr_funit->exp_size )) == NULL ) {
+      unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "Internal error:  root expression (%d) found before leaf expression (%d) in database file", curr_expr_id, right_id );
+      assert( rv < USER_MSG_LENGTH );
+      print_output( user_msg, FATAL, __FILE__, __LINE__ );
+      vector_dealloc( vec );
+      Throw 0;
+    }
+
+    /* Find left expression */
+    if( left_id == 0 ) {
+      left = NULL;
+    } else if( (left = exp_link_find( left_id, curr_funit->exps, curr_funit->exp_size )) == NULL ) {
+      unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "Internal error:  root expression (%d) found before leaf expression (%d) in database file", curr_expr_id, left_id );
+      assert( rv < USER_MSG_LENGTH );
+      print_output( user_msg, FATAL, __FILE__, __LINE__ );
+      vector_dealloc( vec );
+      Throw 0;
+    }
+
+    /* Create new expression */
+    expr = expression_create( right, left, op, ESUPPL_IS_LHS( suppl ), curr_expr_id, linenum, ppfline, pplline,
+                              ((column >> 16) & 0xffff), (column & 0xffff), ESUPPL_OWNS_VEC( suppl ) );
+
+    expr->suppl.all = suppl.all;
+    expr->exec_num  = exec_num;
+
+    if( op == EXP_OP_DELAY ) {
+      expr->suppl.part.type = ETYPE_DELAY;
+      expr->elem.scale = &(curr_funit->timescale);
+    }
+
+    /* Copy expression value */
+    if( vec != NULL ) {
+      vector_dealloc( expr->value );
+      expr->value = vec;
+    }
+
+    /* Create temporary vectors if necessary */
+    expression_create_tmp_vecs( expr, expr->value->width );
+
+    /* Check to see if we are bound to a signal or functional unit */
+    if( name != NULL ) {
+      switch( op ) {
+        case EXP_OP_FUNC_CALL :  bind_add( FUNIT_FUNCTION,    name, expr, curr_funit, FALSE );  break;
+        case EXP_OP_TASK_CALL :  bind_add( FUNIT_TASK,        name, expr, curr_funit, FALSE );  break;
+        case EXP_OP_FORK      :
+        case EXP_OP_NB_CALL   :  bind_add( FUNIT_NAMED_BLOCK, name, expr, curr_funit, FALSE );  break;
+        case EXP_OP_DISABLE   :  bind_add( 1,                 name, expr, curr_funit, FALSE );  break;
+        default               :  bind_add( 0,                 name, expr, curr_funit, FALSE );  break;
+      }
+    }
+
+    /* If we are an assignment operator, set our vector value to that of the right child */
+    if( (op == EXP_OP_ASSIGN)     ||
+        (op == EXP_OP_DASSIGN)    ||
+        (op == EXP_OP_BASSIGN)    ||
+        (op == EXP_OP_RASSIGN)    ||
+        (op == EXP_OP_NASSIGN)    ||
+        (op == EXP_OP_DLY_ASSIGN) ||
+        (op == EXP_OP_IF)         ||
+        (op == EXP_OP_WHILE)      ||
+        (op == EXP_OP_DIM) ) {
+
+      vector_dealloc( expr->value );
+      expr->value = right->value;
+
+    }
+
+    exp_link_add( expr, &(curr_funit->exps), &(curr_funit->exp_size) );
+
+#ifndef RUNLIB
+    /*
+     If this expression is a constant expression, force the simulator to evaluate
+     this expression and all parent expressions of it.
+    */
+    if( eval && EXPR_IS_STATIC( expr ) && (ESUPPL_IS_LHS( suppl ) == 0) ) {
+      exp_link_add( expr, &static_exprs, &static_expr_size );
+    }
+#endif /* RUNLIB */
+      
+  }
+
+}
+
+/*!
+ \throws anonymous expression_db_build Throw vector_db_read
 
  Reads in the specified expression information, creates new expression from
  heap, populates the expression with specified information from file and 
@@ -1608,7 +1796,6 @@ void expression_db_read(
   bool       eval         /*!< If TRUE, evaluate expression if children are static */
 ) { PROFILE(EXPRESSION_DB_READ);
 
-  expression*  expr;        /* Pointer to newly created expression */
   unsigned int linenum;     /* Holder of current line for this expression */
   unsigned int ppfline;
   unsigned int pplline;
@@ -1618,135 +1805,113 @@ void expression_db_read(
   esuppl       suppl;       /* Holder of supplemental value of this expression */
   int          right_id;    /* Holder of expression ID to the right */
   int          left_id;     /* Holder of expression ID to the left */
-  expression*  right;       /* Pointer to current expression's right expression */
-  expression*  left;        /* Pointer to current expression's left expression */
-  int          chars_read;  /* Number of characters scanned in from line */
-  vector*      vec;         /* Holders vector value of this expression */
-
-  if( sscanf( *line, "%d %u %u %u %x %x %x %x %d %d%n", &curr_expr_id, &linenum, &ppfline, &pplline, &column, &exec_num, &op, &(suppl.all), &right_id, &left_id, &chars_read ) == 10 ) {
+  vector*      vec  = NULL; /* Holders vector value of this expression */
+  char*        name = NULL; /* Name of signal/functional unit that this expression is bound to */
 
-    *line = *line + chars_read;
+  if( expression_db_scan( line, &curr_expr_id, &linenum, &ppfline, &pplline, &column, &exec_num, &op, &suppl, &right_id, &left_id ) ) {
 
-    /* Find functional unit instance name */
-    if( curr_funit == NULL ) {
+    /* Read in vector information */
+    if( ESUPPL_OWNS_VEC( suppl ) ) {
+      vector_db_read( &vec, line );
+    }
 
-      unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "Internal error:  expression (%d) in database written before its functional unit", curr_expr_id );
-      assert( rv < USER_MSG_LENGTH );
-      print_output( user_msg, FATAL, __FILE__, __LINE__ );
-      Throw 0;
+    /* Check to see if we are bound to a signal or functional unit */
+    if( ((*line)[0] != '\n') && ((*line)[0] != '\0') ) {
+      (*line)++;   /* Remove space */
+      name = *line;
+    }
 
-    } else {
+    expression_db_build( curr_funit, eval, linenum, ppfline, pplline, column, exec_num, op, suppl, right_id, left_id, vec, name );
 
-      /* Find right expression */
-      if( right_id == 0 ) {
-        right = NULL;
-      } else if( (right = exp_link_find( right_id, curr_funit->exps, curr_funit->exp_size )) == NULL ) {
-        unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "Internal error:  root expression (%d) found before leaf expression (%d) in database file", curr_expr_id, right_id );
-        assert( rv < USER_MSG_LENGTH );
-        print_output( user_msg, FATAL, __FILE__, __LINE__ );
-        Throw 0;
-      }
-
-      /* Find left expression */
-      if( left_id == 0 ) {
-        left = NULL;
-      } else if( (left = exp_link_find( left_id, curr_funit->exps, curr_funit->exp_size )) == NULL ) {
-        unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "Internal error:  root expression (%d) found before leaf expression (%d) in database file", curr_expr_id, left_id );
-        assert( rv < USER_MSG_LENGTH );
-        print_output( user_msg, FATAL, __FILE__, __LINE__ );
-        Throw 0;
-      }
+  } else {
 
-      /* Create new expression */
-      expr = expression_create( right, left, op, ESUPPL_IS_LHS( suppl ), curr_expr_id, linenum, ppfline, pplline,
-                                ((column >> 16) & 0xffff), (column & 0xffff), ESUPPL_OWNS_VEC( suppl ) );
+    print_output( "Unable to read expression value", FATAL, __FILE__, __LINE__ );
+    Throw 0;
 
-      expr->suppl.all = suppl.all;
-      expr->exec_num  = exec_num;
+  }
 
-      if( op == EXP_OP_DELAY ) {
-        expr->suppl.part.type = ETYPE_DELAY;
-        expr->elem.scale = &(curr_funit->timescale);
-      }
+  PROFILE_END;
 
-      if( ESUPPL_OWNS_VEC( suppl ) ) {
+}
 
-        Try {
+/*!
+ \throws anonymous expression_db_build db_bin_get db_bin_get_str vector_db_read_bin
 
-          /* Read in vector information */
-          vector_db_read( &vec, line );
+ Reads in the expression information of the specified binary CDD record (see expression_db_write_bin), creates
+ a new expression and adds it to the specified functional unit.
+*/
+void expression_db_read_bin(
+  char**     line,        /*!< Pointer to binary record to read information from */
+  func_unit* curr_funit,  /*!< Pointer to current functional unit that instantiates this expression */
+  bool       eval         /*!< If TRUE, evaluate expression if children are static */
+) { PROFILE(EXPRESSION_DB_READ_BIN);
 
-        } Catch_anonymous {
-          expression_dealloc( expr, TRUE );
-          Throw 0;
-        }
+  uint32  fields[10];  /* Fixed-width fields of expression record */
+  esuppl  suppl;       /* Holder of supplemental value of this expression */
+  vector* vec = NULL;  /* Holders vector value of this expression */
+  char*   name;        /* Name of signal/functional unit that this expression is bound to */
 
-        /* Copy expression value */
-        vector_dealloc( expr->value );
-        expr->value = vec;
+  db_bin_get( line, fields, sizeof( fields ) );
 
-      }
+  curr_expr_id = (int)fields[0];
+  suppl.all    = fields[7];
 
-      /* Create temporary vectors if necessary */
-      expression_create_tmp_vecs( expr, expr->value->width );
-
-      /* Check to see if we are bound to a signal or functional unit */
-      if( ((*line)[0] != '\n') && ((*line)[0] != '\0') ) {
-        (*line)++;   /* Remove space */
-        switch( op ) {
-          case EXP_OP_FUNC_CALL :  bind_add( FUNIT_FUNCTION,    *line, expr, curr_funit, FALSE );  break;
-          case EXP_OP_TASK_CALL :  bind_add( FUNIT_TASK,        *line, expr, curr_funit, FALSE );  break;
-          case EXP_OP_FORK      :
-          case EXP_OP_NB_CALL   :  bind_add( FUNIT_NAMED_BLOCK, *line, expr, curr_funit, FALSE );  break;
-          case EXP_OP_DISABLE   :  bind_add( 1,                 *line, expr, curr_funit, FALSE );  break;
-          default               :  bind_add( 0,                 *line, expr, curr_funit, FALSE );  break;
-        }
-      }
+  /* Read in vector information */
+  if( ESUPPL_OWNS_VEC( suppl ) ) {
+    vector_db_read_bin( &vec, line );
+  }
 
-      /* If we are an assignment operator, set our vector value to that of the right child */
-      if( (op == EXP_OP_ASSIGN)     ||
-          (op == EXP_OP_DASSIGN)    ||
-          (op == EXP_OP_BASSIGN)    ||
-          (op == EXP_OP_RASSIGN)    ||
-          (op == EXP_OP_NASSIGN)    ||
-          (op == EXP_OP_DLY_ASSIGN) ||
-          (op == EXP_OP_IF)         ||
-          (op == EXP_OP_WHILE)      ||
-          (op == EXP_OP_DIM) ) {
+  Try {
+    name = db_bin_get_str( line );
+  } Catch_anonymous {
+    vector_dealloc( vec );
+    Throw 0;
+  }
 
-        vector_dealloc( expr->value );
-        expr->value = right->value;
+  expression_db_build( curr_funit, eval, fields[1], fields[2], fields[3], fields[4], fields[5], fields[6], suppl, (int)fields[8], (int)fields[9], vec, name );
 
-      }
+  PROFILE_END;
 
-      exp_link_add( expr, &(curr_funit->exps), &(curr_funit->exp_size) );
+}
 
 #ifndef RUNLIB
-      /*
-       If this expression is a constant expression, force the simulator to evaluate
-       this expression and all parent expressions of it.
-      */
-      if( eval && EXPR_IS_STATIC( expr ) && (ESUPPL_IS_LHS( suppl ) == 0) ) {
-        exp_link_add( expr, &static_exprs, &static_expr_size );
-      }
-#endif /* RUNLIB */
-      
-    }
+/*!
+ \throws anonymous Throw
 
-  } else {
+ Checks that the fields of an expression read from a CDD file describe the base expression and merges the
+ supplemental field and execution number into the base expression.
+*/
+static void expression_db_merge_fields(
+  expression*  base,      /*!< Expression to merge data into */
+  unsigned int linenum,   /*!< Read line number */
+  unsigned int ppfline,   /*!< Read first line in preprocessed file */
+  unsigned int pplline,   /*!< Read last line in preprocessed file */
+  unsigned int column,    /*!< Read column information */
+  uint32       exec_num,  /*!< Read execution number */
+  uint32       op,        /*!< Read expression operation */
+  esuppl       suppl      /*!< Read supplemental field */
+) {
 
-    print_output( "Unable to read expression value", FATAL, __FILE__, __LINE__ );
+  if( (base->op != op) || (base->line != linenum) || (base->ppfline != ppfline) || (base->pplline != pplline) || (base->col.all != column) ) {
+
+    print_output( "Attempting to merge databases derived from different designs.  Unable to merge",
+                  FATAL, __FILE__, __LINE__ );
     Throw 0;
 
   }
 
-  PROFILE_END;
+  /* Merge expression supplemental fields */
+  base->suppl.all = (base->suppl.all & ESUPPL_MERGE_MASK) | (suppl.all & ESUPPL_MERGE_MASK);
+
+  /* Merge execution number information */
+  if( base->exec_num < exec_num ) {
+    base->exec_num = exec_num;
+  }
 
 }
 
-#ifndef RUNLIB
 /*!
- \throws anonymous Throw vector_db_merge
+ \throws anonymous Throw expression_db_merge_fields vector_db_merge
 
  Parses specified line for expression information and merges contents into the
  base expression.  If the two expressions given are not the same (IDs, op,
@@ -1771,43 +1936,58 @@ void expression_db_merge(
   esuppl       suppl;          /* Supplemental field */
   int          right_id;       /* ID of right child */
   int          left_id;        /* ID of left child */
-  int          chars_read;     /* Number of characters read */
 
   assert( base != NULL );
 
-  if( sscanf( *line, "%d %u %u %u %x %x %x %x %d %d%n", &id, &linenum, &ppfline, &pplline, &column, &exec_num, &op, &(suppl.all), &right_id, &left_id, &chars_read ) == 10 ) {
+  if( expression_db_scan( line, &id, &linenum, &ppfline, &pplline, &column, &exec_num, &op, &suppl, &right_id, &left_id ) ) {
 
-    *line = *line + chars_read;
+    expression_db_merge_fields( base, linenum, ppfline, pplline, column, exec_num, op, suppl );
 
-    if( (base->op != op) || (base->line != linenum) || (base->ppfline != ppfline) || (base->pplline != pplline) || (base->col.all != column) ) {
+    if( ESUPPL_OWNS_VEC( suppl ) ) {
 
-      print_output( "Attempting to merge databases derived from different designs.  Unable to merge",
-                    FATAL, __FILE__, __LINE__ );
-      Throw 0;
+      /* Merge expression vectors */
+      vector_db_merge( base->value, line, same );
 
-    } else {
+    }
 
-      /* Merge expression supplemental fields */
-      base->suppl.all = (base->suppl.all & ESUPPL_MERGE_MASK) | (suppl.all & ESUPPL_MERGE_MASK);
+  } else {
 
-      /* Merge execution number information */
-      if( base->exec_num < exec_num ) {
-        base->exec_num = exec_num;
-      }
+    print_output( "Unable to parse expression line in database.  Unable to merge.", FATAL, __FILE__, __LINE__ );
+    Throw 0;
 
-      if( ESUPPL_OWNS_VEC( suppl ) ) {
+  }
 
-        /* Merge expression vectors */
-        vector_db_merge( base->value, line, same );
+  PROFILE_END;
 
-      }
+}
 
-    }
+/*!
+ \throws anonymous db_bin_get expression_db_merge_fields vector_db_merge_bin
 
-  } else {
+ Parses the expression information of the specified binary CDD record (see expression_db_write_bin) and merges
+ it into the base expression (see expression_db_merge).
+*/
+void expression_db_merge_bin(
+  expression* base,  /*!< Expression to merge data into */
+  char**      line,  /*!< Pointer to binary record to parse */
+  bool        same   /*!< Specifies if expression to be merged needs to be exactly the same as the existing expression */
+) { PROFILE(EXPRESSION_DB_MERGE_BIN);
 
-    print_output( "Unable to parse expression line in database.  Unable to merge.", FATAL, __FILE__, __LINE__ );
-    Throw 0;
+  uint32 fields[10];  /* Fixed-width fields of expression record */
+  esuppl suppl;       /* Supplemental field */
+
+  assert( base != NULL );
+
+  db_bin_get( line, fields, sizeof( fields ) );
+
+  suppl.all = fields[7];
+
+  expression_db_merge_fields( base, fields[1], fields[2], fields[3], fields[4], fields[5], fields[6], suppl );
+
+  if( ESUPPL_OWNS_VEC( suppl ) ) {
+
+    /* Merge expression vectors */
+    vector_db_merge_bin( base->value, line, same );
 
   }
 
@@ -3071,7 +3251,7 @@ bool expression_op_func__sassign(
   bool retval;
 
   switch( expr->value->suppl.part.data_type ) {
-    case VDATA_UL  :  retval = vector_set_value_ulong( expr->value, expr->right->value->value.ul, expr->right->value->width );  break;
+    case VDATA_UL  :  retval = vector_set_value_ulong( expr->value, expr->right->value, expr->right->value->width );  break;
     case VDATA_R64 :
       {
         double real = expr->right->value->value.r64->val;
@@ -3908,7 +4088,7 @@ bool expression_op_func__cond(
   /* Simple vector copy from right side and gather coverage information */
   switch( expr->value->suppl.part.data_type ) {
     case VDATA_UL :
-      retval = vector_set_value_ulong( expr->value, expr->right->value->value.ul, expr->right->value->width );
+      retval = vector_set_value_ulong( expr->value, expr->right->value, expr->right->value->width );
       break;
     case VDATA_R64 :
       retval = !DEQ( expr->value->value.r64->val, expr->right->value->value.r64->val );
@@ -3948,9 +4128,9 @@ bool expression_op_func__cond_sel(
     case VDATA_UL :
       if( !vector_is_unknown( expr->parent->expr->left->value ) ) {
         if( !vector_is_not_zero( expr->parent->expr->left->value ) ) {
-          retval = vector_set_value_ulong( expr->value, expr->right->value->value.ul, expr->right->value->width );
+          retval = vector_set_value_ulong( expr->value, expr->right->value, expr->right->value->width );
         } else {
-          retval = vector_set_value_ulong( expr->value, expr->left->value->value.ul, expr->left->value->width );
+          retval = vector_set_value_ulong( expr->value, expr->left->value, expr->left->value->width );
         }
       } else {
         retval = vector_set_to_x( expr->value );
@@ -4422,7 +4602,7 @@ bool expression_op_func__concat(
 ) { PROFILE(EXPRESSION_OP_FUNC__CONCAT);
 
   /* Perform concatenation operation */
-  bool retval = vector_set_value_ulong( expr->value, expr->right->value->value.ul, expr->right->value->width );
+  bool retval = vector_set_value_ulong( expr->value, expr->right->value, expr->right->value->width );
 
   /* Gather coverage information */
   expression_set_tf_preclear( expr, retval );
@@ -4446,10 +4626,10 @@ bool expression_op_func__pedge(
 ) { PROFILE(EXPRESSION_OP_FUNC__PEDGE);
 
   bool   retval;   /* Return value for this function */
-  ulong  nvall = expr->right->value->value.ul[0][VTYPE_INDEX_EXP_VALL];
-  ulong  nvalh = expr->right->value->value.ul[0][VTYPE_INDEX_EXP_VALH];
-  ulong* ovall = &(expr->elem.tvecs->vec[0].value.ul[0][VTYPE_INDEX_EXP_VALL]);
-  ulong* ovalh = &(expr->elem.tvecs->vec[0].value.ul[0][VTYPE_INDEX_EXP_VALH]);
+  ulong  nvall = VEC_PLANE( expr->right->value, VTYPE_INDEX_EXP_VALL )[0];
+  ulong  nvalh = VEC_PLANE( expr->right->value, VTYPE_INDEX_EXP_VALH )[0];
+  ulong* ovall = &(VEC_PLANE( &(expr->elem.tvecs->vec[0]), VTYPE_INDEX_EXP_VALL )[0]);
+  ulong* ovalh = &(VEC_PLANE( &(expr->elem.tvecs->vec[0]), VTYPE_INDEX_EXP_VALH )[0]);
 
   if( ((*ovalh | ~(*ovall)) & (~nvalh & nvall)) && thr->suppl.part.exec_first ) {
     expr->suppl.part.true   = 1;
@@ -4482,10 +4662,10 @@ bool expression_op_func__nedge(
 ) { PROFILE(EXPRESSION_OP_FUNC__NEDGE);
 
   bool   retval;   /* Return value for this function */
-  ulong  nvall = expr->right->value->value.ul[0][VTYPE_INDEX_EXP_VALL];
-  ulong  nvalh = expr->right->value->value.ul[0][VTYPE_INDEX_EXP_VALH];
-  ulong* ovall = &(expr->elem.tvecs->vec[0].value.ul[0][VTYPE_INDEX_EXP_VALL]);
-  ulong* ovalh = &(expr->elem.tvecs->vec[0].value.ul[0][VTYPE_INDEX_EXP_VALH]);
+  ulong  nvall = VEC_PLANE( expr->right->value, VTYPE_INDEX_EXP_VALL )[0];
+  ulong  nvalh = VEC_PLANE( expr->right->value, VTYPE_INDEX_EXP_VALH )[0];
+  ulong* ovall = &(VEC_PLANE( &(expr->elem.tvecs->vec[0]), VTYPE_INDEX_EXP_VALL )[0]);
+  ulong* ovalh = &(VEC_PLANE( &(expr->elem.tvecs->vec[0]), VTYPE_INDEX_EXP_VALH )[0]);
 
   if( ((*ovalh | *ovall) & (~nvalh & ~nvall)) && thr->suppl.part.exec_first ) {
     expr->suppl.part.true   = 1;
@@ -4694,8 +4874,8 @@ bool expression_op_func__trigger(
 
 #ifndef RUNLIB
   /* Indicate that we have triggered */
-  expr->sig->value->value.ul[0][VTYPE_INDEX_SIG_VALL] = 1;
-  expr->sig->value->value.ul[0][VTYPE_INDEX_SIG_VALH] = 0;
+  VEC_PLANE( expr->sig->value, VTYPE_INDEX_SIG_VALL )[0] = 1;
+  VEC_PLANE( expr->sig->value, VTYPE_INDEX_SIG_VALH )[0] = 0;
 
   /* Propagate event */
   vsignal_propagate( expr->sig, ((thr == NULL) ? time : &(thr->curr_time)) );
@@ -4898,7 +5078,7 @@ bool expression_op_func__func_call(
 
   /* Then copy the function variable to this expression */
   switch( expr->value->suppl.part.data_type ) {
-    case VDATA_UL  :  retval = vector_set_value_ulong( expr->value, expr->sig->value->value.ul, expr->value->width );  break;
+    case VDATA_UL  :  retval = vector_set_value_ulong( expr->value, expr->sig->value, expr->value->width );  break;
     case VDATA_R64 :  retval = vector_from_real64( expr->value, expr->sig->value->value.r64->val );  break;
     case VDATA_R32 :  retval = vector_from_real64( expr->value, (double)expr->sig->value->value.r32->val );  break;
     default        :  assert( 0 );  break;
@@ -5069,7 +5249,7 @@ bool expression_op_func__repeat(
 
   retval = vector_op_lt( expr->value, expr->left->value, expr->right->value );
 
-  if( expr->value->value.ul[0][VTYPE_INDEX_VAL_VALL] == 0 ) {
+  if( VEC_PLANE( expr->value, VTYPE_INDEX_VAL_VALL )[0] == 0 ) {
     (void)vector_from_int( expr->left->value, 0 );
   } else {
     (void)vector_from_int( expr->left->value, (vector_to_int( expr->left->value ) + 1) );
@@ -5096,33 +5276,8 @@ bool expression_op_func__exponent(
   /*@unused@*/ const sim_time* time   /*!< Pointer to current simulation time */
 ) { PROFILE(EXPRESSION_OP_FUNC__EXPONENT);
 
-  bool retval;  /* Return value for this function */
-
-  /* If the left and right expression values are not unknown, calculate exponent */
-  if( !vector_is_unknown( expr->left->value ) && !vector_is_unknown( expr->right->value ) ) {
-
-    int   intval1;
-    int   intval2;
-    ulong vall = 1;
-    ulong valh = 0;
-    int   i;
-
-    intval1 = vector_to_int( expr->left->value );
-    intval2 = vector_to_int( expr->right->value );
-
-    for( i=0; i<intval2; i++ ) {
-      vall *= intval1;
-    }
-
-    /* Assign value and calculate coverage */
-    retval = vector_set_coverage_and_assign_ulong( expr->value, &vall, &valh, 0, 31 );
-
-  /* Otherwise, the entire value should be X */
-  } else {
-
-    retval = vector_set_to_x( expr->value );
-
-  }
+  /* Perform exponent operation */
+  bool retval = vector_op_exponent( expr->value, expr->left->value, expr->right->value );
 
   /* Gather coverage information */
   expression_set_tf_preclear( expr, retval );
@@ -5162,7 +5317,7 @@ bool expression_op_func__passign(
     /* If the connected signal is an input type, copy the parameter expression value to this vector */
     case SSUPPL_TYPE_INPUT_NET :
     case SSUPPL_TYPE_INPUT_REG :
-      retval = vector_set_value_ulong( expr->value, expr->right->value->value.ul, expr->right->value->width );
+      retval = vector_set_value_ulong( expr->value, expr->right->value, expr->right->value->width );
       vsignal_propagate( expr->sig, ((thr == NULL) ? time : &(thr->curr_time)) );
       break;
 
@@ -5344,7 +5499,7 @@ bool expression_op_func__iinc(
 
   /* Assign the left value to our value */
   switch( expr->left->value->suppl.part.data_type ) {
-    case VDATA_UL  :  (void)vector_set_value_ulong( expr->value, expr->left->value->value.ul, expr->left->value->width );  break;
+    case VDATA_UL  :  (void)vector_set_value_ulong( expr->value, expr->left->value, expr->left->value->width );  break;
     case VDATA_R64 :  expr->value->value.r64->val = expr->left->value->value.r64->val;  break;
     case VDATA_R32 :  expr->value->value.r32->val = expr->left->value->value.r32->val;  break;
     default        :  assert( 0 );  break;
@@ -5382,7 +5537,7 @@ bool expression_op_func__pinc(
 #ifndef RUNLIB
   /* Copy the left-hand value to our expression */
   switch( expr->left->value->suppl.part.data_type ) {
-    case VDATA_UL  :  (void)vector_set_value_ulong( expr->value, expr->left->value->value.ul, expr->left->value->width );  break;
+    case VDATA_UL  :  (void)vector_set_value_ulong( expr->value, expr->left->value, expr->left->value->width );  break;
     case VDATA_R64 :  expr->value->value.r64->val = expr->left->value->value.r64->val;  break;
     case VDATA_R32 :  expr->value->value.r32->val = expr->left->value->value.r32->val;  break;
     default        :  assert( 0 );  break;
@@ -5438,7 +5593,7 @@ bool expression_op_func__idec(
 
   /* Copy the left-hand value to our expression */
   switch( expr->left->value->suppl.part.data_type ) {
-    case VDATA_UL  :  (void)vector_set_value_ulong( expr->value, expr->left->value->value.ul, expr->left->value->width );  break;
+    case VDATA_UL  :  (void)vector_set_value_ulong( expr->value, expr->left->value, expr->left->value->width );  break;
     case VDATA_R64 :  expr->value->value.r64->val = expr->left->value->value.r64->val;  break;
     case VDATA_R32 :  expr->value->value.r32->val = expr->left->value->value.r32->val;  break;
     default        :  assert( 0 );  break;
@@ -5476,7 +5631,7 @@ bool expression_op_func__pdec(
 #ifndef RUNLIB
   /* Copy the left-hand value to our expression */
   switch( expr->left->value->suppl.part.data_type ) {
-    case VDATA_UL  :  (void)vector_set_value_ulong( expr->value, expr->left->value->value.ul, expr->left->value->width );  break;
+    case VDATA_UL  :  (void)vector_set_value_ulong( expr->value, expr->left->value, expr->left->value->width );  break;
     case VDATA_R64 :  expr->value->value.r64->val = expr->left->value->value.r64->val;  break;
     case VDATA_R32 :  expr->value->value.r32->val = expr->left->value->value.r32->val;  break;
     default        :  assert( 0 );  break;
@@ -5562,7 +5717,7 @@ bool expression_op_func__dly_op(
 
   /* If we are not waiting for the delay to occur, copy the contents of the operation */
   if( !thr->suppl.part.exec_first ) {
-    (void)vector_set_value_ulong( expr->value, expr->right->value->value.ul, expr->right->value->width );
+    (void)vector_set_value_ulong( expr->value, expr->right->value, expr->right->value->width );
   }
 
   /* Explicitly call the delay/event.  If the delay is complete, set eval_t to TRUE */
@@ -5598,7 +5753,7 @@ bool expression_op_func__repeat_dly(
     (void)expression_op_func__repeat( expr->left, thr, time );
 
     /* If the repeat operation evaluated to TRUE, perform delay operation */
-    if( expr->left->value->value.ul[0][VTYPE_INDEX_VAL_VALL] == 1 ) {
+    if( VEC_PLANE( expr->left->value, VTYPE_INDEX_VAL_VALL )[0] == 1 ) {
       (void)exp_op_info[expr->right->op].func( expr->right, thr, time );
       expr->suppl.part.eval_t = 0;
 
@@ -5842,21 +5997,97 @@ void expression_set_line_coverage(
 
 }
 
+/*!
+ Sets combinational logic coverage for the given expression from a bitmap of the values that it was seen to
+ evaluate to.  If bit 7 of the bitmap is set, bits 0-3 are set for each {left,right} value pair that was seen;
+ otherwise, bits 0 and 1 are set if the expression was seen to be false or true, respectively.
+*/
+void expression_set_comb_coverage(
+  expression* exp,  /*!< Pointer to expression to set */
+  uint32      hits  /*!< Bitmap of value combinations seen during simulation */
+) { PROFILE(EXPRESSION_SET_COMB_COVERAGE);
+
+  uint32 f00 = (hits >> 0) & 1;
+  uint32 f01 = (hits >> 1) & 1;
+  uint32 f10 = (hits >> 2) & 1;
+  uint32 f11 = (hits >> 3) & 1;
+
+  if( (hits & 0x80) == 0 ) {
+    exp->suppl.part.true  |= f01;
+    exp->suppl.part.false |= f00;
+
+  } else if( exp_op_info[exp->op].suppl.is_comb == AND_COMB ) {
+    exp->suppl.part.eval_10 |= (f00 | f10);
+    exp->suppl.part.eval_01 |= (f00 | f01);
+    exp->suppl.part.eval_11 |= f11;
+
+  } else if( exp_op_info[exp->op].suppl.is_comb == OR_COMB ) {
+    exp->suppl.part.eval_01 |= (f01 | f11);
+    exp->suppl.part.eval_10 |= (f10 | f11);
+    exp->suppl.part.eval_00 |= f00;
+
+  } else if( exp_op_info[exp->op].suppl.is_comb == OTHER_COMB ) {
+    exp->suppl.part.eval_00 |= f00;
+    exp->suppl.part.eval_01 |= f01;
+    exp->suppl.part.eval_10 |= f10;
+    exp->suppl.part.eval_11 |= f11;
+
+  }
+
+  PROFILE_END;
+
+}
+
 #ifndef RUNLIB
+/*!
+ \return Returns TRUE if the lower 32 bits of the given packed dumpfile value are all known; otherwise, returns FALSE.
+
+ Extracts the memory address that is stored in the lower 32 bits of a memory coverage value from a dumpfile.
+*/
+static bool expression_vcd_get_address(
+            const ulong* vall,   /*!< Lower value array of packed value */
+            const ulong* valh,   /*!< Upper value array of packed value */
+            unsigned int width,  /*!< Number of bits in packed value */
+  /*@out@*/ uint64*      addr    /*!< Memory address stored in the value */
+) { PROFILE(EXPRESSION_VCD_GET_ADDRESS);
+
+  bool         legal = TRUE;
+  unsigned int bits  = (width < 32) ? width : 32;
+  unsigned int i;
+
+  *addr = 0;
+
+  for( i=0; i<bits; i++ ) {
+    *addr |= (uint64)((vall[UL_DIV(i)] >> UL_MOD(i)) & 1) << i;
+    legal &= (((valh[UL_DIV(i)] >> UL_MOD(i)) & 1) == 0);
+  }
+
+  PROFILE_END;
+
+  return( legal );
+
+}
+
 /*!
  Assigns data from a dumpfile to the given expression's coverage bits according to the
- given action and the expression itself.
+ given action and the expression itself.  The data is given as the packed 4-state value
+ that the symbol table decoded from the dumpfile.
 */
 void expression_vcd_assign(
-  expression* expr,    /*!< Pointer to expression to assign */
-  char        action,  /*!< Specifies action to perform for an expression */
-  const char* value    /*!< Coverage data from dumpfile to assign */
+  expression*  expr,    /*!< Pointer to expression to assign */
+  char         action,  /*!< Specifies action to perform for an expression */
+  const ulong* vall,    /*!< Lower value array of packed coverage data from dumpfile to assign */
+  const ulong* valh,    /*!< Upper value array of packed coverage data from dumpfile to assign */
+  unsigned int width    /*!< Number of bits in packed coverage data */
 ) { PROFILE(EXPRESSION_VCD_ASSIGN);
 
+  uint32 bit0_1 = (uint32)(vall[0] & ~valh[0] & 1);     /* Set if bit 0 of the value is a 1 */
+  uint32 bit0_0 = (uint32)(~vall[0] & ~valh[0] & 1);    /* Set if bit 0 of the value is a 0 */
+
 #ifdef DEBUG_MODE
   if( debug_mode ) {
-    unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "Assigning expression (line: %u, op: %s, id: %d, action=%c) to value %s",
-                                expr->line, expression_string_op( expr->op ), expr->id, action, value );
+    unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "Assigning expression (line: %u, op: %s, id: %d, action=%c) to value 'h%lx (xz: 'h%lx, width: %u)",
+                                expr->line, expression_string_op( expr->op ), expr->id, action, vall[0], valh[0], width );
     assert( rv < USER_MSG_LENGTH );
     print_output( user_msg, DEBUG, __FILE__, __LINE__ );
   }
@@ -5865,24 +6096,26 @@ void expression_vcd_assign(
   if( action == 'L' ) {
 
     /* If we have seen a value of 1, increment the exec_num to indicate that the line has been hit */
-    if( value[0] == '1' ) {
+    if( bit0_1 ) {
       expr->exec_num++;
     }
 
   } else if( (action == 'e') || (action == 'E') ) {
-    expr->suppl.part.true |= (value[0] == '1');
+    expr->suppl.part.true |= bit0_1;
 
   } else if( (action == 'u') || (action == 'U') ) {
-    expr->suppl.part.true  |= (value[0] == '1');
-    expr->suppl.part.false |= (value[0] == '0');
+    expr->suppl.part.true  |= bit0_1;
+    expr->suppl.part.false |= bit0_0;
              
   } else if( (action == 'c') || (action == 'C') ) {
 
-    /* Since we need to sign-extend values, calculate the lt, lf, rt and rf values */
-    uint32 lt = (value[1] != '\0') ? (value[0] == '1') : 0;
-    uint32 lf = (value[1] != '\0') ? (value[0] == '0') : ((value[0] == '0') || (value[0] == '1'));
-    uint32 rt = (value[1] != '\0') ? (value[1] == '1') : (value[0] == '1');
-    uint32 rf = (value[1] != '\0') ? (value[1] == '0') : (value[0] == '0');
+    /* The left value is in bit 1 and the right value in bit 0 (the symbol table has already sign-extended the value) */
+    uint32 lt = (uint32)((vall[0] & ~valh[0]) >> 1) & 1;
+    uint32 lf = (uint32)((~vall[0] & ~valh[0]) >> 1) & 1;
+    uint32 rt = bit0_1;
+    uint32 rf = bit0_0;
+
+    assert( width >= 2 );
 
     if( exp_op_info[expr->op].suppl.is_comb == AND_COMB ) {
       expr->suppl.part.eval_10 |= rf;
@@ -5906,7 +6139,7 @@ void expression_vcd_assign(
 
     uint64 intval;
 
-    if( convert_str_to_uint64( value, 31, 0, &intval ) ) {
+    if( expression_vcd_get_address( vall, valh, width, &intval ) ) {
       vector_set_mem_rd_ulong( expr->sig->value, ((expr->value->width - 1) + intval), intval );
     }
 
@@ -5914,15 +6147,9 @@ void expression_vcd_assign(
 
     uint64 intval;
 
-    if( convert_str_to_uint64( value, 31, 0, &intval ) ) {
-      if( strlen( value ) > 32 ) {
-        char* tmpval = strdup_safe( value );
-        tmpval[strlen( value ) - 32] = '\0';
-        (void)vector_vcd_assign( expr->sig->value, tmpval, ((expr->value->width - 1) + intval), intval );
-        free_safe( tmpval, (strlen( value ) + 1) );
-      } else {
-        (void)vector_vcd_assign( expr->sig->value, "0", ((expr->value->width - 1) + intval), intval );
-      }
+    /* The written data is stored above the 32-bit address */
+    if( expression_vcd_get_address( vall, valh, width, &intval ) ) {
+      (void)vector_vcd_assign_packed( expr->sig->value, vall, valh, width, 32, ((expr->value->width - 1) + intval), intval );
     }
 
   }
@@ -97,12 +97,18 @@ void expression_assign_expr_ids( expression* root, func_unit* funit );
 /*! \brief Writes this expression to the specified database file. */
 void expression_db_write( expression* expr, FILE* file, bool parse_mode, bool ids_issued );
 
+/*! \brief Writes this expression to the specified binary database file. */
+void expression_db_write_bin( expression* expr, FILE* file, bool ids_issued );
+
 /*! \brief Writes the entire expression tree to the specified data file. */
 void expression_db_write_tree( expression* root, FILE* file );
 
 /*! \brief Reads current line of specified file and parses for expression information. */
 void expression_db_read( char** line, /*@null@*/func_unit* curr_mod, bool eval );
 
+/*! \brief Parses binary database record for expression information. */
+void expression_db_read_bin( char** line, /*@null@*/func_unit* curr_mod, bool eval );
+
 /*! \brief Reads and merges two expressions and stores result in base expression. */
 void expression_db_merge(
   expression* base,
@@ -110,6 +116,13 @@ void expression_db_merge(
   bool        same
 );
 
+/*! \brief Merges the expression information of a binary database record into the base expression. */
+void expression_db_merge_bin(
+  expression* base,
+  char**      line,
+  bool        same
+);
+
 /*! \brief Merges two expressions into the base expression. */
 void expression_merge(
   expression* base,
@@ -150,11 +163,19 @@ void expression_set_line_coverage(
   expression* exp
 );
 
+/*! \brief Sets combinational logic coverage for the given expression from a bitmap of seen values */
+void expression_set_comb_coverage(
+  expression* exp,
+  uint32      hits
+);
+
 /*! \brief Assigns a value to an expression's coverage data from a dumpfile */
 void expression_vcd_assign(
-  expression* expr,
-  char        action,
-  const char* value
+  expression*  expr,
+  char         action,
+  const ulong* vall,
+  const ulong* valh,
+  unsigned int width
 );
 
 /*! \brief Returns TRUE if specified expression is found to contain all static leaf expressions. */
@@ -399,18 +399,20 @@ void fsm_table_set(
 }
 
 /*!
- Assigns the given value to the FSM structure and evaluates it for coverage information.
+ Assigns the given packed value to the FSM structure and evaluates it for coverage information.  If the
+ FSM has distinct input and output states, the output state occupies the low-order bits of the value.
 */
 void fsm_vcd_assign(
-  fsm*  table,  /*!< Pointer to the FSM table to set */
-  char* value   /*!< String version of value to set to the FSM table */
+  fsm*         table,  /*!< Pointer to the FSM table to set */
+  const ulong* vall,   /*!< Lower value array of packed value to set to the FSM table */
+  const ulong* valh,   /*!< Upper value array of packed value to set to the FSM table */
+  unsigned int width   /*!< Number of bits in packed value */
 ) { PROFILE(FSM_VCD_ASSIGN);
 
-  /* Assign the string value to the given state vectors */
-  if( table->from_state->id == table->to_state->id ) {
-    (void)vector_vcd_assign( table->to_state->value, value, (table->to_state->value->width - 1), 0 );
-  } else {
-    (void)vector_vcd_assign2( table->to_state->value, table->from_state->value, value, ((table->from_state->value->width + table->to_state->value->width) - 1), 0 );
+  /* Assign the packed value to the given state vectors */
+  (void)vector_vcd_assign_packed( table->to_state->value, vall, valh, width, 0, (table->to_state->value->width - 1), 0 );
+  if( table->from_state->id != table->to_state->id ) {
+    (void)vector_vcd_assign_packed( table->from_state->value, vall, valh, width, table->to_state->value->width, (table->from_state->value->width - 1), 0 );
   }
 
   /* Add the states and state transition */
@@ -79,8 +79,10 @@ void fsm_table_set(
 
 /*! \brief Assigns the given value to the specified FSM and evaluates the FSM for coverage information. */
 void fsm_vcd_assign(
-  fsm*  table,
-  char* value
+  fsm*         table,
+  const ulong* vall,
+  const ulong* valh,
+  unsigned int width
 );
 
 /*! \brief Gathers statistics about the current FSM */
@@ -36,9 +36,9 @@
 
 
 extern char       user_msg[USER_MSG_LENGTH];
-extern symtable*  vcd_symtab;
 extern int        vcd_symtab_size;
 extern symtable** timestep_tab;
+extern int        fst_threads;
 
 
 /*! Specifies the last timestamp simulated */
@@ -50,6 +50,15 @@ static bool vcd_prevtime_valid = FALSE;
 /*! Specifies when we are handling dumping */
 static bool vcd_blackout;
 
+/*!
+ Array of symbol table entries indexed by FST handle (minus one), built after the dumpfile definitions
+ have been read.  Handles that are not used by the design have a NULL entry.
+*/
+static symtable** fst_handle_tab = NULL;
+
+/*! Number of entries allocated in the fst_handle_tab array */
+static fstHandle fst_handle_num = 0;
+
 
 /*!
  Handles the definitions portion of the dumpfile.
@@ -225,13 +234,14 @@ static void fst_reader_process_hier(
 
 /*!
  \throws anonymous db_do_timestep
+
+ Called by the FST reader for each time in the dumpfile, including the times at which only facilities
+ that are not used by the design change, so that the design is simulated up to every dumped time.
 */
-static void fst_callback(
-  void*                user_callback_data_pointer,
-  uint64_t             time,
-  fstHandle            facidx,
-  const unsigned char* value
-) { PROFILE(FST_CALLBACK);
+static void fst_time_callback(
+  void*    user_callback_data_pointer,
+  uint64_t time
+) { PROFILE(FST_TIME_CALLBACK);
 
   /* If this is a new timestamp, perform a simulation */
   if( (vcd_prevtime != time) || !vcd_prevtime_valid ) {
@@ -242,6 +252,22 @@ static void fst_callback(
     vcd_prevtime_valid = TRUE;
   }
 
+  PROFILE_END;
+
+}
+
+/*!
+ \throws anonymous db_do_timestep
+*/
+static void fst_callback(
+  void*                user_callback_data_pointer,
+  uint64_t             time,
+  fstHandle            facidx,
+  const unsigned char* value
+) { PROFILE(FST_CALLBACK);
+
+  fst_time_callback( user_callback_data_pointer, time );
+
   /* Handle dumpon/off information */
   if( !value[0] ) {
 
@@ -255,10 +281,17 @@ static void fst_callback(
       vcd_blackout = FALSE;
     }
 
-    if( !value[1] ) {
-      db_set_symbol_char( fstVcdID( facidx ), value[0] );
-    } else {
-      db_set_symbol_string( fstVcdID( facidx ), value );
+    if( (facidx <= fst_handle_num) && (fst_handle_tab[facidx - 1] != NULL) ) {
+
+      struct fstReaderContext* xc = (struct fstReaderContext*)user_callback_data_pointer;
+
+      /* Real values are formatted as strings; all other values are exactly as long as the signal */
+      if( xc->signal_typs[facidx - 1] == FST_VT_VCD_REAL ) {
+        symtable_set_value_entry( fst_handle_tab[facidx - 1], (const char*)value, strlen( (const char*)value ) );
+      } else {
+        symtable_set_value_entry( fst_handle_tab[facidx - 1], (const char*)value, xc->signal_lens[facidx - 1] );
+      }
+
     }
 
   }
@@ -267,6 +300,56 @@ static void fst_callback(
 
 }
 
+/*!
+ \return Returns the number of FST handles that are not used by the design.
+
+ Resolves each FST handle to the symbol table entry that its VCD symbol was assigned to so that
+ value changes can be stored without generating and looking up the symbol.  Only the handles that
+ resolve to an entry are enabled in the reader's facility process mask so that the value change
+ data of all other facilities is never decompressed.
+*/
+static fstHandle fst_create_handle_tab(
+  struct fstReaderContext* xc  /*!< Pointer to the FST reader context */
+) { PROFILE(FST_CREATE_HANDLE_TAB);
+
+  fstHandle i;
+  fstHandle skipped = 0;
+
+  fst_handle_num = xc->maxhandle;
+
+  fstReaderClrFacProcessMaskAll( xc );
+
+  if( fst_handle_num > 0 ) {
+    fst_handle_tab = (symtable**)malloc_safe_nolimit( sizeof( symtable* ) * fst_handle_num );
+    for( i=0; i<fst_handle_num; i++ ) {
+      /* The symbol table index of a handle's VCD symbol is the handle minus one */
+      if( (fst_handle_tab[i] = symtable_get_index( i )) != NULL ) {
+        fstReaderSetFacProcessMask( xc, (i + 1) );
+      } else {
+        skipped++;
+      }
+    }
+  }
+
+  PROFILE_END;
+
+  return( skipped );
+
+}
+
+/*!
+ Deallocates the FST handle array.
+*/
+static void fst_dealloc_handle_tab() { PROFILE(FST_DEALLOC_HANDLE_TAB);
+
+  free_safe( fst_handle_tab, (sizeof( symtable* ) * fst_handle_num) );
+  fst_handle_tab = NULL;
+  fst_handle_num = 0;
+
+  PROFILE_END;
+
+}
+
 /*!
  Main FST parsing function.  Reads in an FST-style dumpfile, tells Covered about signal information
  and simulation results.
@@ -276,12 +359,14 @@ void fst_parse(
 ) { PROFILE(FST_PARSE);
 
   struct fstReaderContext *xc;
+  fstHandle                skipped = 0;  /* Number of FST handles not used by the design */
+  unsigned int             rv;
 
   /* Open LXT file for opening and extract members */
   if( (xc = fstReaderOpen( fst_file )) != NULL ) {
 
     /* Create initial symbol table */
-    vcd_symtab = symtable_create();
+    symtable_create();
 
     Try {
 
@@ -295,12 +380,23 @@ void fst_parse(
       if( vcd_symtab_size > 0 ) {
         timestep_tab = malloc_safe_nolimit( sizeof( symtable*) * vcd_symtab_size );
       }
-        
-      /* Not sure what this does but it seems to be a requirement of the FST reader */
-      fstReaderSetFacProcessMaskAll( xc );
+
+      /* Map the FST handles to their symbol table entries */
+      skipped = fst_create_handle_tab( xc );
+
+      /* Decompress the value changes of each block with the requested number of threads */
+#ifndef FST_READER_THREADS
+      if( fst_threads > 1 ) {
+        print_output( "Multi-threaded FST decompression is not supported by this build of Covered; the FST file will be read by a single thread", WARNING, __FILE__, __LINE__ );
+      }
+#endif
+      fstReaderSetDecompressThreads( xc, fst_threads );
+
+      /* Unused facilities are masked off, so times are delivered separately from value changes */
+      fstReaderSetTimeChangeCallback( xc, fst_time_callback );
 
       /* Perform simulation */
-      fstReaderIterBlocks( xc, fst_callback, NULL, NULL );
+      fstReaderIterBlocks( xc, fst_callback, xc, NULL );
 
       /* Perform last simulation if necessary */
       if( vcd_prevtime_valid ) {
@@ -308,14 +404,20 @@ void fst_parse(
       }
 
     } Catch_anonymous {
-      symtable_dealloc( vcd_symtab );
+      fst_dealloc_handle_tab();
+      symtable_dealloc();
       free_safe( timestep_tab, (sizeof( symtable* ) * vcd_symtab_size) );
       fstReaderClose( xc );
       Throw 0;
     }
         
+    rv = snprintf( user_msg, USER_MSG_LENGTH, "  Skipped %u of %u dumped signals that are not used by the design", skipped, fst_handle_num );
+    assert( rv < USER_MSG_LENGTH );
+    print_output( user_msg, NORMAL, __FILE__, __LINE__ );
+
     /* Deallocate memory */
-    symtable_dealloc( vcd_symtab );
+    fst_dealloc_handle_tab();
+    symtable_dealloc();
     free_safe( timestep_tab, (sizeof( symtable* ) * vcd_symtab_size) );
 
     /* Close FST file */
@@ -23,6 +23,11 @@
 #include "fstapi.h"
 #include "fastlz.h"
 
+#if defined(HAVE_PTHREAD_H) && defined(HAVE_LIBPTHREAD)
+#include <pthread.h>
+#define FST_READER_THREADS
+#endif
+
 #undef  FST_DEBUG
 
 #define FST_BREAK_SIZE 			(32 * 1024 * 1024)
@@ -1740,6 +1745,9 @@ unsigned char *blackout_activity;
 
 uint64_t limit_range_start, limit_range_end;
 
+int decompress_threads;			/* threads used to decompress value change chains in fstReaderIterBlocks */
+void (*time_change_callback)(void *user_callback_data_pointer, uint64_t time);	/* called for each time in fstReaderIterBlocks */
+
 /* entries specific to read value at time functions */
 
 unsigned rvat_data_valid : 1;
@@ -2127,6 +2135,24 @@ if(xc)
 	}
 }
 
+void fstReaderSetDecompressThreads(void *ctx, int nthreads)
+{
+struct fstReaderContext *xc = (struct fstReaderContext *)ctx;
+if(xc)
+	{
+	xc->decompress_threads = nthreads;
+	}
+}
+
+void fstReaderSetTimeChangeCallback(void *ctx, void (*time_change_callback)(void *user_callback_data_pointer, uint64_t time))
+{
+struct fstReaderContext *xc = (struct fstReaderContext *)ctx;
+if(xc)
+	{
+	xc->time_change_callback = time_change_callback;
+	}
+}
+
 /*
  * hierarchy processing
  */
@@ -3003,6 +3029,190 @@ if(xc)
  * read processing
  */
 
+/* one value change chain of a block that needs to be inflated before the block is traversed */
+struct fstReaderDecompJob
+{
+fstHandle idx;
+unsigned char *mc;			/* compressed chain, NULL if the chain is stored uncompressed */
+unsigned long clen;
+unsigned char *mu;			/* destination in mem_for_traversal */
+unsigned long ulen;
+int rc;
+};
+
+
+static void fstReaderDecompressJob(struct fstReaderDecompJob *job, int packtype)
+{
+if(job->mc)
+	{
+	unsigned long destlen = job->ulen;
+
+	if(packtype == 'F')
+		{
+		job->rc = fastlz_decompress(job->mc, job->clen, job->mu, destlen);
+		}
+		else
+		{
+		job->rc = uncompress(job->mu, &destlen, job->mc, job->clen);
+		}
+	free(job->mc);
+	job->mc = NULL;
+	}
+}
+
+
+#ifdef FST_READER_THREADS
+
+#define FST_DECOMP_CHUNK		(16)
+
+/* workers that inflate the chains of the current block alongside the reading thread */
+struct fstReaderDecompPool
+{
+pthread_mutex_t mutex;
+pthread_cond_t work_cond;		/* signalled when a new block is ready or on shutdown */
+pthread_cond_t done_cond;		/* signalled when the last job of a block is finished */
+pthread_t *threads;
+int nthreads;
+
+struct fstReaderDecompJob *jobs;
+uint32_t num_jobs;
+uint32_t next_job;
+uint32_t jobs_done;
+int packtype;
+unsigned shutdown : 1;
+};
+
+
+/* grabs and inflates chunks of jobs until none are left; called with the mutex held and returns with it held */
+static void fstReaderDecompPoolWork(struct fstReaderDecompPool *pool)
+{
+while(pool->next_job < pool->num_jobs)
+	{
+	uint32_t first = pool->next_job;
+	uint32_t last = first + FST_DECOMP_CHUNK;
+	uint32_t j;
+
+	if(last > pool->num_jobs) last = pool->num_jobs;
+	pool->next_job = last;
+
+	pthread_mutex_unlock(&pool->mutex);
+	for(j=first;j<last;j++)
+		{
+		fstReaderDecompressJob(&pool->jobs[j], pool->packtype);
+		}
+	pthread_mutex_lock(&pool->mutex);
+
+	pool->jobs_done += (last - first);
+	if(pool->jobs_done == pool->num_jobs)
+		{
+		pthread_cond_signal(&pool->done_cond);
+		}
+	}
+}
+
+
+static void *fstReaderDecompPoolThread(void *arg)
+{
+struct fstReaderDecompPool *pool = (struct fstReaderDecompPool *)arg;
+
+pthread_mutex_lock(&pool->mutex);
+for(;;)
+	{
+	while(!pool->shutdown && (pool->next_job >= pool->num_jobs))
+		{
+		pthread_cond_wait(&pool->work_cond, &pool->mutex);
+		}
+	if(pool->shutdown) break;
+	fstReaderDecompPoolWork(pool);
+	}
+pthread_mutex_unlock(&pool->mutex);
+
+return(NULL);
+}
+
+
+/* returns NULL if no workers could be started, in which case chains are inflated serially */
+static struct fstReaderDecompPool *fstReaderDecompPoolCreate(int nthreads)
+{
+struct fstReaderDecompPool *pool = calloc(1, sizeof(struct fstReaderDecompPool));
+int i;
+
+pthread_mutex_init(&pool->mutex, NULL);
+pthread_cond_init(&pool->work_cond, NULL);
+pthread_cond_init(&pool->done_cond, NULL);
+pool->threads = calloc(nthreads, sizeof(pthread_t));
+
+for(i=0;i<nthreads;i++)
+	{
+	if(pthread_create(&pool->threads[pool->nthreads], NULL, fstReaderDecompPoolThread, pool) == 0)
+		{
+		pool->nthreads++;
+		}
+	}
+
+if(!pool->nthreads)
+	{
+	pthread_cond_destroy(&pool->done_cond);
+	pthread_cond_destroy(&pool->work_cond);
+	pthread_mutex_destroy(&pool->mutex);
+	free(pool->threads);
+	free(pool);
+	pool = NULL;
+	}
+
+return(pool);
+}
+
+
+static void fstReaderDecompPoolDestroy(struct fstReaderDecompPool *pool)
+{
+int i;
+
+pthread_mutex_lock(&pool->mutex);
+pool->shutdown = 1;
+pthread_cond_broadcast(&pool->work_cond);
+pthread_mutex_unlock(&pool->mutex);
+
+for(i=0;i<pool->nthreads;i++)
+	{
+	pthread_join(pool->threads[i], NULL);
+	}
+
+pthread_cond_destroy(&pool->done_cond);
+pthread_cond_destroy(&pool->work_cond);
+pthread_mutex_destroy(&pool->mutex);
+free(pool->threads);
+free(pool);
+}
+
+
+/* inflates all jobs of a block with the workers and the calling thread, returning when all are done */
+static void fstReaderDecompPoolRun(struct fstReaderDecompPool *pool, struct fstReaderDecompJob *jobs, uint32_t num_jobs, int packtype)
+{
+pthread_mutex_lock(&pool->mutex);
+pool->jobs = jobs;
+pool->num_jobs = num_jobs;
+pool->next_job = 0;
+pool->jobs_done = 0;
+pool->packtype = packtype;
+pthread_cond_broadcast(&pool->work_cond);
+
+fstReaderDecompPoolWork(pool);
+while(pool->jobs_done < pool->num_jobs)
+	{
+	pthread_cond_wait(&pool->done_cond, &pool->mutex);
+	}
+
+pool->jobs = NULL;
+pool->num_jobs = 0;
+pool->next_job = 0;
+pool->jobs_done = 0;
+pthread_mutex_unlock(&pool->mutex);
+}
+
+#endif
+
+
 /* normal read which re-interleaves the value change data */
 int fstReaderIterBlocks(void *ctx,
         void (*value_change_callback)(void *user_callback_data_pointer, uint64_t time, fstHandle facidx, const unsigned char *value),
@@ -3035,12 +3245,26 @@ uint32_t traversal_mem_offs;
 uint32_t *scatterptr, *headptr, *length_remaining;
 uint32_t cur_blackout = 0;
 int packtype;
+struct fstReaderDecompJob *jobs;
+uint32_t num_jobs, j;
+#ifdef FST_READER_THREADS
+struct fstReaderDecompPool *pool = NULL;
+#endif
 
 if(!xc) return(0);
 
 scatterptr = calloc(xc->maxhandle, sizeof(uint32_t));
 headptr = calloc(xc->maxhandle, sizeof(uint32_t));
 length_remaining = calloc(xc->maxhandle, sizeof(uint32_t));
+jobs = calloc(xc->maxhandle ? xc->maxhandle : 1, sizeof(struct fstReaderDecompJob));
+
+#ifdef FST_READER_THREADS
+/* the calling thread inflates chains too, so start one less worker than requested */
+if(xc->decompress_threads > 1)
+	{
+	pool = fstReaderDecompPoolCreate(xc->decompress_threads - 1);
+	}
+#endif
 
 for(;;)
 	{
@@ -3168,6 +3392,11 @@ for(;;)
 			unsigned char *mu = malloc(frame_uclen);
 			uint32_t sig_offs = 0;
 
+			if(xc->time_change_callback)
+				{
+				xc->time_change_callback(user_callback_data_pointer, beg_tim);
+				}
+
 			if(fv)
 				{
 				if(beg_tim) { fprintf(fv, "#%"PRIu64"\n", beg_tim); }
@@ -3400,6 +3629,7 @@ for(;;)
 #endif
 	/* check compressed VC data */
 	if(idx > xc->maxhandle) idx = xc->maxhandle;
+	num_jobs = 0;
 	for(i=0;i<idx;i++)
 		{
 		if(chain_table[i])
@@ -3409,31 +3639,22 @@ for(;;)
 
 	                if(xc->process_mask[process_idx]&(1<<process_bit))
 				{
-				int rc = Z_OK;
+				struct fstReaderDecompJob *job = &jobs[num_jobs++];
 				uint32_t val;
 				uint32_t skiplen;
-				uint32_t tdelta;
 	
 				fseeko(xc->f, vc_start + chain_table[i], SEEK_SET);
 				val = fstReaderVarint32WithSkip(xc->f, &skiplen);
+				job->idx = i;
+				job->mu = mem_for_traversal + traversal_mem_offs;
+				job->rc = Z_OK;
 				if(val)
 					{
-					unsigned char *mu = mem_for_traversal + traversal_mem_offs;
-					unsigned char *mc = malloc(chain_table_lengths[i]);
-					unsigned long destlen = val;
-					unsigned long sourcelen = chain_table_lengths[i];
-	
-					fstFread(mc, chain_table_lengths[i], 1, xc->f);
-					if(packtype == 'F')
-						{
-						rc = fastlz_decompress(mc, sourcelen, mu, destlen);
-						}
-						else
-						{
-						rc = uncompress(mu, &destlen, mc, sourcelen);
-						}
-					free(mc);
-					/* data to process is for(j=0;j<destlen;j++) in mu[j] */
+					/* read now, inflate below (possibly in parallel with other chains) */
+					job->clen = chain_table_lengths[i];
+					job->mc = malloc(job->clen);
+					job->ulen = val;
+					fstFread(job->mc, job->clen, 1, xc->f);
 					headptr[i] = traversal_mem_offs;
 					length_remaining[i] = val;
 					traversal_mem_offs += val;
@@ -3441,44 +3662,72 @@ for(;;)
 					else
 					{
 					int destlen = chain_table_lengths[i] - skiplen;
-					unsigned char *mu = mem_for_traversal + traversal_mem_offs;
-					fstFread(mu, destlen, 1, xc->f);
+					job->mc = NULL;
+					job->ulen = 0;
+					fstFread(job->mu, destlen, 1, xc->f);
 					/* data to process is for(j=0;j<destlen;j++) in mu[j] */
 					headptr[i] = traversal_mem_offs;
 					length_remaining[i] = destlen;
 					traversal_mem_offs += destlen;
 					}
-	
-				if(rc != Z_OK)
-					{
-					printf("\tclen: %d (rc=%d)\n", (int)val, rc);
-					exit(255);
-					}
-	
-				if(xc->signal_lens[i] == 1)
-					{
-					uint32_t vli = fstGetVarint32NoSkip(mem_for_traversal + headptr[i]);
-					uint32_t shcnt = 2 << (vli & 1);
-					tdelta = vli >> shcnt;
-					}
-					else
-					{
-					uint32_t vli = fstGetVarint32NoSkip(mem_for_traversal + headptr[i]);
-					tdelta = vli >> 1;
-					}
-	
-				scatterptr[i] = tc_head[tdelta];
-				tc_head[tdelta] = i+1;
 				}
 			}
 		}
 
+#ifdef FST_READER_THREADS
+	if(pool)
+		{
+		fstReaderDecompPoolRun(pool, jobs, num_jobs, packtype);
+		}
+		else
+#endif
+		{
+		for(j=0;j<num_jobs;j++)
+			{
+			fstReaderDecompressJob(&jobs[j], packtype);
+			}
+		}
+
+	/* data to process is for(j=0;j<destlen;j++) in mu[j] */
+	for(j=0;j<num_jobs;j++)
+		{
+		uint32_t tdelta;
+
+		i = jobs[j].idx;
+		if(jobs[j].rc != Z_OK)
+			{
+			printf("\tclen: %d (rc=%d)\n", (int)jobs[j].ulen, jobs[j].rc);
+			exit(255);
+			}
+
+		if(xc->signal_lens[i] == 1)
+			{
+			uint32_t vli = fstGetVarint32NoSkip(mem_for_traversal + headptr[i]);
+			uint32_t shcnt = 2 << (vli & 1);
+			tdelta = vli >> shcnt;
+			}
+			else
+			{
+			uint32_t vli = fstGetVarint32NoSkip(mem_for_traversal + headptr[i]);
+			tdelta = vli >> 1;
+			}
+
+		scatterptr[i] = tc_head[tdelta];
+		tc_head[tdelta] = i+1;
+		}
+
 	for(i=0;i<tsec_nitems;i++)
 		{
 		uint32_t tdelta;
 		int skiplen;
 		uint32_t vli;
 
+		/* times are delivered even if only facilities outside of the process mask change */
+		if(xc->time_change_callback)
+			{
+			xc->time_change_callback(user_callback_data_pointer, time_table[i]);
+			}
+
 		if(fv)
 			{
 			if(time_table[i] != previous_time)
@@ -3747,6 +3996,14 @@ for(;;)
 free(length_remaining);
 free(headptr);
 free(scatterptr);
+free(jobs);
+
+#ifdef FST_READER_THREADS
+if(pool)
+	{
+	fstReaderDecompPoolDestroy(pool);
+	}
+#endif
 
 if(chain_table)
 	{
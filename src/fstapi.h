@@ -205,6 +205,8 @@ void fstReaderSetFacProcessMaskAll(void *ctx);
 void fstReaderClrFacProcessMaskAll(void *ctx);
 
 void fstReaderIterBlocksSetNativeDoublesOnCallback(void *ctx, int enable);
+void fstReaderSetDecompressThreads(void *ctx, int nthreads);
+void fstReaderSetTimeChangeCallback(void *ctx, void (*time_change_callback)(void *user_callback_data_pointer, uint64_t time));
 
 int fstReaderIterBlocks(void *ctx,
         void (*value_change_callback)(void *user_callback_data_pointer, uint64_t time, fstHandle facidx, const unsigned char *value),
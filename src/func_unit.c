@@ -103,6 +103,7 @@ static void funit_init(
   funit->er_tail         = NULL;
   funit->parent          = NULL;
   funit->elem.thr        = NULL;
+  funit->thr_size        = 0;
 
   PROFILE_END;
 
@@ -543,10 +544,13 @@ void funit_db_write(
   char            modname[4096];  /* Name of module */
   char            tmp[4096];      /* Temporary string holder */
   str_link*       strl;           /* Pointer to string link */
+  bool            binary;         /* Set to TRUE if a binary CDD file is being written */
   unsigned int    i;
 
   if( funit->suppl.part.type != FUNIT_NO_SCORE ) {
 
+    binary = db_bin_is_active();
+
 #ifdef DEBUG_MODE
     assert( (funit->suppl.part.type == FUNIT_MODULE)    || (funit->suppl.part.type == FUNIT_NAMED_BLOCK) ||
             (funit->suppl.part.type == FUNIT_FUNCTION)  || (funit->suppl.part.type == FUNIT_TASK)        ||
@@ -586,6 +590,10 @@ void funit_db_write(
     }
 #endif /* RUNLIB */
   
+    /* Each functional unit instance starts a new section of a binary CDD file */
+    db_bin_add_section( file, CDD_SECTION_FUNIT );
+    db_bin_start_text( file );
+
     /*@-duplicatequals -formattype -formatcode@*/
     fprintf( file, "%d %x %s \"%s\" %d %s %u %u %" FMT64 "u %s\n",
       DB_TYPE_FUNIT,
@@ -611,9 +619,15 @@ void funit_db_write(
       fprintf( file, "%d %s\n", DB_TYPE_FUNIT_VERSION, funit->version );
     }
 
+    db_bin_end_text( file );
+
     /* Now print all expressions in functional unit */
     for( i=0; i<funit->exp_size; i++ ) {
-      expression_db_write( funit->exps[i], file, (inst != NULL), ids_issued );
+      if( binary ) {
+        expression_db_write_bin( funit->exps[i], file, ids_issued );
+      } else {
+        expression_db_write( funit->exps[i], file, (inst != NULL), ids_issued );
+      }
     }
 
 #ifndef RUNLIB
@@ -632,7 +646,11 @@ void funit_db_write(
     /* Now print all signals in functional unit */
     for( i=0; i<funit->sig_size; i++ ) {
       if( i < funit->sig_no_rm_index ) {
-        vsignal_db_write( funit->sigs[i], file );
+        if( binary ) {
+          vsignal_db_write_bin( funit->sigs[i], file );
+        } else {
+          vsignal_db_write( funit->sigs[i], file );
+        }
       }
     }
 
@@ -662,7 +680,11 @@ void funit_db_write(
     curr_stmt = funit->stmt_head;
     while( curr_stmt != NULL ) {
       if( curr_stmt->rm_stmt ) {
-        statement_db_write( curr_stmt->stmt, file, ids_issued );
+        if( binary ) {
+          statement_db_write_bin( curr_stmt->stmt, file, ids_issued );
+        } else {
+          statement_db_write( curr_stmt->stmt, file, ids_issued );
+        }
       }
       curr_stmt = curr_stmt->next;
     }
@@ -680,6 +702,8 @@ void funit_db_write(
 #endif /* VPI_ONLY */
 #endif /* RUNLIB */
 
+    db_bin_start_text( file );
+
     /* Now print all FSM structures in functional unit */
     for( i=0; i<funit->fsm_size; i++ ) {
       fsm_db_write( funit->fsms[i], file, ids_issued );
@@ -703,6 +727,8 @@ void funit_db_write(
     }
 #endif
 
+    db_bin_end_text( file );
+
   }
 
   PROFILE_END;
@@ -782,7 +808,7 @@ void funit_version_db_read(
 
 #ifndef RUNLIB
 /*!
- \throws anonymous fsm_db_merge Throw Throw expression_db_merge vsignal_db_merge
+ \throws anonymous fsm_db_merge Throw Throw expression_db_merge expression_db_merge_bin vsignal_db_merge vsignal_db_merge_bin db_read_record
 
  Parses specified line for functional unit information and performs a merge of the two 
  specified functional units, placing the resulting merge functional unit into the functional unit named base.
@@ -801,7 +827,7 @@ void funit_db_merge(
   unsigned int curr_line_size;    /* Number of bytes allocated for curr_line */
   char*        rest_line;         /* Pointer to rest of read line */
   int          type;              /* Specifies currently read CDD type */
-  int          chars_read;        /* Number of characters read from current CDD line */
+  bool         packed;            /* Set to TRUE if the read record is a binary record */
   unsigned int i;
 
   assert( base != NULL );
@@ -809,10 +835,9 @@ void funit_db_merge(
 
   /* Handle the functional unit version, if specified */
   if( base->version != NULL ) {
-    if( util_readline( file, &curr_line, &curr_line_size ) ) {
+    if( db_read_record( file, &curr_line, &curr_line_size, &type, &rest_line, &packed ) ) {
       Try {
-        if( sscanf( curr_line, "%d%n", &type, &chars_read ) == 1 ) {
-          rest_line = curr_line + chars_read;
+        if( rest_line != NULL ) {
           if( type == DB_TYPE_FUNIT_VERSION ) {
             while( *rest_line == ' ' ) rest_line++;
             if( strcmp( base->version, rest_line ) != 0 ) {
@@ -839,12 +864,15 @@ void funit_db_merge(
 
   /* Handle all functional unit expressions */
   for( i=0; i<base->exp_size; i++ ) {
-    if( util_readline( file, &curr_line, &curr_line_size ) ) {
+    if( db_read_record( file, &curr_line, &curr_line_size, &type, &rest_line, &packed ) ) {
       Try {
-        if( sscanf( curr_line, "%d%n", &type, &chars_read ) == 1 ) {
-          rest_line = curr_line + chars_read;
+        if( rest_line != NULL ) {
           if( type == DB_TYPE_EXPRESSION ) {
-            expression_db_merge( base->exps[i], &rest_line, same );
+            if( packed ) {
+              expression_db_merge_bin( base->exps[i], &rest_line, same );
+            } else {
+              expression_db_merge( base->exps[i], &rest_line, same );
+            }
           } else {
             print_output( "Databases being merged are incompatible.", FATAL, __FILE__, __LINE__ );
             Throw 0;
@@ -865,12 +893,15 @@ void funit_db_merge(
 
   /* Handle all functional unit signals */
   for( i=0; i<base->sig_size; i++ ) {
-    if( util_readline( file, &curr_line, &curr_line_size ) ) {
+    if( db_read_record( file, &curr_line, &curr_line_size, &type, &rest_line, &packed ) ) {
       Try {
-        if( sscanf( curr_line, "%d%n", &type, &chars_read ) == 1 ) {
-          rest_line = curr_line + chars_read;
+        if( rest_line != NULL ) {
           if( type == DB_TYPE_SIGNAL ) {
-            vsignal_db_merge( base->sigs[i], &rest_line, same );
+            if( packed ) {
+              vsignal_db_merge_bin( base->sigs[i], &rest_line, same );
+            } else {
+              vsignal_db_merge( base->sigs[i], &rest_line, same );
+            }
           } else {
             print_output( "Databases being merged are incompatible.", FATAL, __FILE__, __LINE__ );
             Throw 0;
@@ -892,10 +923,9 @@ void funit_db_merge(
   /* Since statements don't get merged, we will just read these lines in */
   curr_base_stmt = base->stmt_head;
   while( curr_base_stmt != NULL ) {
-    if( util_readline( file, &curr_line, &curr_line_size ) ) {
+    if( db_read_record( file, &curr_line, &curr_line_size, &type, &rest_line, &packed ) ) {
       Try {
-        if( sscanf( curr_line, "%d%n", &type, &chars_read ) == 1 ) {
-          rest_line = curr_line + chars_read;
+        if( rest_line != NULL ) {
           if( type != DB_TYPE_STATEMENT ) {
             print_output( "Databases being merged are incompatible.", FATAL, __FILE__, __LINE__ );
             Throw 0;
@@ -917,10 +947,9 @@ void funit_db_merge(
 
   /* Handle all functional unit FSMs */
   for( i=0; i<base->fsm_size; i++ ) {
-    if( util_readline( file, &curr_line, &curr_line_size ) ) {
+    if( db_read_record( file, &curr_line, &curr_line_size, &type, &rest_line, &packed ) ) {
       Try {
-        if( sscanf( curr_line, "%d%n", &type, &chars_read ) == 1 ) {
-          rest_line = curr_line + chars_read;
+        if( rest_line != NULL ) {
           if( type == DB_TYPE_FSM ) {
             fsm_db_merge( base->fsms[i], &rest_line );
           } else {
@@ -945,10 +974,9 @@ void funit_db_merge(
   if( base->suppl.part.type == FUNIT_MODULE ) {
     curr_base_race = base->race_head;
     while( curr_base_race != NULL ) {
-      if( util_readline( file, &curr_line, &curr_line_size ) ) {
+      if( db_read_record( file, &curr_line, &curr_line_size, &type, &rest_line, &packed ) ) {
         Try {
-          if( sscanf( curr_line, "%d%n", &type, &chars_read ) == 1 ) {
-            rest_line = curr_line + chars_read;
+          if( rest_line != NULL ) {
             if( type != DB_TYPE_RACE ) {
               print_output( "Databases being merged are incompatible.", FATAL, __FILE__, __LINE__ );
               Throw 0;
@@ -1241,6 +1269,8 @@ void funit_add_thread(
   assert( funit != NULL );
   assert( thr != NULL );
 
+  funit->thr_size++;
+
   /* Statement element should point to a thread */
   if( funit->suppl.part.etype == 0 ) {
 
@@ -1304,35 +1334,6 @@ void funit_add_thread(
 
 }
 
-/*!
- Adds all of the given functional unit threads to the active simulation queue.
-*/
-void funit_push_threads(
-  func_unit*       funit,  /*!< Pointer of functional unit to push threads from */
-  const statement* stmt,   /*!< Pointer to the statement to search for in functional unit threads */
-  const sim_time*  time    /*!< Pointer to current simulation time */
-) { PROFILE(FUNIT_PUSH_THREADS);
-
-  assert( funit != NULL );
-
-  if( funit->suppl.part.etype == 0 ) {
-    if( (funit->elem.thr != NULL) && (funit->elem.thr->suppl.part.state == THR_ST_WAITING) && (funit->elem.thr->curr == stmt) ) {
-      sim_thread_push( funit->elem.thr, time );
-    }
-  } else {
-    thr_link* curr = funit->elem.tlist->head;
-    while( (curr != NULL) && (curr->thr != NULL) ) {
-      if( (curr->thr != NULL) && (curr->thr->suppl.part.state == THR_ST_WAITING) && (curr->thr->curr == stmt) ) {
-        sim_thread_push( curr->thr, time );
-      }
-      curr = curr->next;
-    }
-  }
-
-  PROFILE_END;
-
-}
-
 /*!
  Searches the given functional unit thread element for the given thread.  When the thread is found,
  its corresponding thread link is moved to the end of the thread list, the next pointer is updated
@@ -1347,6 +1348,8 @@ void funit_delete_thread(
   assert( funit != NULL );
   assert( thr != NULL );
 
+  funit->thr_size--;
+
   /* If the statement element type is a thread pointer, simply clear the thread pointer */
   if( funit->suppl.part.etype == 0 ) {
     funit->elem.thr = NULL;
@@ -181,13 +181,6 @@ void funit_add_thread(
   thread*    thr
 );
 
-/*! \brief Pushes the threads associated with the given functional unit onto the active simulation queue */
-void funit_push_threads(
-  func_unit*       funit,
-  const statement* stmt,
-  const sim_time*  time
-);
-
 /*! \brief Removes given thread from the given functional unit's thread pointer/thread pointer list */
 void funit_delete_thread(
   func_unit* funit,
@@ -506,8 +506,8 @@ module
     module_item_list_opt K_endmodule
     {
       generator_pop_funit();
-      $$ = generator_build( 14, $1, $2, $3, $5, $6, strdup_safe( ";" ), "\n",
-                            generator_inst_id_reg( db_get_curr_funit() ), generator_tmp_regs(), $8, generator_fsm_covs(),
+      $$ = generator_build( 15, $1, $2, $3, $5, $6, strdup_safe( ";" ), "\n",
+                            generator_inst_id_reg( db_get_curr_funit() ), generator_tmp_regs(), $8, generator_fsm_covs(), generator_toggle_covs(),
                             generator_inst_id_overrides(), strdup_safe( "endmodule" ), "\n" );
     }
   | attribute_list_opt K_module IGNORE I_endmodule
@@ -1606,6 +1606,43 @@ char* generator_line_cov(
 
 }
 
+/*!
+ \return Returns a string containing the Verilator counter hook call for the given coverage signal if the signal
+         is not a net; otherwise, inserts the hook in an always block and returns NULL.
+
+ In Verilator mode, the value of each combinational logic coverage signal is passed to one of the inline hooks in
+ covered_verilator.h (which updates the counter array for the expression) every time the signal is assigned.
+*/
+static char* generator_verilator_comb_hook(
+  const char* hook,   /*!< Name of hook function to call */
+  expression* exp,    /*!< Pointer to expression being covered */
+  func_unit*  funit,  /*!< Pointer to functional unit containing the expression */
+  const char* sig,    /*!< Name of coverage signal to pass to the hook */
+  bool        net     /*!< Set to TRUE if the coverage signal is a net */
+) { PROFILE(GENERATOR_VERILATOR_COMB_HOOK);
+
+  char         str[4096];
+  unsigned int rv;
+  char*        cov_str = NULL;
+
+  if( net ) {
+    rv = snprintf( str, 4096, "always @(%s) $c( \"%s( \", COVERED_INST_ID%d, \", %d, \",%s, \" );\" );",
+                   sig, hook, funit->id, (expression_get_id( exp, TRUE ) - expression_get_id( funit->exps[0], TRUE )), sig );
+    assert( rv < 4096 );
+    generator_insert_reg( str, FALSE );
+  } else {
+    rv = snprintf( str, 4096, " $c( \"%s( \", COVERED_INST_ID%d, \", %d, \",%s, \" );\" );",
+                   hook, funit->id, (expression_get_id( exp, TRUE ) - expression_get_id( funit->exps[0], TRUE )), sig );
+    assert( rv < 4096 );
+    cov_str = generator_build( 2, strdup_safe( str ), "\n" );
+  }
+
+  PROFILE_END;
+
+  return( cov_str );
+
+}
+
 /*!
  \return Returns a string containing the event coverage information.
 
@@ -1736,6 +1773,11 @@ char* generator_event_comb_cov(
 
   }
 
+  /* Pass the coverage value to the counter array */
+  if( info_suppl.part.verilator ) {
+    cov_str = generator_build( 2, cov_str, generator_verilator_comb_hook( "covered_event", exp, funit, name, FALSE ) );
+  }
+
   PROFILE_END;
 
   return( cov_str );
@@ -1803,6 +1845,11 @@ static char* generator_unary_comb_cov(
     cov_str = generator_build( 2, strdup_safe( str ), "\n" );
   }
 
+  /* Pass the coverage value to the counter array */
+  if( info_suppl.part.verilator ) {
+    cov_str = generator_build( 2, cov_str, generator_verilator_comb_hook( "covered_unary", exp, funit, sig, net ) );
+  }
+
   PROFILE_END;
 
   return( cov_str );
@@ -1881,6 +1928,11 @@ static char* generator_comb_comb_cov(
     cov_str = generator_build( 2, strdup_safe( str ), "\n" );
   }
 
+  /* Pass the coverage value to the counter array */
+  if( info_suppl.part.verilator ) {
+    cov_str = generator_build( 2, cov_str, generator_verilator_comb_hook( "covered_comb", exp, funit, sig, net ) );
+  }
+
   PROFILE_END;
 
   return( cov_str );
@@ -3372,6 +3424,45 @@ char* generator_fsm_covs() { PROFILE(GENERATOR_FSM_COVS);
 
 }
 
+/*!
+ \return Returns a string containing the Verilator toggle hooks for the current module.
+
+ Inserts an always block for each toggle-scorable signal of the current module that passes the signal value to the
+ covered_toggle hook whenever it changes.  Only signals that fit in 64 bits and do not contain unpacked dimensions
+ are covered in this way.
+*/
+char* generator_toggle_covs() { PROFILE(GENERATOR_TOGGLE_COVS);
+
+  char* cov_str = NULL;
+
+  if( info_suppl.part.verilator && (info_suppl.part.scored_toggle == 1) && !handle_funit_as_assert && !generator_is_static_function_only( curr_funit ) ) {
+
+    unsigned int i;
+
+    for( i=0; i<curr_funit->sig_size; i++ ) {
+
+      vsignal* sig = curr_funit->sigs[i];
+
+      if( ((sig->suppl.part.type <= SSUPPL_TYPE_DECL_REG) || (sig->suppl.part.type == SSUPPL_TYPE_IMPLICIT)) &&
+          (sig->suppl.part.mba == 0) && (sig->udim_num == 0) && (sig->value->width > 0) && (sig->value->width <= 64) &&
+          (strchr( sig->name, '.' ) == NULL) ) {
+        char         str[4096];
+        unsigned int rv = snprintf( str, 4096, "always @(%s ) $c( \"covered_toggle( \", COVERED_INST_ID%d, \", %u, \", %s , \" );\" );",
+                                    sig->name, curr_funit->id, i, sig->name );
+        assert( rv < 4096 );
+        cov_str = generator_build( 3, cov_str, strdup_safe( str ), "\n" );
+      }
+
+    }
+
+  }
+
+  PROFILE_END;
+
+  return( cov_str );
+
+}
+
 /*!
  Replaces "event" types with "reg" types when performing combinational logic coverage.  This behavior
  is needed because events are impossible to discern coverage from when multiple events are used within a wait
@@ -203,6 +203,9 @@ char* generator_case_comb_cov(
 /*! \brief Inserts FSM coverage code into module */
 char* generator_fsm_covs();
 
+/*! \brief Inserts Verilator toggle coverage hooks into module */
+char* generator_toggle_covs();
+
 /*! \brief Changes event type to reg type if we are performing combinational logic coverage. */
 void generator_handle_event_type(
   unsigned int first_line,
@@ -1189,7 +1189,119 @@ profiler profiles[NUM_PROFILES] = {
   {"vsignal_from_string", NULL, 0, 0, 0, TRUE},
   {"vsignal_calc_width_for_expr", NULL, 0, 0, 0, TRUE},
   {"vsignal_calc_lsb_for_expr", NULL, 0, 0, 0, TRUE},
-  {"vsignal_dealloc", NULL, 0, 0, 0, TRUE}
+  {"vsignal_dealloc", NULL, 0, 0, 0, TRUE},
+  {"sim_delay_heap_push", NULL, 0, 0, 0, TRUE},
+  {"sim_delay_heap_pop", NULL, 0, 0, 0, TRUE},
+  {"sim_delay_queue_add", NULL, 0, 0, 0, TRUE},
+  {"sim_delay_wheel_find", NULL, 0, 0, 0, TRUE},
+  {"sim_delay_queue_pop", NULL, 0, 0, 0, TRUE},
+  {"sim_thread_wait", NULL, 0, 0, 0, TRUE},
+  {"sim_thread_unwait", NULL, 0, 0, 0, TRUE},
+  {"sim_push_waiting_threads", NULL, 0, 0, 0, TRUE},
+  {"sim_compile_expression_helper", NULL, 0, 0, 0, TRUE},
+  {"sim_compile_expression", NULL, 0, 0, 0, TRUE},
+  {"sim_expression_program", NULL, 0, 0, 0, TRUE},
+  {"statement_dealloc_program", NULL, 0, 0, 0, TRUE},
+  {"vector_alloc_ulong", NULL, 0, 0, 0, TRUE},
+  {"vector_get_words_ulong", NULL, 0, 0, 0, TRUE},
+  {"vector_mul_school_ulong", NULL, 0, 0, 0, TRUE},
+  {"vector_mul_karatsuba_ulong", NULL, 0, 0, 0, TRUE},
+  {"vector_mul_ulong", NULL, 0, 0, 0, TRUE},
+  {"vector_divmod_ulong", NULL, 0, 0, 0, TRUE},
+  {"vector_op_divmod_ulong", NULL, 0, 0, 0, TRUE},
+  {"vector_op_exponent", NULL, 0, 0, 0, TRUE},
+  {"vector_mullo_karatsuba_ulong", NULL, 0, 0, 0, TRUE},
+  {"vector_decode_4state_ulong", NULL, 0, 0, 0, TRUE},
+  {"symtable_set_value_slice", NULL, 0, 0, 0, TRUE},
+  {"db_set_symbol_slice", NULL, 0, 0, 0, TRUE},
+  {"vcd_win_open", NULL, 0, 0, 0, TRUE},
+  {"vcd_win_close", NULL, 0, 0, 0, TRUE},
+  {"vcd_win_fetch", NULL, 0, 0, 0, TRUE},
+  {"vcd_get_slice", NULL, 0, 0, 0, TRUE},
+  {"vcd_parse_sim_slices", NULL, 0, 0, 0, TRUE},
+  {"vcd_parse_sim_pipelined", NULL, 0, 0, 0, TRUE},
+  {"symtable_calc_index", NULL, 0, 0, 0, TRUE},
+  {"symtable_index_to_symbol", NULL, 0, 0, 0, TRUE},
+  {"symtable_hash_calc", NULL, 0, 0, 0, TRUE},
+  {"symtable_hash_find", NULL, 0, 0, 0, TRUE},
+  {"symtable_hash_add", NULL, 0, 0, 0, TRUE},
+  {"symtable_count_trie_nodes", NULL, 0, 0, 0, TRUE},
+  {"symtable_set_value_entry", NULL, 0, 0, 0, TRUE},
+  {"symtable_set_value_index", NULL, 0, 0, 0, TRUE},
+  {"symtable_dealloc_entry", NULL, 0, 0, 0, TRUE},
+  {"symtable_display_stats", NULL, 0, 0, 0, TRUE},
+  {"db_set_symbol_index", NULL, 0, 0, 0, TRUE},
+  {"symtable_get_index", NULL, 0, 0, 0, TRUE},
+  {"fst_create_handle_tab", NULL, 0, 0, 0, TRUE},
+  {"fst_dealloc_handle_tab", NULL, 0, 0, 0, TRUE},
+  {"vector_decode_vcd_value", NULL, 0, 0, 0, TRUE},
+  {"vector_get_packed_word", NULL, 0, 0, 0, TRUE},
+  {"vector_vcd_assign_packed", NULL, 0, 0, 0, TRUE},
+  {"expression_vcd_get_address", NULL, 0, 0, 0, TRUE},
+  {"symtable_queue_entry", NULL, 0, 0, 0, TRUE},
+  {"symtable_set_value_ulong", NULL, 0, 0, 0, TRUE},
+  {"symtable_set_value_real", NULL, 0, 0, 0, TRUE},
+  {"covered_store_vecval", NULL, 0, 0, 0, TRUE},
+  {"covered_dealloc_sigs", NULL, 0, 0, 0, TRUE},
+  {"covered_check_timestep", NULL, 0, 0, 0, TRUE},
+  {"covered_is_sig_saturated", NULL, 0, 0, 0, TRUE},
+  {"covered_is_expr_saturated", NULL, 0, 0, 0, TRUE},
+  {"covered_is_funit_saturated", NULL, 0, 0, 0, TRUE},
+  {"covered_is_vpi_sig_saturated", NULL, 0, 0, 0, TRUE},
+  {"covered_prune_sigs", NULL, 0, 0, 0, TRUE},
+  {"covered_queue_free", NULL, 0, 0, 0, TRUE},
+  {"covered_queue_wait_space", NULL, 0, 0, 0, TRUE},
+  {"covered_queue_commit", NULL, 0, 0, 0, TRUE},
+  {"covered_queue_reserve", NULL, 0, 0, 0, TRUE},
+  {"covered_queue_push", NULL, 0, 0, 0, TRUE},
+  {"covered_convert_vecval", NULL, 0, 0, 0, TRUE},
+  {"covered_store_real", NULL, 0, 0, 0, TRUE},
+  {"covered_mark_saturated_sigs", NULL, 0, 0, 0, TRUE},
+  {"covered_remove_saturated_cbs", NULL, 0, 0, 0, TRUE},
+  {"covered_worker", NULL, 0, 0, 0, TRUE},
+  {"covered_worker_start", NULL, 0, 0, 0, TRUE},
+  {"covered_worker_stop", NULL, 0, 0, 0, TRUE},
+  {"covered_do_timestep", NULL, 0, 0, 0, TRUE},
+  {"generator_verilator_comb_hook", NULL, 0, 0, 0, TRUE},
+  {"generator_toggle_covs", NULL, 0, 0, 0, TRUE},
+  {"expression_set_comb_coverage", NULL, 0, 0, 0, TRUE},
+  {"vector_set_toggles", NULL, 0, 0, 0, TRUE},
+  {"db_verilator_alloc_counters", NULL, 0, 0, 0, TRUE},
+  {"db_verilator_fold_counters", NULL, 0, 0, 0, TRUE},
+  {"db_verilator_shard_create", NULL, 0, 0, 0, TRUE},
+  {"db_verilator_fold_shards", NULL, 0, 0, 0, TRUE},
+  {"db_bin_is_active", NULL, 0, 0, 0, TRUE},
+  {"db_bin_add_section", NULL, 0, 0, 0, TRUE},
+  {"db_bin_start_text", NULL, 0, 0, 0, TRUE},
+  {"db_bin_end_text", NULL, 0, 0, 0, TRUE},
+  {"db_bin_put", NULL, 0, 0, 0, TRUE},
+  {"db_bin_put_str", NULL, 0, 0, 0, TRUE},
+  {"db_bin_start_record", NULL, 0, 0, 0, TRUE},
+  {"db_bin_end_record", NULL, 0, 0, 0, TRUE},
+  {"db_bin_get", NULL, 0, 0, 0, TRUE},
+  {"db_bin_get_str", NULL, 0, 0, 0, TRUE},
+  {"db_read_record", NULL, 0, 0, 0, TRUE},
+  {"vector_db_write_bin", NULL, 0, 0, 0, TRUE},
+  {"vector_db_read_bin", NULL, 0, 0, 0, TRUE},
+  {"vector_db_merge_bin", NULL, 0, 0, 0, TRUE},
+  {"expression_db_write_bin", NULL, 0, 0, 0, TRUE},
+  {"expression_db_read_bin", NULL, 0, 0, 0, TRUE},
+  {"expression_db_merge_bin", NULL, 0, 0, 0, TRUE},
+  {"vsignal_db_write_bin", NULL, 0, 0, 0, TRUE},
+  {"vsignal_db_read_bin", NULL, 0, 0, 0, TRUE},
+  {"vsignal_db_merge_bin", NULL, 0, 0, 0, TRUE},
+  {"statement_db_write_bin", NULL, 0, 0, 0, TRUE},
+  {"statement_db_read_bin", NULL, 0, 0, 0, TRUE},
+  {"command_convert", NULL, 0, 0, 0, TRUE},
+  {"util_scan_int", NULL, 0, 0, 0, TRUE},
+  {"util_scan_uint", NULL, 0, 0, 0, TRUE},
+  {"util_scan_ulong", NULL, 0, 0, 0, TRUE},
+  {"util_scan_token", NULL, 0, 0, 0, TRUE},
+  {"report_ready_instances", NULL, 0, 0, 0, TRUE},
+  {"tcl_func_ready_instances", NULL, 0, 0, 0, TRUE},
+  {"fst_time_callback", NULL, 0, 0, 0, TRUE},
+  {"lxt_time_callback", NULL, 0, 0, 0, TRUE},
+  {"sim_compile_statements", NULL, 0, 0, 0, TRUE}
 };
 #endif
 
@@ -24,7 +24,7 @@
 
 #include "defines.h"
 
-#define NUM_PROFILES 1173
+#define NUM_PROFILES 1285
 
 #ifdef DEBUG
 #define UNREGISTERED 0
@@ -1200,6 +1200,118 @@
 #define VSIGNAL_CALC_WIDTH_FOR_EXPR 1170
 #define VSIGNAL_CALC_LSB_FOR_EXPR 1171
 #define VSIGNAL_DEALLOC 1172
+#define SIM_DELAY_HEAP_PUSH 1173
+#define SIM_DELAY_HEAP_POP 1174
+#define SIM_DELAY_QUEUE_ADD 1175
+#define SIM_DELAY_WHEEL_FIND 1176
+#define SIM_DELAY_QUEUE_POP 1177
+#define SIM_THREAD_WAIT 1178
+#define SIM_THREAD_UNWAIT 1179
+#define SIM_PUSH_WAITING_THREADS 1180
+#define SIM_COMPILE_EXPRESSION_HELPER 1181
+#define SIM_COMPILE_EXPRESSION 1182
+#define SIM_EXPRESSION_PROGRAM 1183
+#define STATEMENT_DEALLOC_PROGRAM 1184
+#define VECTOR_ALLOC_ULONG 1185
+#define VECTOR_GET_WORDS_ULONG 1186
+#define VECTOR_MUL_SCHOOL_ULONG 1187
+#define VECTOR_MUL_KARATSUBA_ULONG 1188
+#define VECTOR_MUL_ULONG 1189
+#define VECTOR_DIVMOD_ULONG 1190
+#define VECTOR_OP_DIVMOD_ULONG 1191
+#define VECTOR_OP_EXPONENT 1192
+#define VECTOR_MULLO_KARATSUBA_ULONG 1193
+#define VECTOR_DECODE_4STATE_ULONG 1194
+#define SYMTABLE_SET_VALUE_SLICE 1195
+#define DB_SET_SYMBOL_SLICE 1196
+#define VCD_WIN_OPEN 1197
+#define VCD_WIN_CLOSE 1198
+#define VCD_WIN_FETCH 1199
+#define VCD_GET_SLICE 1200
+#define VCD_PARSE_SIM_SLICES 1201
+#define VCD_PARSE_SIM_PIPELINED 1202
+#define SYMTABLE_CALC_INDEX 1203
+#define SYMTABLE_INDEX_TO_SYMBOL 1204
+#define SYMTABLE_HASH_CALC 1205
+#define SYMTABLE_HASH_FIND 1206
+#define SYMTABLE_HASH_ADD 1207
+#define SYMTABLE_COUNT_TRIE_NODES 1208
+#define SYMTABLE_SET_VALUE_ENTRY 1209
+#define SYMTABLE_SET_VALUE_INDEX 1210
+#define SYMTABLE_DEALLOC_ENTRY 1211
+#define SYMTABLE_DISPLAY_STATS 1212
+#define DB_SET_SYMBOL_INDEX 1213
+#define SYMTABLE_GET_INDEX 1214
+#define FST_CREATE_HANDLE_TAB 1215
+#define FST_DEALLOC_HANDLE_TAB 1216
+#define VECTOR_DECODE_VCD_VALUE 1217
+#define VECTOR_GET_PACKED_WORD 1218
+#define VECTOR_VCD_ASSIGN_PACKED 1219
+#define EXPRESSION_VCD_GET_ADDRESS 1220
+#define SYMTABLE_QUEUE_ENTRY 1221
+#define SYMTABLE_SET_VALUE_ULONG 1222
+#define SYMTABLE_SET_VALUE_REAL 1223
+#define COVERED_STORE_VECVAL 1224
+#define COVERED_DEALLOC_SIGS 1225
+#define COVERED_CHECK_TIMESTEP 1226
+#define COVERED_IS_SIG_SATURATED 1227
+#define COVERED_IS_EXPR_SATURATED 1228
+#define COVERED_IS_FUNIT_SATURATED 1229
+#define COVERED_IS_VPI_SIG_SATURATED 1230
+#define COVERED_PRUNE_SIGS 1231
+#define COVERED_QUEUE_FREE 1232
+#define COVERED_QUEUE_WAIT_SPACE 1233
+#define COVERED_QUEUE_COMMIT 1234
+#define COVERED_QUEUE_RESERVE 1235
+#define COVERED_QUEUE_PUSH 1236
+#define COVERED_CONVERT_VECVAL 1237
+#define COVERED_STORE_REAL 1238
+#define COVERED_MARK_SATURATED_SIGS 1239
+#define COVERED_REMOVE_SATURATED_CBS 1240
+#define COVERED_WORKER 1241
+#define COVERED_WORKER_START 1242
+#define COVERED_WORKER_STOP 1243
+#define COVERED_DO_TIMESTEP 1244
+#define GENERATOR_VERILATOR_COMB_HOOK 1245
+#define GENERATOR_TOGGLE_COVS 1246
+#define EXPRESSION_SET_COMB_COVERAGE 1247
+#define VECTOR_SET_TOGGLES 1248
+#define DB_VERILATOR_ALLOC_COUNTERS 1249
+#define DB_VERILATOR_FOLD_COUNTERS 1250
+#define DB_VERILATOR_SHARD_CREATE 1251
+#define DB_VERILATOR_FOLD_SHARDS 1252
+#define DB_BIN_IS_ACTIVE 1253
+#define DB_BIN_ADD_SECTION 1254
+#define DB_BIN_START_TEXT 1255
+#define DB_BIN_END_TEXT 1256
+#define DB_BIN_PUT 1257
+#define DB_BIN_PUT_STR 1258
+#define DB_BIN_START_RECORD 1259
+#define DB_BIN_END_RECORD 1260
+#define DB_BIN_GET 1261
+#define DB_BIN_GET_STR 1262
+#define DB_READ_RECORD 1263
+#define VECTOR_DB_WRITE_BIN 1264
+#define VECTOR_DB_READ_BIN 1265
+#define VECTOR_DB_MERGE_BIN 1266
+#define EXPRESSION_DB_WRITE_BIN 1267
+#define EXPRESSION_DB_READ_BIN 1268
+#define EXPRESSION_DB_MERGE_BIN 1269
+#define VSIGNAL_DB_WRITE_BIN 1270
+#define VSIGNAL_DB_READ_BIN 1271
+#define VSIGNAL_DB_MERGE_BIN 1272
+#define STATEMENT_DB_WRITE_BIN 1273
+#define STATEMENT_DB_READ_BIN 1274
+#define COMMAND_CONVERT 1275
+#define UTIL_SCAN_INT 1276
+#define UTIL_SCAN_UINT 1277
+#define UTIL_SCAN_ULONG 1278
+#define UTIL_SCAN_TOKEN 1279
+#define REPORT_READY_INSTANCES 1280
+#define TCL_FUNC_READY_INSTANCES 1281
+#define FST_TIME_CALLBACK 1282
+#define LXT_TIME_CALLBACK 1283
+#define SIM_COMPILE_STATEMENTS 1284
 
 extern profiler profiles[NUM_PROFILES];
 #endif
@@ -1350,10 +1350,15 @@ void instance_db_write(
 
   } else {
 
+    db_bin_add_section( file, CDD_SECTION_INST_ONLY );
+    db_bin_start_text( file );
+
     /*@-formatcode@*/
     fprintf( file, "%d %s %hhu\n", DB_TYPE_INST_ONLY, scope, root->suppl.name_diff );
     /*@=formatcode@*/
 
+    db_bin_end_text( file );
+
   }
 
   if( !stop_recursive ) {
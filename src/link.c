@@ -82,9 +82,10 @@ str_link* str_link_add(
 }
 
 /*!
- Creates a new stmt_link element with the value specified for stmt.  Sets
- next pointer of element to head, sets the head element to point to the
- new element and (possibly) sets the tail value to the new element.
+ Creates a new stmt_link element with the value specified for stmt and inserts it into the list in
+ order of the statement's position in the preprocessed file.  Statements at the same position keep
+ the order in which they were added, so a statement list that is written to a CDD file and read back
+ in is rebuilt in the same order.
 */
 void stmt_link_add(
             statement*  stmt,     /*!< Pointer to statement to add to specified statement list */
@@ -115,7 +116,7 @@ void stmt_link_add(
     while( (curr != NULL) &&
            ((curr->stmt->exp->ppfline < stmt->exp->ppfline) ||
             ((curr->stmt->exp->ppfline == stmt->exp->ppfline) &&
-             (curr->stmt->exp->col.part.first < stmt->exp->col.part.first))) ) {
+             (curr->stmt->exp->col.part.first <= stmt->exp->col.part.first))) ) {
       last = curr;
       curr = curr->next;
     }
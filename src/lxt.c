@@ -33,7 +33,6 @@
 
 
 extern char       user_msg[USER_MSG_LENGTH];
-extern symtable*  vcd_symtab;
 extern int        vcd_symtab_size;
 extern symtable** timestep_tab;
 extern char**     curr_inst_scope;
@@ -52,22 +51,17 @@ static bool vcd_blackout;
 
 /*!
  \return Returns a unique string ID for the given value
+
+ The returned symbol decodes to the given value as a symbol table index, so value changes
+ can be stored into the symbol table by facility index directly.
 */
 static char* vcdid(
   int value  /*!< Unique ID for a specific signal */
 ) { PROFILE(VCDID);
 
   static char buf[16];
-  int         i;
-
-  for( i=0; i<15; i++ ) {
-    buf[i] = (char)((value % 94) + 33); /* for range 33..126 */
-    value  = value / 94;
-    if( !value ) {
-      buf[i+1] = 0;
-      break;
-    }
-  }
+
+  symtable_index_to_symbol( (unsigned int)value, buf );
 
   PROFILE_END;
 
@@ -77,15 +71,14 @@ static char* vcdid(
 
 /*!
  \throws anonymous db_do_timestep
+
+ Called by the LXT reader for each time in the dumpfile, including the times at which only facilities
+ that are not used by the design change, so that the design is simulated up to every dumped time.
 */
-static void vcd_callback(
+static void time_callback(
   struct lxt2_rd_trace** lt,
-  lxtint64_t*            pnt_time,
-  lxtint32_t*            pnt_facidx,
-  char**                 pnt_value
-) { PROFILE(VCD_CALLBACK);
-
-  struct lxt2_rd_geometry *g = lxt2_rd_get_fac_geometry( *lt, *pnt_facidx );
+  lxtint64_t*            pnt_time
+) { PROFILE(LXT_TIME_CALLBACK);
 
   /* If this is a new timestamp, perform a simulation */
   if( (vcd_prevtime != *pnt_time) || !vcd_prevtime_valid ) {
@@ -96,6 +89,24 @@ static void vcd_callback(
     vcd_prevtime_valid = TRUE;
   }
 
+  PROFILE_END;
+
+}
+
+/*!
+ \throws anonymous db_do_timestep
+*/
+static void vcd_callback(
+  struct lxt2_rd_trace** lt,
+  lxtint64_t*            pnt_time,
+  lxtint32_t*            pnt_facidx,
+  char**                 pnt_value
+) { PROFILE(VCD_CALLBACK);
+
+  struct lxt2_rd_geometry *g = lxt2_rd_get_fac_geometry( *lt, *pnt_facidx );
+
+  time_callback( lt, pnt_time );
+
   /* Handle dumpon/off information */
   if( !(*pnt_value)[0] ) {
     if( !vcd_blackout ) {
@@ -110,7 +121,7 @@ static void vcd_callback(
 
   if( g->flags & LXT2_RD_SYM_F_DOUBLE ) {
 
-    db_set_symbol_string( vcdid( *pnt_facidx ), *pnt_value );
+    db_set_symbol_index( *pnt_facidx, *pnt_value, strlen( *pnt_value ) );
 
   } else if( g->flags & LXT2_RD_SYM_F_STRING ) {
 
@@ -119,9 +130,9 @@ static void vcd_callback(
   } else {
 
     if( g->len==1 ) {
-      db_set_symbol_char( vcdid( *pnt_facidx ), (*pnt_value)[0] );
+      db_set_symbol_index( *pnt_facidx, *pnt_value, 1 );
     } else {                        
-      db_set_symbol_string( vcdid( *pnt_facidx ), *pnt_value );
+      db_set_symbol_index( *pnt_facidx, *pnt_value, strlen( *pnt_value ) );
     }
 
   }                               
@@ -147,17 +158,19 @@ void lxt_parse(
   lxtint32_t               newindx;
   char                     netname[4096];  /* Name of current signal */
   char                     tmpname[4096];
+  int                      dumped  = 0;    /* Number of facilities that are not aliases */
+  int                      skipped = 0;    /* Number of facilities not used by the design */
+  unsigned int             rv;
 
   /* Open LXT file for opening and extract members */
   if( (lt = lxt2_rd_init( lxt_file )) != NULL ) {
 
     numfacs = lxt2_rd_get_num_facs( lt );
 
-    (void)lxt2_rd_set_fac_process_mask_all( lt );
     (void)lxt2_rd_set_max_block_mem_usage( lt, 0 ); /* no need to cache blocks */
 
     /* Create initial symbol table */
-    vcd_symtab = symtable_create();
+    symtable_create();
 
     /* Allocate memory for instance scope */
     curr_inst_scope      = (char**)malloc_safe( sizeof( char* ) );
@@ -212,6 +225,25 @@ void lxt_parse(
         timestep_tab = malloc_safe_nolimit( sizeof( symtable*) * vcd_symtab_size );
       }
 
+      /*
+       Only process the facilities that were assigned to the design so that the value change data of
+       all other facilities is never decompressed (the symbol of a facility is its alias root's index).
+      */
+      (void)lxt2_rd_clr_fac_process_mask_all( lt );
+      for( i=0; i<numfacs; i++ ) {
+        if( lxt2_rd_get_alias_root( lt, i ) == (lxtint32_t)i ) {
+          dumped++;
+          if( symtable_get_index( i ) != NULL ) {
+            (void)lxt2_rd_set_fac_process_mask( lt, i );
+          } else {
+            skipped++;
+          }
+        }
+      }
+
+      /* Unused facilities are masked off, so times are delivered separately from value changes */
+      lxt2_rd_set_time_change_callback( lt, time_callback );
+
       /* Perform simulation */
       (void)lxt2_rd_iter_blocks( lt, vcd_callback, NULL );
 
@@ -226,19 +258,23 @@ void lxt_parse(
       free_safe( curr_inst_scope, sizeof( char* ) );
       curr_inst_scope      = NULL;
       curr_inst_scope_size = 0;
-      symtable_dealloc( vcd_symtab );
+      symtable_dealloc();
       free_safe( timestep_tab, (sizeof( symtable* ) * vcd_symtab_size) );
       lxt2_rd_close( lt );
       Throw 0;
     }
 
+    rv = snprintf( user_msg, USER_MSG_LENGTH, "  Skipped %d of %d dumped signals that are not used by the design", skipped, dumped );
+    assert( rv < USER_MSG_LENGTH );
+    print_output( user_msg, NORMAL, __FILE__, __LINE__ );
+
     /* Deallocate memory */
     assert( curr_inst_scope_size == 1 );
     free_safe( curr_inst_scope[0], 4096 );
     free_safe( curr_inst_scope, sizeof( char* ) );
     curr_inst_scope      = NULL;
     curr_inst_scope_size = 0;
-    symtable_dealloc( vcd_symtab );
+    symtable_dealloc();
     free_safe( timestep_tab, (sizeof( symtable* ) * vcd_symtab_size) );
 
     /* Close LXT file */
@@ -248,6 +248,10 @@ static void lxt2_rd_iter_radix(
 
   for( which_time=0; which_time<lt->num_time_table_entries; which_time++, msk <<= 1 ) {
 
+    if( lt->time_change_callback ) {
+      lt->time_change_callback( &lt, &lt->time_table[which_time] );
+    }
+
     while( (top_elem = lt->radix_sort[which_time]) ) {
 
       lxtint32_t   idx = top_elem - lt->next_radix;
@@ -1821,6 +1825,21 @@ _LXT2_RD_INLINE void* lxt2_rd_get_user_callback_data_pointer( struct lxt2_rd_tra
 
 }
 
+/*!
+ Sets the function that is called for each time in the time table of a granule, including the times at which
+ only facilities that are not in the process mask change.
+*/
+_LXT2_RD_INLINE void lxt2_rd_set_time_change_callback(
+  struct lxt2_rd_trace* lt,
+  void (*time_change_callback)( struct lxt2_rd_trace** lt, lxtint64_t* time )
+) {
+
+  if( lt ) {
+    lt->time_change_callback = time_change_callback;
+  }
+
+}
+
 /*!
  \return Returns the number of active blocks within the time range
 
@@ -211,6 +211,7 @@ void **radix_sort[LXT2_RD_GRANULE_SIZE+1];
 void **next_radix;
 
 void (*value_change_callback)(struct lxt2_rd_trace **lt, lxtint64_t *time, lxtint32_t *facidx, char **value);
+void (*time_change_callback)(struct lxt2_rd_trace **lt, lxtint64_t *time);
 void *user_callback_data_pointer;
 
 unsigned char fac_map_index_width;
@@ -281,6 +282,9 @@ int 				lxt2_rd_iter_blocks(struct lxt2_rd_trace *lt,
 				void (*value_change_callback)(struct lxt2_rd_trace **lt, lxtint64_t *time, lxtint32_t *facidx, char **value),
 				void *user_callback_data_pointer);
 _LXT2_RD_INLINE void *		lxt2_rd_get_user_callback_data_pointer(struct lxt2_rd_trace *lt);
+				/* called for each time in the blocks, even if only facilities outside of the process mask change */
+_LXT2_RD_INLINE void		lxt2_rd_set_time_change_callback(struct lxt2_rd_trace *lt,
+				void (*time_change_callback)(struct lxt2_rd_trace **lt, lxtint64_t *time));
 
 				/* time (un)/restricted read ops */
 unsigned int			lxt2_rd_limit_time_range(struct lxt2_rd_trace *lt, lxtint64_t strt_time, lxtint64_t end_time);
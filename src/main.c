@@ -33,6 +33,7 @@
 
 #include "devel_doc.h"
 #include "defines.h"
+#include "convert.h"
 #include "exclude.h"
 #include "merge.h"
 #include "obfuscate.h"
@@ -95,6 +96,7 @@ static void usage() {
   printf( "      report                  Generates human-readable coverage reports from database file.\n" );
   printf( "      rank                    Generates ranked list of CDD files to run for optimal coverage in a regression run.\n" );
   printf( "      exclude                 Excludes coverage points from a given CDD and saves the modified CDD for further commands.\n" );
+  printf( "      convert                 Converts a CDD file between the text and binary CDD formats.\n" );
   printf( "\n" );
   printf( "   For individual help information for each of the above commands, enter:\n" );
   printf( "      covered <command> -h\n" );
@@ -215,6 +217,11 @@ int main( int argc, const char** argv ) {
             command_exclude( argc, curr_arg, argv );
             cmd_found = TRUE;
 
+          } else if( strncmp( "convert", argv[curr_arg], 7 ) == 0 ) {
+
+            command_convert( argc, curr_arg, argv );
+            cmd_found = TRUE;
+
           } else {
 
             unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "Unknown command/global option \"%s\".  Please see \"covered -h\" for usage.", argv[curr_arg] );
@@ -230,7 +237,7 @@ int main( int argc, const char** argv ) {
 
         if( !cmd_found ) {
  
-          print_output( "Must specify a command (score, merge, report, rank, exclude, -v, or -h)", FATAL, __FILE__, __LINE__ );
+          print_output( "Must specify a command (score, merge, report, rank, exclude, convert, -v, or -h)", FATAL, __FILE__, __LINE__ );
           Throw 0;
 
         }
@@ -27,21 +27,34 @@
 #include <string.h>
 #endif
 #include <stdlib.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
 
 #include "binding.h"
 #include "db.h"
 #include "defines.h"
 #include "info.h"
+#include "link.h"
 #include "merge.h"
 #include "sim.h"
 #include "util.h"
 
 
+/*!
+ Exit status of a parallel merge worker process that stopped because of an exclusion reason conflict.
+*/
+#define MERGE_EXIT_CONFLICT  2
+
+
 extern db**         db_list;
+extern unsigned int db_size;
 extern unsigned int curr_db;
 extern int          merged_code;
 extern char         user_msg[USER_MSG_LENGTH];
 extern char*        cdd_message;
+extern uint64       num_timesteps;
+extern unsigned int inline_comb_depth;
 
 
 /*!
@@ -74,6 +87,21 @@ int merge_in_num  = 0;
 */
 int merge_er_value = MERGE_ER_NONE;
 
+/*!
+ Set to TRUE if the -z option was specified (write a compressed CDD file).
+*/
+static bool merge_compress = FALSE;
+
+/*!
+ Specifies the value of the -j option (number of processes used to merge the CDD files).
+*/
+static int merge_jobs = 1;
+
+/*!
+ Set to TRUE by exclude_resolve_reason when an exclusion reason conflict stops a parallel merge worker.
+*/
+bool merge_er_conflict = FALSE;
+
 
 /*!
  Outputs usage informaiton to standard output for merge command.
@@ -107,6 +135,11 @@ static void merge_usage() {
   printf( "      -ext <extension>        Used in conjunction with the -d option.  If no -ext options are specified\n" );
   printf( "                                on the command-line, the default value of '.cdd' is used.  Note that\n" );
   printf( "                                a period (.) should be specified.\n" );
+  printf( "      -j <number>             Number of processes used to merge the CDD files.  Each process merges a subset\n" );
+  printf( "                                of the CDD files and the partial results are then merged pairwise.  The merged\n" );
+  printf( "                                database is identical to the one created by a sequential merge.\n" );
+  printf( "      -z                      Writes the merged database as a block-compressed CDD file.  If this option is not\n" );
+  printf( "                                specified, the merged database is only compressed if the <existing_database> is.\n" );
   printf( "      -m <message>            Allows the user to specify information about this CDD file.  This information\n" );
   printf( "                                can be anything (messages with whitespace should be surrounded by double-quotation\n" );
   printf( "                                marks), but may include something about the simulation arguments to more easily\n" );
@@ -251,6 +284,22 @@ static bool merge_parse_args(
         Throw 0;
       }
 
+    } else if( strncmp( "-j", argv[i], 2 ) == 0 ) {
+
+      if( check_option_value( argc, argv, i ) ) {
+        i++;
+        merge_jobs = atoi( argv[i] );
+        if( merge_jobs <= 0 ) {
+          merge_jobs = 1;
+        }
+      } else {
+        Throw 0;
+      }
+
+    } else if( strncmp( "-z", argv[i], 2 ) == 0 ) {
+
+      merge_compress = TRUE;
+
     } else {
 
       /* The name of a file to merge */
@@ -343,6 +392,528 @@ void merge_check() { PROFILE(MERGE_CHECK);
 
 }
 
+/*!
+ \throws anonymous db_read
+
+ Reads the given CDD file into the current database, marking it as empty or as a leaf CDD file in the list of
+ merged CDD files.  If a manifest file is given, the status of the CDD file and the leading hierarchies and merged
+ CDD files that it added are recorded to it (see merge_replay).
+*/
+static void merge_read_cdd(
+  str_link* strl,                   /*!< Pointer to CDD file to read */
+  int*      curr_leading_hier_num,  /*!< Pointer to number of leading hierarchies read before this CDD file */
+  FILE*     manifest                /*!< Pointer to file to record the read information to (or NULL) */
+) {
+
+  str_link*    tail = merge_in_tail;
+  unsigned int rv;
+
+  rv = snprintf( user_msg, USER_MSG_LENGTH, "%s CDD file \"%s\"", ((strl == merge_in_head) ? "Reading" : "Merging"), strl->str );
+  assert( rv < USER_MSG_LENGTH );
+  print_output( user_msg, NORMAL, __FILE__, __LINE__ );
+
+  if( !db_read( strl->str, READ_MODE_MERGE_NO_MERGE ) ) {
+
+    /* The read in CDD was empty so mark it as such */
+    merge_in_head->suppl = 2;
+
+    if( manifest != NULL ) {
+      fprintf( manifest, "F 0\n" );
+    }
+
+  } else {
+
+    /* If we have not merged any CDD files from this CDD, this is a leaf CDD so mark it as such */
+    bool leaf = ((db_list[curr_db]->leading_hier_num - *curr_leading_hier_num) == 1);
+
+    if( leaf ) {
+      strl->suppl = 1;
+    }
+
+    if( manifest != NULL ) {
+      unsigned int i;
+      fprintf( manifest, "F %d\n", (leaf ? 1 : 2) );
+      for( i=*curr_leading_hier_num; i<db_list[curr_db]->leading_hier_num; i++ ) {
+        fprintf( manifest, "H %s\n", db_list[curr_db]->leading_hierarchies[i] );
+      }
+      for( tail=tail->next; tail!=NULL; tail=tail->next ) {
+        fprintf( manifest, "M %s\n", tail->str );
+      }
+    }
+
+    *curr_leading_hier_num = db_list[curr_db]->leading_hier_num;
+
+  }
+
+}
+
+/*!
+ \throws anonymous merge_read_cdd
+
+ Reads all of the CDD files in the list of CDD files to merge (up to the last one specified on the command-line)
+ into the current database.
+*/
+static void merge_read_cdds(
+  FILE* manifest  /*!< Pointer to file to record the read information to (or NULL) */
+) {
+
+  str_link* strl                  = merge_in_head;
+  int       curr_leading_hier_num = 0;
+  bool      stop_merging          = FALSE;
+
+  while( (strl != NULL) && !stop_merging ) {
+    merge_read_cdd( strl, &curr_leading_hier_num, manifest );
+    stop_merging = (strl == merge_in_cl_last);
+    strl         = strl->next;
+  }
+
+}
+
+/*!
+ Removes the list of merged CDD files and all but the first leading hierarchy from the current database so that a
+ partial CDD file is written without them.  A CDD file may be specified more than once on the command-line, which the
+ merged CDD file information of a CDD file cannot represent; these are restored from the manifests instead (see
+ merge_replay).
+*/
+static void merge_strip_merged_cdds() {
+
+  db* mdb = db_list[curr_db];
+  int i;
+
+  for( i=1; i<mdb->leading_hier_num; i++ ) {
+    free_safe( mdb->leading_hierarchies[i], (strlen( mdb->leading_hierarchies[i] ) + 1) );
+  }
+  mdb->leading_hierarchies  = (char**)realloc_safe( mdb->leading_hierarchies, (sizeof( char* ) * mdb->leading_hier_num), sizeof( char* ) );
+  mdb->leading_hier_num     = 1;
+  mdb->leading_hiers_differ = FALSE;
+
+  /* The partial CDD file itself is never written as a merged CDD file */
+  str_link_delete_list( merge_in_head );
+  merge_in_head = merge_in_tail = NULL;
+  (void)str_link_add( strdup_safe( merged_file ), &merge_in_head, &merge_in_tail );
+  merge_in_head->suppl = 1;
+  merge_in_num         = 1;
+  merge_in_cl_last     = merge_in_head;
+
+}
+
+/*!
+ Merges the given list of CDD files and writes the result to the given partial CDD file.  This is called in a worker
+ process of a parallel merge and never returns.  The process exits with EXIT_SUCCESS if the merge succeeded,
+ with MERGE_EXIT_CONFLICT if it was stopped by an exclusion reason conflict and with EXIT_FAILURE otherwise.
+*/
+static void merge_worker(
+  str_link*   head,   /*!< Pointer to head of list of CDD files to merge */
+  const char* ofile,  /*!< Name of partial CDD file to write */
+  const char* mfile   /*!< Name of manifest file to write (or NULL if one is not needed) */
+) {
+
+  int   status   = EXIT_SUCCESS;
+  FILE* manifest = NULL;
+
+  /* Replace the list of CDD files to merge with the given list */
+  str_link_delete_list( merge_in_head );
+  merge_in_head = merge_in_tail = head;
+  merge_in_num  = 1;
+  while( merge_in_tail->next != NULL ) {
+    merge_in_tail = merge_in_tail->next;
+    merge_in_num++;
+  }
+  merge_in_cl_last = merge_in_tail;
+  free_safe( merged_file, (strlen( merged_file ) + 1) );
+  merged_file = strdup_safe( ofile );
+
+  /* Only the first and last resolutions are unaffected by merging the partial results of subsets of the CDD files */
+  if( (merge_er_value != MERGE_ER_FIRST) && (merge_er_value != MERGE_ER_LAST) ) {
+    merge_er_value = MERGE_ER_ABORT;
+  }
+
+  Try {
+
+    if( (mfile != NULL) && ((manifest = fopen( mfile, "w" )) == NULL) ) {
+      unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "Could not open %s for writing", mfile );
+      assert( rv < USER_MSG_LENGTH );
+      print_output( user_msg, FATAL, __FILE__, __LINE__ );
+      Throw 0;
+    }
+
+    merge_read_cdds( manifest );
+
+    if( manifest != NULL ) {
+      /*@-formattype -formatcode@*/
+      fprintf( manifest, "I %" FMT64 "u %u\n", num_timesteps, inline_comb_depth );
+      /*@=formattype =formatcode@*/
+      if( db_size > 0 ) {
+        fprintf( manifest, "B %d %d\n", db_list[curr_db]->binary, db_list[curr_db]->compressed );
+      }
+    }
+
+    /* Partial results are written in the binary format as they are read back in (nothing is written if no CDD file was scored) */
+    if( db_size > 0 ) {
+      db_merge_instance_trees();
+      bind_perform( TRUE, 0 );
+      merge_strip_merged_cdds();
+      db_list[curr_db]->binary     = TRUE;
+      db_list[curr_db]->compressed = FALSE;
+      db_write( ofile, FALSE, TRUE );
+    }
+
+  } Catch_anonymous {
+    status = merge_er_conflict ? MERGE_EXIT_CONFLICT : EXIT_FAILURE;
+  }
+
+  if( (manifest != NULL) && (fclose( manifest ) != 0) ) {
+    status = EXIT_FAILURE;
+  }
+
+  exit( status );
+
+}
+
+/*!
+ \return Returns the process ID of the started worker process or -1 if it could not be started.
+
+ Starts a worker process that merges the given list of CDD files (see merge_worker).  The list is deallocated.
+*/
+static pid_t merge_spawn(
+  str_link*   head,   /*!< Pointer to head of list of CDD files to merge */
+  const char* ofile,  /*!< Name of partial CDD file to write */
+  const char* mfile   /*!< Name of manifest file to write (or NULL if one is not needed) */
+) {
+
+  pid_t pid;
+
+  /* Make sure that buffered output is not written by both processes */
+  (void)fflush( stdout );
+
+  if( (pid = fork()) == 0 ) {
+    merge_worker( head, ofile, mfile );
+  }
+
+  if( pid < 0 ) {
+    print_output( "Unable to start merge process", FATAL, __FILE__, __LINE__ );
+  }
+
+  str_link_delete_list( head );
+
+  return( pid );
+
+}
+
+/*!
+ \return Returns EXIT_SUCCESS if all of the given worker processes succeeded, MERGE_EXIT_CONFLICT if any of them
+         stopped because of an exclusion reason conflict and EXIT_FAILURE if any of them failed.
+
+ Waits for all of the given worker processes to finish.
+*/
+static int merge_wait(
+  const pid_t* pids,  /*!< Array of worker process IDs */
+  int          num    /*!< Number of elements in the pids array */
+) {
+
+  int retval = EXIT_SUCCESS;
+  int i;
+
+  for( i=0; i<num; i++ ) {
+    int status;
+    if( (pids[i] < 0) || (waitpid( pids[i], &status, 0 ) != pids[i]) || !WIFEXITED( status ) ||
+        ((WEXITSTATUS( status ) != EXIT_SUCCESS) && (WEXITSTATUS( status ) != MERGE_EXIT_CONFLICT)) ) {
+      retval = EXIT_FAILURE;
+    } else if( (WEXITSTATUS( status ) == MERGE_EXIT_CONFLICT) && (retval == EXIT_SUCCESS) ) {
+      retval = MERGE_EXIT_CONFLICT;
+    }
+  }
+
+  return( retval );
+
+}
+
+/*!
+ \throws anonymous Throw Throw
+
+ Replays the given manifest file of a worker process into the list of merged CDD files and the leading hierarchies
+ of the current database, giving them the same contents that reading the worker's CDD files would have.
+*/
+static void merge_replay(
+  const char* mfile,      /*!< Name of manifest file to replay */
+  str_link**  strl,       /*!< Pointer to the next command-line CDD file to replay (updated) */
+  bool*       format_set  /*!< Set to TRUE once the format of the merged CDD file has been set */
+) {
+
+  FILE* manifest;
+
+  if( (manifest = fopen( mfile, "r" )) != NULL ) {
+
+    char*        line      = NULL;
+    unsigned int line_size = 0;
+    db*          mdb       = db_list[curr_db];
+
+    Try {
+
+      while( util_readline( manifest, &line, &line_size ) ) {
+
+        char         tmp[4096];
+        int          value1;
+        int          value2;
+        uint64       timesteps;
+        unsigned int depth;
+
+        if( sscanf( line, "F %d", &value1 ) == 1 ) {
+
+          if( value1 == 0 ) {
+            merge_in_head->suppl = 2;
+            merge_in_num--;
+          } else if( value1 == 1 ) {
+            (*strl)->suppl = 1;
+          }
+          *strl = (*strl)->next;
+
+        } else if( sscanf( line, "H %4095s", tmp ) == 1 ) {
+
+          if( (mdb->leading_hier_num > 0) && (strcmp( mdb->leading_hierarchies[0], tmp ) != 0) ) {
+            mdb->leading_hiers_differ = TRUE;
+          }
+          mdb->leading_hierarchies = (char**)realloc_safe( mdb->leading_hierarchies, (sizeof( char* ) * mdb->leading_hier_num), (sizeof( char* ) * (mdb->leading_hier_num + 1)) );
+          mdb->leading_hierarchies[mdb->leading_hier_num] = strdup_safe( tmp );
+          mdb->leading_hier_num++;
+
+        } else if( sscanf( line, "M %4095s", tmp ) == 1 ) {
+
+          if( str_link_find( tmp, merge_in_head ) == NULL ) {
+            str_link* mstrl = str_link_add( strdup_safe( tmp ), &merge_in_head, &merge_in_tail );
+            mstrl->suppl = 1;
+            merge_in_num++;
+          } else if( merge_in_num > 0 ) {
+            char*        file = get_relative_path( tmp );
+            unsigned int rv   = snprintf( user_msg, USER_MSG_LENGTH, "File %s in CDD file has been specified on the command-line", file );
+            assert( rv < USER_MSG_LENGTH );
+            free_safe( file, (strlen( file ) + 1) );
+            print_output( user_msg, FATAL, __FILE__, __LINE__ );
+            Throw 0;
+          }
+
+        } else if( sscanf( line, "B %d %d", &value1, &value2 ) == 2 ) {
+
+          /* The format of the first CDD read is used when the merged CDD file is written */
+          if( !*format_set ) {
+            mdb->binary     = value1;
+            mdb->compressed = value2;
+            *format_set     = TRUE;
+          }
+
+        /*@-formattype -formatcode@*/
+        } else if( sscanf( line, "I %" FMT64 "u %u", &timesteps, &depth ) == 2 ) {
+        /*@=formattype =formatcode@*/
+
+          num_timesteps     = timesteps;
+          inline_comb_depth = depth;
+
+        }
+
+      }
+
+    } Catch_anonymous {
+      unsigned int rv;
+      free_safe( line, line_size );
+      rv = fclose( manifest );
+      assert( rv == 0 );
+      Throw 0;
+    }
+
+    if( fclose( manifest ) != 0 ) {
+      assert( 0 );
+    }
+
+  } else {
+
+    unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "Could not open %s for reading", mfile );
+    assert( rv < USER_MSG_LENGTH );
+    print_output( user_msg, FATAL, __FILE__, __LINE__ );
+    Throw 0;
+
+  }
+
+}
+
+/*!
+ \return Returns a newly allocated name for a temporary file of a parallel merge.
+*/
+static char* merge_temp_name(
+  int         index,  /*!< Unique index of the temporary file */
+  const char* suffix  /*!< Suffix to append to the name */
+) {
+
+  char         name[4096];
+  unsigned int rv = snprintf( name, 4096, "%s.%d.%d%s", merged_file, (int)getpid(), index, suffix );
+
+  assert( rv < 4096 );
+
+  return( strdup_safe( name ) );
+
+}
+
+/*!
+ \return Returns TRUE if the CDD files were merged; otherwise, returns FALSE if they need to be merged sequentially.
+
+ \throws anonymous Throw merge_replay db_read
+
+ Merges the CDD files using merge_jobs worker processes.  The list of CDD files is split into contiguous subsets that
+ are merged by the workers into partial CDD files, which are then merged pairwise (in order) until one is left.  As
+ every merge of coverage happens in a worker, the exclusion reason resolution used (see merge_worker) does not depend
+ on how the CDD files were split up.  The remaining partial CDD file is read into the current database and the
+ manifests written by the workers are replayed so that the list of merged CDD files and the leading hierarchies match
+ those of a sequential merge.  If an exclusion reason conflict is found that cannot be resolved in this order (see
+ merge_worker), FALSE is returned.
+*/
+static bool merge_parallel() {
+
+  int        num      = merge_in_num;
+  int        chunks   = (merge_jobs < num) ? merge_jobs : num;
+  char**     parts    = (char**)malloc_safe( sizeof( char* ) * chunks );
+  char**     lists    = (char**)malloc_safe( sizeof( char* ) * chunks );
+  char**     live     = (char**)malloc_safe( sizeof( char* ) * chunks );
+  char**     next     = (char**)malloc_safe( sizeof( char* ) * chunks );
+  pid_t*     pids     = (pid_t*)malloc_safe( sizeof( pid_t ) * chunks );
+  int        live_num = 0;
+  int        index    = chunks;
+  int        status;
+  int        i;
+  str_link*  strl     = merge_in_head;
+  bool       retval   = TRUE;
+
+  /* Merge contiguous subsets of the CDD files */
+  for( i=0; i<chunks; i++ ) {
+    str_link* head = NULL;
+    str_link* tail = NULL;
+    int       j;
+    for( j=((i * num) / chunks); j<(((i + 1) * num) / chunks); j++ ) {
+      (void)str_link_add( strdup_safe( strl->str ), &head, &tail );
+      strl = strl->next;
+    }
+    parts[i] = merge_temp_name( i, "" );
+    lists[i] = merge_temp_name( i, ".lst" );
+    pids[i]  = merge_spawn( head, parts[i], lists[i] );
+  }
+  status = merge_wait( pids, chunks );
+
+  /* Subsets that did not contain any scored CDD files do not have a partial CDD file */
+  for( i=0; i<chunks; i++ ) {
+    if( file_exists( parts[i] ) ) {
+      live[live_num++] = strdup_safe( parts[i] );
+    }
+  }
+
+  /* Merge the partial CDD files pairwise */
+  while( (status == EXIT_SUCCESS) && (live_num > 1) ) {
+    int pairs = live_num / 2;
+    for( i=0; i<pairs; i++ ) {
+      str_link* head = NULL;
+      str_link* tail = NULL;
+      (void)str_link_add( strdup_safe( live[2 * i] ), &head, &tail );
+      (void)str_link_add( strdup_safe( live[(2 * i) + 1] ), &head, &tail );
+      next[i] = merge_temp_name( index++, "" );
+      pids[i] = merge_spawn( head, next[i], NULL );
+    }
+    status = merge_wait( pids, pairs );
+    for( i=0; i<(2 * pairs); i++ ) {
+      (void)unlink( live[i] );
+      free_safe( live[i], (strlen( live[i] ) + 1) );
+    }
+    for( i=0; i<pairs; i++ ) {
+      live[i] = next[i];
+    }
+    if( (live_num % 2) == 1 ) {
+      live[pairs] = live[live_num - 1];
+    }
+    live_num = pairs + (live_num % 2);
+  }
+
+  Try {
+
+    if( status == EXIT_FAILURE ) {
+      Throw 0;
+    }
+
+    if( status == MERGE_EXIT_CONFLICT ) {
+
+      print_output( "Exclusion reason conflict found, merging CDD files sequentially...", NORMAL, __FILE__, __LINE__ );
+      retval = FALSE;
+
+    } else if( live_num == 0 ) {
+
+      /* None of the CDD files were scored, so let the sequential merge handle it */
+      retval = FALSE;
+
+    } else {
+
+      str_link* head       = merge_in_head;
+      str_link* tail       = merge_in_tail;
+      bool      format_set = FALSE;
+
+      /* Read the partial CDD file with an empty list of merged CDD files */
+      merge_in_head = merge_in_tail = NULL;
+      merge_in_num  = 0;
+      Try {
+        for( i=0; i<live_num; i++ ) {
+          (void)db_read( live[i], READ_MODE_MERGE_NO_MERGE );
+        }
+      } Catch_anonymous {
+        str_link_delete_list( merge_in_head );
+        merge_in_head = head;
+        merge_in_tail = tail;
+        Throw 0;
+      }
+      str_link_delete_list( merge_in_head );
+      merge_in_head = head;
+      merge_in_tail = tail;
+      merge_in_num  = num;
+
+      /* Replace the leading hierarchies of the partial CDD files with those of the merged CDD files */
+      for( i=0; i<db_list[curr_db]->leading_hier_num; i++ ) {
+        free_safe( db_list[curr_db]->leading_hierarchies[i], (strlen( db_list[curr_db]->leading_hierarchies[i] ) + 1) );
+      }
+      free_safe( db_list[curr_db]->leading_hierarchies, (sizeof( char* ) * db_list[curr_db]->leading_hier_num) );
+      db_list[curr_db]->leading_hierarchies  = NULL;
+      db_list[curr_db]->leading_hier_num     = 0;
+      db_list[curr_db]->leading_hiers_differ = FALSE;
+
+      strl = merge_in_head;
+      for( i=0; i<chunks; i++ ) {
+        merge_replay( lists[i], &strl, &format_set );
+      }
+
+    }
+
+  } Catch_anonymous {
+    retval = TRUE;
+    status = EXIT_FAILURE;
+  }
+
+  /* Remove the temporary files */
+  for( i=0; i<chunks; i++ ) {
+    (void)unlink( parts[i] );
+    (void)unlink( lists[i] );
+    free_safe( parts[i], (strlen( parts[i] ) + 1) );
+    free_safe( lists[i], (strlen( lists[i] ) + 1) );
+  }
+  for( i=0; i<live_num; i++ ) {
+    (void)unlink( live[i] );
+    free_safe( live[i], (strlen( live[i] ) + 1) );
+  }
+  free_safe( parts, (sizeof( char* ) * chunks) );
+  free_safe( lists, (sizeof( char* ) * chunks) );
+  free_safe( live, (sizeof( char* ) * chunks) );
+  free_safe( next, (sizeof( char* ) * chunks) );
+  free_safe( pids, (sizeof( pid_t ) * chunks) );
+
+  if( status == EXIT_FAILURE ) {
+    Throw 0;
+  }
+
+  return( retval );
+
+}
+
 /*!
  Performs merge command functionality.
 */
@@ -363,59 +934,15 @@ void command_merge(
 
   Try {
 
-    str_link* strl;
-    bool      stop_merging;
-    int       curr_leading_hier_num = 0;
-
     /* Parse score command-line */
     if( !merge_parse_args( argc, last_arg, argv ) ) {
 
       /* Check if merge could be executed */
       merge_check();
 
-      /* Read in base database */
-      rv = snprintf( user_msg, USER_MSG_LENGTH, "Reading CDD file \"%s\"", merge_in_head->str );
-      assert( rv < USER_MSG_LENGTH );
-      print_output( user_msg, NORMAL, __FILE__, __LINE__ );
-      if( !db_read( merge_in_head->str, READ_MODE_MERGE_NO_MERGE ) ) {
-
-        /* The read in CDD was empty so mark it as such */
-        merge_in_head->suppl = 2;
-
-      } else {
-
-        /* If the currently read CDD didn't contain any merged CDDs it is a leaf CDD so mark it as such */
-        if( (db_list[curr_db]->leading_hier_num - curr_leading_hier_num) == 1 ) {
-          merge_in_head->suppl = 1;
-        }
-        curr_leading_hier_num = db_list[curr_db]->leading_hier_num;
-
-      }
-
-      /* Read in databases to merge */
-      strl         = merge_in_head->next;
-      stop_merging = (strl == merge_in_head);
-      while( (strl != NULL) && !stop_merging ) {
-        rv = snprintf( user_msg, USER_MSG_LENGTH, "Merging CDD file \"%s\"", strl->str );
-        assert( rv < USER_MSG_LENGTH );
-        print_output( user_msg, NORMAL, __FILE__, __LINE__ );
-        if( !db_read( strl->str, READ_MODE_MERGE_NO_MERGE ) ) {
-
-          /* The read in CDD was empty so mark it as such */
-          merge_in_head->suppl = 2;
-
-        } else {
-
-          /* If we have not merged any CDD files from this CDD, this is a leaf CDD so mark it as such */
-          if( (db_list[curr_db]->leading_hier_num - curr_leading_hier_num) == 1 ) {
-            strl->suppl = 1;
-          }
-          curr_leading_hier_num = db_list[curr_db]->leading_hier_num;
-
-        }
-
-        stop_merging = (strl == merge_in_cl_last);
-        strl         = strl->next;
+      /* Read in the databases to merge (in parallel if requested) */
+      if( (merge_jobs < 2) || !merge_parallel() ) {
+        merge_read_cdds( NULL );
       }
 
       /* Perform the tree merges */
@@ -425,6 +952,9 @@ void command_merge(
       bind_perform( TRUE, 0 );
 
       /* Write out new database to output file */
+      if( merge_compress ) {
+        db_list[curr_db]->compressed = TRUE;
+      }
       db_write( merged_file, FALSE, TRUE );
 
       print_output( "\n***  Merging completed successfully!  ***", NORMAL, __FILE__, __LINE__ );
@@ -58,6 +58,9 @@ extern char*     top_module;
 extern char*     ppfilename;
 extern bool      debug_mode;
 extern char*     dumpvars_file;
+extern bool      flag_compress_cdd;
+extern db**      db_list;
+extern unsigned int curr_db;
 
 /*!
  \return Returns the number of characters read from this line.
@@ -210,6 +213,7 @@ void parse_design(
     db_assign_ids();
 
     /* Write contents to baseline database file. */
+    db_list[curr_db]->compressed = flag_compress_cdd;
     db_write( output_db, TRUE, TRUE );
 
     /* Generate the needed Verilog if specified */
@@ -314,7 +318,10 @@ void parse_and_score_dumpfile(
     /* Indicate that this CDD contains scored information */
     info_set_scored();
 
-    /* Write contents to database file */
+    /* Write contents to database file (a compressed CDD file stays compressed) */
+    if( flag_compress_cdd ) {
+      db_list[curr_db]->compressed = TRUE;
+    }
     db_write( db, FALSE, FALSE );
 
   } Catch_anonymous {
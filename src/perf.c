@@ -30,6 +30,14 @@
 
 extern db**         db_list;
 extern unsigned int curr_db;
+extern uint64       sim_stmt_wakeups;
+extern uint64       sim_thread_wakeups;
+extern uint64       sim_wakeups_avoided;
+extern uint64       vector_ul_allocs;
+extern uint64       vector_ul_bytes;
+extern uint64       vector_ul_inline;
+extern uint64       vector_ul_word_allocs;
+extern uint64       vector_ul_word_bytes;
 
 
 /*!
@@ -137,6 +145,13 @@ void perf_output_inst_report(
 
   fprintf( ofile, "\nSIMULATION PERFORMANCE STATISTICS:\n\n" );
 
+  /*@-duplicatequals -formattype -formatcode@*/
+  fprintf( ofile, "  Statement wakeups: %" FMT64 "u, threads woken: %" FMT64 "u, thread checks avoided: %" FMT64 "u\n",
+           sim_stmt_wakeups, sim_thread_wakeups, sim_wakeups_avoided );
+  fprintf( ofile, "  Vector value storage: %" FMT64 "u allocations, %" FMT64 "u bytes, %" FMT64 "u inline (per-word layout: %" FMT64 "u allocations, %" FMT64 "u bytes)\n\n",
+           vector_ul_allocs, vector_ul_bytes, vector_ul_inline, vector_ul_word_allocs, vector_ul_word_bytes );
+  /*@=duplicatequals =formattype =formatcode@*/
+
   instl = db_list[curr_db]->inst_head;
   while( instl != NULL ) {
     perf_output_inst_report_helper( ofile, instl->inst );
@@ -101,10 +101,11 @@ static void reentrant_store_data_bits(
           {
             unsigned int i;
             for( i=0; i<sig->value->width; i++ ) {
-              ulong* entry = sig->value->value.ul[UL_DIV(i)];
-              ren->data[curr_bit>>3] |= (((entry[VTYPE_INDEX_VAL_VALL] >> UL_MOD(i)) & 0x1) << (curr_bit & 0x7));
+              ulong* vall = &(VEC_PLANE( sig->value, VTYPE_INDEX_VAL_VALL )[UL_DIV(i)]);
+              ulong* valh = &(VEC_PLANE( sig->value, VTYPE_INDEX_VAL_VALH )[UL_DIV(i)]);
+              ren->data[curr_bit>>3] |= (((*vall >> UL_MOD(i)) & 0x1) << (curr_bit & 0x7));
               curr_bit++;
-              ren->data[curr_bit>>3] |= (((entry[VTYPE_INDEX_VAL_VALH] >> UL_MOD(i)) & 0x1) << (curr_bit & 0x7));
+              ren->data[curr_bit>>3] |= (((*valh >> UL_MOD(i)) & 0x1) << (curr_bit & 0x7));
               curr_bit++;
             }
             ren->data[curr_bit>>3] |= sig->value->suppl.part.set << (curr_bit & 0x7);
@@ -148,10 +149,11 @@ static void reentrant_store_data_bits(
           case VDATA_UL :
             {
               for( j=0; j<exp->value->width; j++ ) {
-                ulong* entry = exp->value->value.ul[UL_DIV(j)];
-                ren->data[curr_bit>>3] |= (((entry[VTYPE_INDEX_VAL_VALL] >> UL_MOD(j)) & 0x1) << (curr_bit & 0x7));
+                ulong* vall = &(VEC_PLANE( exp->value, VTYPE_INDEX_VAL_VALL )[UL_DIV(j)]);
+                ulong* valh = &(VEC_PLANE( exp->value, VTYPE_INDEX_VAL_VALH )[UL_DIV(j)]);
+                ren->data[curr_bit>>3] |= (((*vall >> UL_MOD(j)) & 0x1) << (curr_bit & 0x7));
                 curr_bit++;
-                ren->data[curr_bit>>3] |= (((entry[VTYPE_INDEX_VAL_VALH] >> UL_MOD(j)) & 0x1) << (curr_bit & 0x7));
+                ren->data[curr_bit>>3] |= (((*valh >> UL_MOD(j)) & 0x1) << (curr_bit & 0x7));
                 curr_bit++;
               }
             }
@@ -230,14 +232,15 @@ static void reentrant_restore_data_bits(
         case VDATA_UL :
           {
             for( i=0; i<sig->value->width; i++ ) {
-              ulong* entry = sig->value->value.ul[UL_DIV(i)];
+              ulong* vall = &(VEC_PLANE( sig->value, VTYPE_INDEX_VAL_VALL )[UL_DIV(i)]);
+              ulong* valh = &(VEC_PLANE( sig->value, VTYPE_INDEX_VAL_VALH )[UL_DIV(i)]);
               if( UL_MOD(i) == 0 ) {
-                entry[VTYPE_INDEX_VAL_VALL] = 0;
-                entry[VTYPE_INDEX_VAL_VALH] = 0;
+                *vall = 0;
+                *valh = 0;
               }
-              entry[VTYPE_INDEX_VAL_VALL] |= (ulong)((ren->data[curr_bit>>3] >> (curr_bit & 0x7)) & 0x1) << UL_MOD(i);
+              *vall |= (ulong)((ren->data[curr_bit>>3] >> (curr_bit & 0x7)) & 0x1) << UL_MOD(i);
               curr_bit++;
-              entry[VTYPE_INDEX_VAL_VALH] |= (ulong)((ren->data[curr_bit>>3] >> (curr_bit & 0x7)) & 0x1) << UL_MOD(i);
+              *valh |= (ulong)((ren->data[curr_bit>>3] >> (curr_bit & 0x7)) & 0x1) << UL_MOD(i);
               curr_bit++;
             }
             sig->value->suppl.part.set = (ren->data[curr_bit>>3] >> (curr_bit & 0x7)) & 0x1;
@@ -279,14 +282,15 @@ static void reentrant_restore_data_bits(
             case VDATA_UL :
               {
                 for( i=0; i<exp->value->width; i++ ) {
-                  ulong* entry = exp->value->value.ul[UL_DIV(i)];
+                  ulong* vall = &(VEC_PLANE( exp->value, VTYPE_INDEX_VAL_VALL )[UL_DIV(i)]);
+                  ulong* valh = &(VEC_PLANE( exp->value, VTYPE_INDEX_VAL_VALH )[UL_DIV(i)]);
                   if( UL_MOD(i) == 0 ) {
-                    entry[VTYPE_INDEX_VAL_VALL] = 0;
-                    entry[VTYPE_INDEX_VAL_VALH] = 0;
+                    *vall = 0;
+                    *valh = 0;
                   }
-                  entry[VTYPE_INDEX_VAL_VALL] |= (ulong)((ren->data[curr_bit>>3] >> (curr_bit & 0x7)) & 0x1) << UL_MOD(i);
+                  *vall |= (ulong)((ren->data[curr_bit>>3] >> (curr_bit & 0x7)) & 0x1) << UL_MOD(i);
                   curr_bit++;
-                  entry[VTYPE_INDEX_VAL_VALH] |= (ulong)((ren->data[curr_bit>>3] >> (curr_bit & 0x7)) & 0x1) << UL_MOD(i);
+                  *valh |= (ulong)((ren->data[curr_bit>>3] >> (curr_bit & 0x7)) & 0x1) << UL_MOD(i);
                   curr_bit++;
                 }
               }
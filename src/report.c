@@ -43,6 +43,7 @@
 #include "info.h"
 #include "instance.h"
 #include "line.h"
+#include "link.h"
 #include "memory.h"
 #include "ovl.h"
 #include "race.h"
@@ -187,6 +188,18 @@ bool flag_suppress_empty_funits = FALSE;
 */
 bool flag_output_exclusion_ids = FALSE;
 
+/*!
+ Head of the list of CDD files that have been read into the functional unit database but whose instance
+ database has not been loaded yet (see report_ready_instances).
+*/
+static str_link* report_inst_pend_head = NULL;
+
+/*!
+ Tail of the list of CDD files that have been read into the functional unit database but whose instance
+ database has not been loaded yet (see report_ready_instances).
+*/
+static str_link* report_inst_pend_tail = NULL;
+
 #ifdef HAVE_TCLTK
 /*!
  TCL interpreter for this application.
@@ -891,12 +904,12 @@ static void report_generate(
 }
 
 /*!
- \return Returns TRUE if CDD file was read properly; otherwise, returns FALSE.
-
  \throws anonymous db_read Throw bind_perform
 
  Reads in specified CDD file and gathers functional unit statistics to get ready for GUI
- interaction with this CDD file. 
+ interaction with this CDD file.  Only the functional unit database (which is all that the
+ GUI needs to display a CDD file in its default module-based view) is loaded here; the
+ instance database is loaded on demand by report_ready_instances.
 */
 void report_read_cdd_and_ready(
   const char* ifile  /*!< Name of CDD file to read from */
@@ -910,22 +923,12 @@ void report_read_cdd_and_ready(
 
   } else {
 
-    inst_link* instl;
-    bool       first = (db_size == 0);
-
-    /* Read in database, performing instance merging */
-    curr_db = 0;
-    (void)db_read( ifile, (first ? READ_MODE_REPORT_NO_MERGE : READ_MODE_MERGE_INST_MERGE) );
-    bind_perform( TRUE, 0 );
-
-    /* Gather instance statistics */
-    instl = db_list[0]->inst_head;
-    while( instl != NULL ) {
-      report_gather_instance_stats( instl->inst );
-      instl = instl->next;
+    /* Reserve the instance database slot if this is the first CDD file read */
+    if( db_size == 0 ) {
+      (void)db_create();
     }
 
-    /* Read in database again, performing module merging */
+    /* Read in database, performing module merging */
     curr_db = 1;
     (void)db_read( ifile, READ_MODE_REPORT_MOD_MERGE );
     bind_perform( TRUE, 0 );
@@ -936,6 +939,56 @@ void report_read_cdd_and_ready(
     /* Set the current database back to 0 */
     curr_db = 0;
 
+    /* Remember to load this CDD file into the instance database when it is needed */
+    (void)str_link_add( strdup_safe( ifile ), &report_inst_pend_head, &report_inst_pend_tail );
+
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ \throws anonymous db_read bind_perform
+
+ Loads all CDD files that have been read by report_read_cdd_and_ready (but not yet loaded into the
+ instance database) into the instance database, performing instance merging, and gathers the
+ instance statistics.  This function does nothing if the instance database is already up-to-date.
+*/
+void report_ready_instances() { PROFILE(REPORT_READY_INSTANCES);
+
+  while( report_inst_pend_head != NULL ) {
+
+    str_link*  strl = report_inst_pend_head;
+    inst_link* instl;
+
+    report_inst_pend_head = strl->next;
+    if( report_inst_pend_head == NULL ) {
+      report_inst_pend_tail = NULL;
+    }
+    strl->next = NULL;
+
+    Try {
+
+      /* Read in database, performing instance merging */
+      curr_db = 0;
+      (void)db_read( strl->str, ((db_list[0]->inst_head == NULL) ? READ_MODE_REPORT_NO_MERGE : READ_MODE_MERGE_INST_MERGE) );
+      bind_perform( TRUE, 0 );
+
+    } Catch_anonymous {
+      str_link_delete_list( strl );
+      Throw 0;
+    }
+
+    str_link_delete_list( strl );
+
+    /* Gather instance statistics */
+    instl = db_list[0]->inst_head;
+    while( instl != NULL ) {
+      report_gather_instance_stats( instl->inst );
+      instl = instl->next;
+    }
+
   }
 
   PROFILE_END;
@@ -951,6 +1004,11 @@ void report_close_cdd() { PROFILE(REPORT_CLOSE_CDD);
 
   db_close();
 
+  /* Forget any CDD files that have not been loaded into the instance database */
+  str_link_delete_list( report_inst_pend_head );
+  report_inst_pend_head = NULL;
+  report_inst_pend_tail = NULL;
+
   PROFILE_END;
 
 }
@@ -53,6 +53,9 @@ void report_read_cdd_and_ready(
   const char* ifile
 );
 
+/*! \brief Loads the instance database of all CDD files read by report_read_cdd_and_ready */
+void report_ready_instances();
+
 /*! \brief Closes the currently loaded CDD */
 void report_close_cdd();
 
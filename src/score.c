@@ -46,6 +46,7 @@
 #include "perf.h"
 #include "score.h"
 #include "search.h"
+#include "symtable.h"
 #include "sys_tasks.h"
 #include "info.h"
 #include "util.h"
@@ -126,6 +127,34 @@ char* cdd_message = NULL;
 */
 bool flag_conservative = FALSE;
 
+/*!
+ Specifies if statements should be simulated by recursively walking their expression trees instead of executing
+ their compiled expression programs.  This is used for performance comparison purposes.
+*/
+bool flag_sim_tree_walk = FALSE;
+
+/*!
+ Specifies if the VCD dumpfile should be read through the C stdio library instead of being mapped into memory
+ and tokenized in place.  This is used for performance comparison purposes.
+*/
+bool flag_vcd_stdio = FALSE;
+
+/*!
+ Specifies if the simulation portion of the VCD dumpfile should be tokenized by a separate reader thread that
+ feeds the simulation thread.
+*/
+bool flag_vcd_pipeline = FALSE;
+
+/*!
+ Specifies the number of threads used to decompress the value change data of each FST block.
+*/
+int fst_threads = 1;
+
+/*!
+ Specifies if the CDD file should be written in the compressed CDD format.
+*/
+bool flag_compress_cdd = FALSE;
+
 /*!
  Pointer to head of string list containing the names of modules that should be ignored for race condition checking.
 */
@@ -221,8 +250,12 @@ static void score_usage() {
   printf( "                                     module in the design.  If not specified, -t value is used.\n" );
   printf( "      -o <database_filename>       Name of database to write coverage information to.\n" );
   printf( "      -cdd <database_filename>     Name of database to read coverage information from (same as -o).\n" );
+  printf( "      -z                           Writes the database as a block-compressed CDD file.  Compressed CDD files\n" );
+  printf( "                                     are smaller on disk but take longer to read and write.\n" );
   printf( "      -I <directory>               Directory to find included Verilog files.\n" );
   printf( "      -f <filename>                Name of file containing additional arguments to parse.\n" );
+  printf( "      -fst-threads <number>        Number of threads used to decompress the value changes of each block of the FST\n" );
+  printf( "                                     dumpfile specified with -fst.  By default, a single thread is used.\n" );
   printf( "      -F <module>=(<ivar>,)<ovar>  Module, input state variable and output state variable of\n" );
   printf( "                                     an FSM state variable.  If input variable (ivar) is not specified,\n" );
   printf( "                                     the output variable (ovar) is also used as the input variable.\n" ); 
@@ -238,6 +271,15 @@ static void score_usage() {
   printf( "                                     the current timestep (by increments of <number>) to standard output.\n" );
   printf( "      -S                           Outputs simulation performance information after scoring has completed.  This\n" );
   printf( "                                     information is currently only useful for the developers of Covered.\n" );
+  printf( "      -sim-tree-walk               Simulates expression trees by recursively walking them instead of executing their\n" );
+  printf( "                                     compiled expression programs.  This option is currently only useful for the\n" );
+  printf( "                                     developers of Covered.\n" );
+  printf( "      -vcd-pipeline                Tokenizes the VCD dumpfile in a separate thread that feeds value changes to the\n" );
+  printf( "                                     simulation thread, hiding most of the parsing time on multi-core hosts.  This\n" );
+  printf( "                                     option has no effect if -vcd-stdio is specified.\n" );
+  printf( "      -vcd-stdio                   Reads the VCD dumpfile with the C stdio library instead of mapping it into memory\n" );
+  printf( "                                     and tokenizing it in place.  This option is currently only useful for the\n" );
+  printf( "                                     developers of Covered.\n" );
   printf( "      -g (<module>=)[1|2|3]        Selects generation of Verilog syntax that the parser will handle.  If\n" );
   printf( "                                     <module>= is present, only the specified module will use the provided\n" );
   printf( "                                     generation.  If <module>= is not specified, the entire design will use\n" );
@@ -754,6 +796,18 @@ static bool score_parse_args(
         Throw 0;
       }
       
+    } else if( strncmp( "-fst-threads", argv[i], 12 ) == 0 ) {
+
+      if( check_option_value( argc, argv, i ) ) {
+        i++;
+        fst_threads = atoi( argv[i] );
+        if( fst_threads <= 0 ) {
+          fst_threads = 1;
+        }
+      } else {
+        Throw 0;
+      }
+
     } else if( strncmp( "-fst", argv[i], 4 ) == 0 ) {
 
       if( check_option_value( argc, argv, i ) ) {
@@ -863,6 +917,14 @@ static bool score_parse_args(
         Throw 0;
       }
 
+    } else if( strncmp( "-vcd-pipeline", argv[i], 13 ) == 0 ) {
+
+      flag_vcd_pipeline = TRUE;
+
+    } else if( strncmp( "-vcd-stdio", argv[i], 10 ) == 0 ) {
+
+      flag_vcd_stdio = TRUE;
+
     } else if( strncmp( "-vcd", argv[i], 4 ) == 0 ) {
 
       if( check_option_value( argc, argv, i ) ) {
@@ -1250,6 +1312,10 @@ static bool score_parse_args(
         Throw 0;
       }
 
+    } else if( strncmp( "-sim-tree-walk", argv[i], 14 ) == 0 ) {
+
+      flag_sim_tree_walk = TRUE;
+
     } else if( strncmp( "-conservative", argv[i], 13 ) == 0 ) {
 
       flag_conservative = TRUE;
@@ -1258,6 +1324,10 @@ static bool score_parse_args(
 
       warnings_suppressed = TRUE;
 
+    } else if( strncmp( "-z", argv[i], 2 ) == 0 ) {
+
+      flag_compress_cdd = TRUE;
+
     /* Any other option that is a plusarg will be added to the list of simulation plusargs */
     } else if( strncmp( "+", argv[i], 1 ) == 0 ) {
 
@@ -1391,6 +1461,9 @@ void command_score(
       assert( rv < USER_MSG_LENGTH );
       /*@=duplicatequals =formattype =formatcode@*/
       print_output( user_msg, NORMAL, __FILE__, __LINE__ );
+
+      /* Display the size of the dumpfile symbol table, if one was built */
+      symtable_display_stats();
       print_output( "", NORMAL, __FILE__, __LINE__ );
 
       /* Display simulation statistics if specified */
@@ -75,6 +75,14 @@
  root expression of the tree has been evaluated.  At this point the expression tree
  is removed from the expression simulation engine and the associated statement worked
  on by the statement simulation engine as specified above.
+
+ \par
+ Threads that are waiting on a delay are stored in the delay queue, which is implemented as a
+ hierarchical timing wheel.  Each level of the wheel resolves 8 bits of simulation time so that
+ adding a thread and removing the next thread to wake up are constant time operations.  Threads
+ that wake up beyond the span of the wheel (including all final blocks) are kept in an overflow
+ heap and are moved into the wheel when the simulation time reaches them.  Threads that wake up
+ at the same simulation time are always woken up in the order that they were delayed.
 */
 
 #include <stdio.h>
@@ -103,6 +111,9 @@ extern bool                  debug_mode;
 extern exp_info              exp_op_info[EXP_OP_NUM];
 extern /*@null@*/inst_link*  inst_head;
 extern bool                  flag_use_command_line_debug;
+extern bool                  flag_sim_tree_walk;
+extern db**                  db_list;
+extern unsigned int          curr_db;
 #ifdef DEBUG_MODE
 #ifndef VPI_ONLY
 extern bool                  cli_debug_mode;
@@ -148,14 +159,113 @@ static thread* active_head  = NULL;
 static thread* active_tail  = NULL;
 
 /*!
- Pointer to head of delayed thread list.
+ Specifies the number of simulation time bits that are resolved by each level of the delay queue
+ timing wheel.
+*/
+#define DLY_WHEEL_BITS      8
+
+/*!
+ Specifies the number of slots in each level of the delay queue timing wheel.
+*/
+#define DLY_WHEEL_SLOTS     (1 << DLY_WHEEL_BITS)
+
+/*!
+ Specifies the number of levels in the delay queue timing wheel.  Together with #DLY_WHEEL_BITS this
+ allows the wheel to hold any thread that wakes up within 2^32 time units of the current wheel time.
+*/
+#define DLY_WHEEL_LEVELS    4
+
+/*!
+ Specifies the number of 32-bit words needed to hold the slot occupancy bitmap of one wheel level.
+*/
+#define DLY_WHEEL_MAP_WORDS (DLY_WHEEL_SLOTS / 32)
+
+/*!
+ Pointer to head of the list of delayed threads whose wakeup time is earlier than the current wheel time.
+ This list is kept in simulation time order.
+*/
+static thread* dly_early_head = NULL;
+
+/*!
+ Pointer to tail of the list of delayed threads whose wakeup time is earlier than the current wheel time.
+*/
+static thread* dly_early_tail = NULL;
+
+/*!
+ Simulation time of the most recently expired slot of the delay queue timing wheel.  All threads stored
+ in the wheel or in the overflow heap have a wakeup time that is greater than or equal to this value.
+*/
+static uint64 dly_wheel_time = 0;
+
+/*!
+ Head pointers of the delayed thread lists stored in each slot of the hierarchical timing wheel.  A thread
+ is stored in level N when its wakeup time first differs from #dly_wheel_time in the Nth group of
+ #DLY_WHEEL_BITS bits.  Each list is kept in insertion order.
 */
-static thread* delayed_head = NULL;
+static thread* dly_wheel_head[DLY_WHEEL_LEVELS][DLY_WHEEL_SLOTS];
 
 /*!
- Pointer to tail of delayed thread list.
+ Tail pointers of the delayed thread lists stored in each slot of the hierarchical timing wheel.
 */
-static thread* delayed_tail = NULL;
+static thread* dly_wheel_tail[DLY_WHEEL_LEVELS][DLY_WHEEL_SLOTS];
+
+/*!
+ Occupancy bitmap of each timing wheel level (a set bit indicates that the associated slot contains threads).
+*/
+static uint32 dly_wheel_map[DLY_WHEEL_LEVELS][DLY_WHEEL_MAP_WORDS];
+
+/*!
+ Binary min-heap containing the delayed threads whose wakeup time lies beyond the span of the timing wheel
+ (this includes all threads waiting for the final timestep).
+*/
+static dly_entry* dly_heap = NULL;
+
+/*!
+ Number of threads currently stored in the delay queue overflow heap.
+*/
+static unsigned int dly_heap_size = 0;
+
+/*!
+ Allocated number of elements in the delay queue overflow heap.
+*/
+static unsigned int dly_heap_alloc = 0;
+
+/*!
+ Sequence number to assign to the next thread placed in the delay queue overflow heap.
+*/
+static uint64 dly_heap_seq = 0;
+
+/*!
+ Number of times that a changed root expression caused its statement to wake up its waiting threads.
+*/
+uint64 sim_stmt_wakeups = 0;
+
+/*!
+ Number of threads that were woken up by changed root expressions.
+*/
+uint64 sim_thread_wakeups = 0;
+
+/*!
+ Number of thread checks avoided by waking up only the threads waiting on a changed statement instead
+ of searching through all of the threads of the statement's functional unit.
+*/
+uint64 sim_wakeups_avoided = 0;
+
+/*!
+ Interpreter frame stack shared by all executions of compiled expression programs.  Each execution reserves
+ the number of frames needed by its program on top of the frames of any execution that it is nested in.
+*/
+static exp_frame* exec_stack = NULL;
+
+/*!
+ Allocated number of elements in the exec_stack array.
+*/
+static unsigned int exec_stack_size = 0;
+
+/*!
+ Index of the first unreserved frame in the exec_stack array.
+*/
+static unsigned int exec_stack_top = 0;
 
 /*!
  List of thread state string names.
@@ -264,7 +374,21 @@ void sim_display_active_queue() {
 */
 void sim_display_delay_queue() {
 
-  sim_display_queue( delayed_head, delayed_tail );
+  unsigned int level;  /* Timing wheel level */
+  unsigned int slot;   /* Timing wheel slot */
+  unsigned int i;
+
+  sim_display_queue( dly_early_head, dly_early_tail );
+
+  for( level=0; level<DLY_WHEEL_LEVELS; level++ ) {
+    for( slot=0; slot<DLY_WHEEL_SLOTS; slot++ ) {
+      sim_display_queue( dly_wheel_head[level][slot], dly_wheel_tail[level][slot] );
+    }
+  }
+
+  for( i=0; i<dly_heap_size; i++ ) {
+    sim_display_thread( dly_heap[i].thr, TRUE, TRUE );
+  }
 
 }
 
@@ -304,6 +428,63 @@ thread* sim_current_thread() { PROFILE(SIM_CURRENT_THREAD);
 
 }
 
+/*!
+ Places the given thread into the waiting state and adds it to the end of the list of threads that are
+ waiting on its current statement.
+*/
+static void sim_thread_wait(
+  thread* thr  /*!< Pointer to thread to place into the waiting state */
+) { PROFILE(SIM_THREAD_WAIT);
+
+  statement* stmt = thr->curr;
+
+  thr->suppl.part.state = THR_ST_WAITING;
+
+  if( stmt->wait_head == NULL ) {
+    thr->wait_prev  = thr;
+    thr->wait_next  = thr;
+    stmt->wait_head = thr;
+  } else {
+    thr->wait_prev                        = stmt->wait_head->wait_prev;
+    thr->wait_next                        = stmt->wait_head;
+    stmt->wait_head->wait_prev->wait_next = thr;
+    stmt->wait_head->wait_prev            = thr;
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ If the given thread is in the waiting state, removes it from the list of threads waiting on its current
+ statement.  The thread state is not modified by this function.
+*/
+static void sim_thread_unwait(
+  thread* thr  /*!< Pointer to thread to remove from its statement wait list */
+) { PROFILE(SIM_THREAD_UNWAIT);
+
+  if( thr->suppl.part.state == THR_ST_WAITING ) {
+
+    statement* stmt = thr->curr;
+
+    if( thr->wait_next == thr ) {
+      stmt->wait_head = NULL;
+    } else {
+      thr->wait_prev->wait_next = thr->wait_next;
+      thr->wait_next->wait_prev = thr->wait_prev;
+      if( stmt->wait_head == thr ) {
+        stmt->wait_head = thr->wait_next;
+      }
+    }
+
+    thr->wait_prev = thr->wait_next = NULL;
+
+  }
+
+  PROFILE_END;
+
+}
+
 /*!
  Pops the head thread from the active queue without deallocating the thread.
 */
@@ -335,7 +516,7 @@ static void sim_thread_pop_head() { PROFILE(SIM_THREAD_POP_HEAD);
     thr->curr = thr->curr->next_true;
     thr->suppl.part.state = THR_ST_NONE;
   } else {
-    thr->suppl.part.state      = THR_ST_WAITING;
+    sim_thread_wait( thr );
     thr->suppl.part.exec_first = 1; 
   }
 
@@ -350,6 +531,294 @@ static void sim_thread_pop_head() { PROFILE(SIM_THREAD_POP_HEAD);
 
 }
 
+/*!
+ \return Returns TRUE if the thread in heap entry e1 should be woken up before the thread in heap entry e2.
+*/
+static bool sim_delay_heap_less(
+  const dly_entry* e1,  /*!< Pointer to first heap entry to compare */
+  const dly_entry* e2   /*!< Pointer to second heap entry to compare */
+) {
+
+  return( (e1->thr->curr_time.full < e2->thr->curr_time.full) ||
+          ((e1->thr->curr_time.full == e2->thr->curr_time.full) && (e1->seq < e2->seq)) );
+
+}
+
+/*!
+ Places the given thread into the delay queue overflow heap.
+*/
+static void sim_delay_heap_push(
+  thread* thr  /*!< Pointer to thread to add to the heap */
+) { PROFILE(SIM_DELAY_HEAP_PUSH);
+
+  unsigned int i;
+  dly_entry    entry;
+
+  /* Grow the heap, if necessary */
+  if( dly_heap_size == dly_heap_alloc ) {
+    unsigned int new_alloc = (dly_heap_alloc == 0) ? 64 : (dly_heap_alloc * 2);
+    dly_heap       = (dly_entry*)realloc_safe( dly_heap, (sizeof( dly_entry ) * dly_heap_alloc), (sizeof( dly_entry ) * new_alloc) );
+    dly_heap_alloc = new_alloc;
+  }
+
+  entry.thr = thr;
+  entry.seq = dly_heap_seq++;
+
+  /* Sift the new entry up to its proper position */
+  i = dly_heap_size++;
+  while( (i > 0) && sim_delay_heap_less( &entry, &(dly_heap[(i - 1) / 2]) ) ) {
+    dly_heap[i] = dly_heap[(i - 1) / 2];
+    i = (i - 1) / 2;
+  }
+  dly_heap[i] = entry;
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns a pointer to the thread with the earliest wakeup time in the delay queue overflow heap.
+
+ Removes the earliest thread from the delay queue overflow heap.  The heap must not be empty.
+*/
+static thread* sim_delay_heap_pop() { PROFILE(SIM_DELAY_HEAP_POP);
+
+  thread*      thr;
+  dly_entry    last;
+  unsigned int i = 0;
+  unsigned int child;
+
+  assert( dly_heap_size > 0 );
+
+  thr  = dly_heap[0].thr;
+  last = dly_heap[--dly_heap_size];
+
+  /* Sift the last entry down from the root to its proper position */
+  while( (child = ((i * 2) + 1)) < dly_heap_size ) {
+    if( ((child + 1) < dly_heap_size) && sim_delay_heap_less( &(dly_heap[child + 1]), &(dly_heap[child]) ) ) {
+      child++;
+    }
+    if( !sim_delay_heap_less( &(dly_heap[child]), &last ) ) {
+      break;
+    }
+    dly_heap[i] = dly_heap[child];
+    i = child;
+  }
+  dly_heap[i] = last;
+
+  PROFILE_END;
+
+  return( thr );
+
+}
+
+/*!
+ Adds the given thread (whose curr_time has been set to its wakeup time) to the delay queue.  Threads
+ that wake up at the same simulation time are always returned in the order that they were added.
+*/
+static void sim_delay_queue_add(
+  thread* thr  /*!< Pointer to thread to add to the delay queue */
+) { PROFILE(SIM_DELAY_QUEUE_ADD);
+
+  uint64 time = thr->curr_time.full;
+  uint64 diff = time ^ dly_wheel_time;
+
+  if( time < dly_wheel_time ) {
+
+    thread* curr = dly_early_tail;
+
+    /* The wheel has already moved beyond this time, insert the thread into the early list in time order */
+    while( (curr != NULL) && (curr->curr_time.full > time) ) {
+      curr = curr->queue_prev;
+    }
+    thr->queue_prev = curr;
+    if( curr == NULL ) {
+      thr->queue_next = dly_early_head;
+      dly_early_head  = thr;
+    } else {
+      thr->queue_next  = curr->queue_next;
+      curr->queue_next = thr;
+    }
+    if( thr->queue_next == NULL ) {
+      dly_early_tail = thr;
+    } else {
+      thr->queue_next->queue_prev = thr;
+    }
+
+  } else if( (diff >> (DLY_WHEEL_BITS * DLY_WHEEL_LEVELS)) != 0 ) {
+
+    /* The wakeup time is beyond the span of the wheel */
+    sim_delay_heap_push( thr );
+
+  } else {
+
+    unsigned int level = 0;
+    unsigned int slot;
+
+    /* Find the wheel level that resolves the most significant bit group that differs from the wheel time */
+    while( (diff >> (DLY_WHEEL_BITS * (level + 1))) != 0 ) {
+      level++;
+    }
+    slot = (unsigned int)((time >> (DLY_WHEEL_BITS * level)) & (DLY_WHEEL_SLOTS - 1));
+
+    /* Append the thread to the slot list */
+    thr->queue_prev = dly_wheel_tail[level][slot];
+    thr->queue_next = NULL;
+    if( dly_wheel_head[level][slot] == NULL ) {
+      dly_wheel_head[level][slot] = thr;
+      dly_wheel_map[level][slot / 32] |= ((uint32)1 << (slot % 32));
+    } else {
+      dly_wheel_tail[level][slot]->queue_next = thr;
+    }
+    dly_wheel_tail[level][slot] = thr;
+
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns the index of the first occupied slot in the given wheel level that is greater than or equal
+         to the given starting slot, or -1 if no such slot exists.
+*/
+static int sim_delay_wheel_find(
+  unsigned int level,  /*!< Timing wheel level to search */
+  unsigned int start   /*!< Index of first slot to consider */
+) { PROFILE(SIM_DELAY_WHEEL_FIND);
+
+  int          slot = -1;
+  unsigned int i;
+
+  for( i=(start / 32); (i<DLY_WHEEL_MAP_WORDS) && (slot == -1); i++ ) {
+    uint32 bits = dly_wheel_map[level][i];
+    if( i == (start / 32) ) {
+      bits &= (0xffffffff << (start % 32));
+    }
+    if( bits != 0 ) {
+      slot = (int)(i * 32);
+      while( (bits & 0x1) == 0 ) {
+        bits >>= 1;
+        slot++;
+      }
+    }
+  }
+
+  PROFILE_END;
+
+  return( slot );
+
+}
+
+/*!
+ \return Returns a pointer to the delayed thread that should be woken up next if its wakeup time is less than
+         or equal to the given simulation time; otherwise, returns NULL.
+
+ Removes the next thread to wake up from the delay queue, advancing the timing wheel (and cascading threads
+ from its higher levels and from the overflow heap into its lower levels) as needed.
+*/
+static thread* sim_delay_queue_pop(
+  const sim_time* time  /*!< Current simulation time */
+) { PROFILE(SIM_DELAY_QUEUE_POP);
+
+  thread* thr = NULL;
+
+  if( dly_early_head != NULL ) {
+
+    /* Threads in the early list are always due since the wheel time cannot be greater than the current time */
+    thr            = dly_early_head;
+    dly_early_head = thr->queue_next;
+    if( dly_early_head == NULL ) {
+      dly_early_tail = NULL;
+    } else {
+      dly_early_head->queue_prev = NULL;
+    }
+
+  } else {
+
+    bool done = FALSE;
+
+    while( !done ) {
+
+      unsigned int level;
+      int          slot = sim_delay_wheel_find( 0, (unsigned int)(dly_wheel_time & (DLY_WHEEL_SLOTS - 1)) );
+
+      if( slot != -1 ) {
+
+        uint64 slot_time = (dly_wheel_time & ~((uint64)(DLY_WHEEL_SLOTS - 1))) | (uint64)slot;
+
+        /* If the earliest slot is due, pop the thread at its head */
+        if( slot_time <= time->full ) {
+          dly_wheel_time = slot_time;
+          thr            = dly_wheel_head[0][slot];
+          dly_wheel_head[0][slot] = thr->queue_next;
+          if( dly_wheel_head[0][slot] == NULL ) {
+            dly_wheel_tail[0][slot] = NULL;
+            dly_wheel_map[0][slot / 32] &= ~((uint32)1 << (slot % 32));
+          } else {
+            dly_wheel_head[0][slot]->queue_prev = NULL;
+          }
+        }
+        done = TRUE;
+
+      } else {
+
+        /* Level 0 is exhausted so find the next occupied slot in the higher levels */
+        for( level=1; level<DLY_WHEEL_LEVELS; level++ ) {
+          unsigned int start = (unsigned int)((dly_wheel_time >> (DLY_WHEEL_BITS * level)) & (DLY_WHEEL_SLOTS - 1)) + 1;
+          if( (start < DLY_WHEEL_SLOTS) && ((slot = sim_delay_wheel_find( level, start )) != -1) ) {
+            break;
+          }
+        }
+
+        if( level < DLY_WHEEL_LEVELS ) {
+
+          uint64  slot_time = ((dly_wheel_time >> (DLY_WHEEL_BITS * (level + 1))) << (DLY_WHEEL_BITS * (level + 1))) |
+                              ((uint64)slot << (DLY_WHEEL_BITS * level));
+          thread* curr;
+
+          if( slot_time > time->full ) {
+            done = TRUE;
+          } else {
+
+            /* Advance the wheel to the start of the slot and redistribute its threads into the lower levels */
+            dly_wheel_time = slot_time;
+            curr           = dly_wheel_head[level][slot];
+            dly_wheel_head[level][slot] = NULL;
+            dly_wheel_tail[level][slot] = NULL;
+            dly_wheel_map[level][slot / 32] &= ~((uint32)1 << (slot % 32));
+            while( curr != NULL ) {
+              thread* next = curr->queue_next;
+              sim_delay_queue_add( curr );
+              curr = next;
+            }
+
+          }
+
+        } else if( (dly_heap_size > 0) && (dly_heap[0].thr->curr_time.full <= time->full) ) {
+
+          /* The wheel is empty, so move it to the earliest overflow time and pull in every thread that now fits */
+          dly_wheel_time = dly_heap[0].thr->curr_time.full;
+          while( (dly_heap_size > 0) && (((dly_heap[0].thr->curr_time.full ^ dly_wheel_time) >> (DLY_WHEEL_BITS * DLY_WHEEL_LEVELS)) == 0) ) {
+            sim_delay_queue_add( sim_delay_heap_pop() );
+          }
+
+        } else {
+          done = TRUE;
+        }
+
+      }
+
+    }
+
+  }
+
+  PROFILE_END;
+
+  return( thr );
+
+}
+
 /*!
  This function is called by the expression_op_func__delay() function.
 */
@@ -358,8 +827,6 @@ void sim_thread_insert_into_delay_queue(
   const sim_time* time  /*!< Pointer to time to insert the given thread */
 ) { PROFILE(SIM_THREAD_INSERT_INTO_DELAY_QUEUE);
 
-  thread* curr;  /* Pointer to current thread in delayed queue to compare against */
-
 #ifdef DEBUG_MODE
   if( debug_mode && !flag_use_command_line_debug ) {
     printf( "Before delay thread is inserted for time %" FMT64 "u...\n", time->full );
@@ -390,38 +857,14 @@ void sim_thread_insert_into_delay_queue(
     }
 
     /* Specify that the thread is queued and delayed */
+    sim_thread_unwait( thr );
     thr->suppl.part.state = THR_ST_DELAYED;
 
     /* Set the thread simulation time to the given time */
     thr->curr_time = *time;
 
     /* Add the given thread to the delayed queue in simulation time order */
-    if( delayed_head == NULL ) {
-      delayed_head = delayed_tail = thr;
-      thr->queue_prev = NULL;
-      thr->queue_next = NULL;
-    } else {
-      curr = delayed_tail;
-      while( (curr != NULL) && TIME_CMP_GT(curr->curr_time, *time) ) {
-        curr = curr->queue_prev;
-      }
-      if( curr == NULL ) {
-        thr->queue_prev          = NULL;
-        thr->queue_next          = delayed_head;
-        delayed_head->queue_prev = thr;
-        delayed_head             = thr;
-      } else if( curr == delayed_tail ) {
-        thr->queue_prev          = delayed_tail;
-        thr->queue_next          = NULL;
-        delayed_tail->queue_next = thr;
-        delayed_tail             = thr;
-      } else {
-        thr->queue_prev             = curr;
-        thr->queue_next             = curr->queue_next;
-        thr->queue_next->queue_prev = thr;
-        curr->queue_next            = thr;
-      }
-    }
+    sim_delay_queue_add( thr );
     
 #ifdef DEBUG_MODE
     if( debug_mode && !flag_use_command_line_debug ) {
@@ -457,6 +900,7 @@ void sim_thread_push(
 #endif
 
   /* Set the state to ACTIVE */
+  sim_thread_unwait( thr );
   thr->suppl.part.state = THR_ST_ACTIVE;
 
   /* Set the current time of the thread to the given value */
@@ -496,6 +940,47 @@ void sim_thread_push(
 
 }
 
+/*!
+ Pushes all of the threads that are waiting on the given statement onto the active queue.  Since each
+ statement keeps its own list of waiting threads, the other threads of the statement's functional unit
+ do not need to be searched.
+*/
+static void sim_push_waiting_threads(
+  statement*      stmt,  /*!< Pointer to statement whose root expression has changed */
+  const sim_time* time   /*!< Pointer to current simulation time */
+) { PROFILE(SIM_PUSH_WAITING_THREADS);
+
+  thread*      thr = stmt->wait_head;
+  unsigned int woken = 0;
+
+  if( thr != NULL ) {
+
+    /* Detach the wait list from the statement since all of its threads are being woken up */
+    thr->wait_prev->wait_next = NULL;
+    stmt->wait_head = NULL;
+
+    while( thr != NULL ) {
+      thread* next = thr->wait_next;
+      thr->wait_prev = thr->wait_next = NULL;
+      thr->suppl.part.state = THR_ST_NONE;
+      sim_thread_push( thr, time );
+      woken++;
+      thr = next;
+    }
+
+  }
+
+  sim_stmt_wakeups++;
+  sim_thread_wakeups  += woken;
+
+  /* A thread waits on a single statement, so it can only be pushed once in this pass */
+  assert( woken <= stmt->funit->thr_size );
+  sim_wakeups_avoided += (stmt->funit->thr_size - woken);
+
+  PROFILE_END;
+
+}
+
 /*!
  Traverses up expression tree pointed to by leaf node expr, setting the
  CHANGED bits as it reaches the root expression.  When the root expression is
@@ -575,7 +1060,7 @@ void sim_expr_changed(
     }
 #endif
 
-    funit_push_threads( expr->parent->stmt->funit, expr->parent->stmt, time );
+    sim_push_waiting_threads( expr->parent->stmt, time );
 
   }
 
@@ -635,6 +1120,8 @@ static thread* sim_create_thread(
   thr->curr_time.final = FALSE;
   thr->queue_prev      = NULL;
   thr->queue_next      = NULL;
+  thr->wait_prev       = NULL;
+  thr->wait_next       = NULL;
 
   /* Add this thread to the given functional unit */
   funit_add_thread( funit, thr );
@@ -795,6 +1282,7 @@ static void sim_kill_thread(
       }
       active_head = thr->parent;
       thr->parent->curr_time = thr->curr_time;
+      sim_thread_unwait( thr->parent );
       thr->parent->suppl.part.state = THR_ST_ACTIVE;  /* Specify that the parent thread is now back in the active queue */
     } else {
       active_head = active_head->queue_next;
@@ -990,6 +1478,281 @@ bool sim_expression(
 
 }
 
+/*!
+ \return Returns the number of instructions needed to evaluate the given expression tree.
+*/
+static unsigned int sim_count_instructions(
+  const expression* expr  /*!< Pointer to root of expression tree to count */
+) {
+
+  unsigned int num = 1;
+
+  /* LHS expressions are represented by a single instruction that does nothing */
+  if( ESUPPL_IS_LHS( expr->suppl ) == 0 ) {
+    if( expr->left != NULL ) {
+      num += sim_count_instructions( expr->left );
+    }
+    if( expr->right != NULL ) {
+      num += sim_count_instructions( expr->right );
+    }
+  }
+
+  return( num );
+
+}
+
+/*!
+ \return Returns the index of the instruction that evaluates the given expression.
+
+ Recursively compiles the given expression tree into the given program in post-order.
+*/
+static int sim_compile_expression_helper(
+  expression*  expr,  /*!< Pointer to expression to compile */
+  exp_prog*    prog,  /*!< Pointer to program being created */
+  unsigned int depth  /*!< Number of interpreter frames (one per ancestor) needed to reach this expression */
+) { PROFILE(SIM_COMPILE_EXPRESSION_HELPER);
+
+  exp_inst*    inst;
+  int          left  = -1;
+  int          right = -1;
+  unsigned int lhs   = ESUPPL_IS_LHS( expr->suppl );
+
+  if( depth > prog->depth ) {
+    prog->depth = depth;
+  }
+
+  if( lhs == 0 ) {
+    if( expr->left != NULL ) {
+      left = sim_compile_expression_helper( expr->left, prog, (depth + 1) );
+    }
+    if( expr->right != NULL ) {
+      right = sim_compile_expression_helper( expr->right, prog, (depth + 1) );
+    }
+  }
+
+  inst = &(prog->insts[prog->size]);
+
+  inst->expr                 = expr;
+  inst->left                 = left;
+  inst->right                = right;
+  inst->suppl.all            = 0;
+  inst->suppl.part.lhs       = lhs;
+  inst->suppl.part.case_op   = (expr->op == EXP_OP_CASE) || (expr->op == EXP_OP_CASEX) || (expr->op == EXP_OP_CASEZ);
+  inst->suppl.part.skip_left = (expr->op == EXP_OP_DLY_OP) && (expr->left != NULL) && (expr->left->op == EXP_OP_DELAY);
+  inst->suppl.part.dly_op    = (expr->op == EXP_OP_DLY_OP);
+  inst->suppl.part.operate   = (ESUPPL_IS_ROOT( expr->suppl ) == 0) || (expr->parent->stmt == NULL) ||
+                               (expr->parent->stmt->suppl.part.cont == 0) || (expr->table != NULL);
+  inst->suppl.part.direct    = (expr->table == NULL);
+  inst->func                 = exp_op_info[expr->op].func;
+
+  PROFILE_END;
+
+  return( (int)(prog->size++) );
+
+}
+
+/*!
+ \return Returns a pointer to the newly created program.
+
+ Compiles the given statement's root expression tree into a linear, post-order array of instructions.
+*/
+static exp_prog* sim_compile_expression(
+  statement* stmt  /*!< Pointer to statement to compile */
+) { PROFILE(SIM_COMPILE_EXPRESSION);
+
+  exp_prog*    prog;
+  unsigned int num = sim_count_instructions( stmt->exp );
+
+  prog        = (exp_prog*)malloc_safe( sizeof( exp_prog ) );
+  prog->insts = (exp_inst*)malloc_safe( sizeof( exp_inst ) * num );
+  prog->size  = 0;
+  prog->depth = 0;
+
+  (void)sim_compile_expression_helper( stmt->exp, prog, 0 );
+
+  assert( prog->size == num );
+
+  PROFILE_END;
+
+  return( prog );
+
+}
+
+/*!
+ Compiles the root expression tree of every statement in the current design into its program.  This is
+ called once the design has been bound, so that the expression trees are complete and all
+ continuous assignment and FSM table pointers are in place, and before any statement is simulated.
+*/
+static void sim_compile_statements() { PROFILE(SIM_COMPILE_STATEMENTS);
+
+  funit_link* funitl = db_list[curr_db]->funit_head;
+
+  while( funitl != NULL ) {
+    stmt_link* stmtl = funitl->funit->stmt_head;
+    while( stmtl != NULL ) {
+      if( stmtl->stmt->prog == NULL ) {
+        stmtl->stmt->prog = sim_compile_expression( stmtl->stmt );
+      }
+      stmtl = stmtl->next;
+    }
+    funitl = funitl->next;
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns TRUE if the root expression has changed value from previous sim; otherwise,
+         returns FALSE.
+
+ Executes the given compiled expression program.  This performs the same traversal as the sim_expression
+ function, following the #ESUPPL_IS_LEFT_CHANGED and #ESUPPL_IS_RIGHT_CHANGED bits and only operating on
+ expressions whose children have changed, but keeps the state of the current expression in local variables,
+ saves a frame only for each expression whose child is being evaluated and calls the operation function that
+ was looked up when the program was compiled.
+*/
+static bool sim_expression_program(
+  const exp_prog* prog,  /*!< Pointer to program to execute */
+  thread*         thr,   /*!< Pointer to current thread that is being simulated */
+  const sim_time* time   /*!< Pointer to current simulation time */
+) { PROFILE(SIM_EXPRESSION_PROGRAM);
+
+  const exp_inst* insts   = prog->insts;
+  unsigned int    base    = exec_stack_top;
+  unsigned int    sp      = base;
+  int             index   = (int)(prog->size - 1);
+  uint8           phase   = 0;
+  bool            left_changed;
+  bool            right_changed;
+  bool            result  = FALSE;
+  bool            running = TRUE;
+
+  /* LHS expressions are not evaluated by RHS traversals */
+  if( insts[index].suppl.part.lhs == 0 ) {
+
+    /* Reserve the frames needed by this program */
+    if( prog->depth > 0 ) {
+      if( (base + prog->depth) > exec_stack_size ) {
+        unsigned int new_size = (base + prog->depth) * 2;
+        exec_stack      = (exp_frame*)realloc_safe( exec_stack, (sizeof( exp_frame ) * exec_stack_size), (sizeof( exp_frame ) * new_size) );
+        exec_stack_size = new_size;
+      }
+      exec_stack_top = base + prog->depth;
+    }
+
+    while( running ) {
+
+      const exp_inst* inst = &(insts[index]);
+      expression*     expr = inst->expr;
+
+      if( phase == 0 ) {
+
+#ifdef DEBUG_MODE
+        if( debug_mode ) {
+          unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "    In sim_expression %d, left_changed %d, right_changed %d, thread %p",
+                                      expr->id, ESUPPL_IS_LEFT_CHANGED( expr->suppl ), ESUPPL_IS_RIGHT_CHANGED( expr->suppl ), thr );
+          assert( rv < USER_MSG_LENGTH );
+          print_output( user_msg, DEBUG, __FILE__, __LINE__ );
+        }
+#endif
+
+        left_changed  = FALSE;
+        right_changed = FALSE;
+        phase         = 1;
+
+        /* Traverse left child expression if it has changed */
+        if( ((ESUPPL_IS_LEFT_CHANGED( expr->suppl ) == 1) || inst->suppl.part.case_op) && !inst->suppl.part.skip_left ) {
+          if( inst->left != -1 ) {
+            expr->suppl.part.left_changed = expr->suppl.part.clear_changed;
+            if( insts[inst->left].suppl.part.lhs == 0 ) {
+              exec_stack[sp].inst  = index;
+              exec_stack[sp].phase = 1;
+              sp++;
+              index = inst->left;
+              phase = 0;
+              continue;
+            }
+          } else {
+            expr->suppl.part.left_changed = 0;
+            left_changed                  = TRUE;
+          }
+        }
+
+      }
+
+      if( phase == 1 ) {
+
+        phase = 2;
+
+        /* Traverse right child expression if it has changed */
+        if( (ESUPPL_IS_RIGHT_CHANGED( expr->suppl ) == 1) && (!inst->suppl.part.dly_op || !thr->suppl.part.exec_first) ) {
+          if( inst->right != -1 ) {
+            expr->suppl.part.right_changed = expr->suppl.part.clear_changed;
+            if( insts[inst->right].suppl.part.lhs == 0 ) {
+              exec_stack[sp].inst         = index;
+              exec_stack[sp].phase        = 2;
+              exec_stack[sp].left_changed = left_changed;
+              sp++;
+              index = inst->right;
+              phase = 0;
+              continue;
+            }
+          } else {
+            expr->suppl.part.right_changed = 0;
+            right_changed                  = TRUE;
+          }
+        }
+
+      }
+
+      /*
+       Now perform expression operation for this expression if left or right expressions trees have changed.
+       Expressions attached to an FSM go through expression_operate so that the FSM table is updated.
+      */
+      if( inst->suppl.part.operate || left_changed || right_changed ) {
+        if( inst->suppl.part.direct ) {
+          result = inst->func( expr, thr, time );
+          (expr->exec_num)++;
+        } else {
+          result = expression_operate( expr, thr, time );
+        }
+      } else {
+        result = FALSE;
+      }
+
+      /*
+       Return the result to the parent frame.  The exec_stack array is always accessed by index since
+       executing an expression may execute a nested program that reallocates the array.
+      */
+      if( sp == base ) {
+        running = FALSE;
+      } else {
+        sp--;
+        index = exec_stack[sp].inst;
+        phase = exec_stack[sp].phase;
+        if( phase == 1 ) {
+          left_changed  = result;
+          right_changed = FALSE;
+        } else {
+          left_changed  = exec_stack[sp].left_changed;
+          right_changed = result;
+        }
+      }
+
+    }
+
+    /* Release the frames of this program */
+    exec_stack_top = base;
+
+  }
+
+  PROFILE_END;
+
+  return( result );
+
+}
+
 /*!
  Performs statement simulation as described above.  Calls expression simulator if
  the associated root expression is specified that signals have changed value within
@@ -1024,7 +1787,12 @@ void sim_thread(
 #endif
 
     /* Place expression in expression simulator and run */
-    expr_changed = sim_expression( stmt->exp, thr, time, FALSE );
+    if( flag_sim_tree_walk ) {
+      expr_changed = sim_expression( stmt->exp, thr, time, FALSE );
+    } else {
+      assert( stmt->prog != NULL );
+      expr_changed = sim_expression_program( stmt->prog, thr, time );
+    }
 
 #ifdef DEBUG_MODE
     if( debug_mode ) {
@@ -1114,21 +1882,17 @@ bool sim_simulate(
   const sim_time* time  /*!< Current simulation time from dumpfile or simulator */
 ) { PROFILE(SIM_SIMULATE);
 
+  thread* thr;  /* Pointer to delayed thread that is ready to be woken up */
+
   /* Simulate all threads in the active queue */
   while( active_head != NULL ) {
     sim_thread( active_head, time );
   }
 
-  while( (delayed_head != NULL) && TIME_CMP_LE(delayed_head->curr_time, *time) ) {
+  while( (thr = sim_delay_queue_pop( time )) != NULL ) {
 
-    active_head  = active_tail = delayed_head;
-    delayed_head = delayed_head->queue_next;
+    active_head = active_tail = thr;
     active_head->queue_prev = active_head->queue_next = NULL;
-    if( delayed_head != NULL ) {
-      delayed_head->queue_prev = NULL;
-    } else {
-      delayed_tail = NULL;
-    }
     active_head->suppl.part.state = THR_ST_ACTIVE;
 
     while( active_head != NULL ) {
@@ -1161,6 +1925,11 @@ void sim_initialize() { PROFILE(SIM_INITIALIZE);
     nba_queue_curr_size = 0;
   }
 
+  /* Compile the statement expression trees now that the design is bound */
+  if( !flag_sim_tree_walk ) {
+    sim_compile_statements();
+  }
+
   /* Add static values */
   sim_add_statics();
 
@@ -1281,18 +2050,40 @@ void sim_perform_nba(
 */
 void sim_dealloc() { PROFILE(SIM_DEALLOC);
 
-  thread* tmp;  /* Temporary thread pointer */
+  thread*      tmp;    /* Temporary thread pointer */
+  unsigned int level;  /* Timing wheel level */
+  unsigned int slot;   /* Timing wheel slot */
 
   /* Deallocate each thread in the all_threads array */
   while( all_head != NULL ) {
     tmp = all_head;
     all_head = all_head->all_next;
+    if( tmp->suppl.part.state == THR_ST_WAITING ) {
+      tmp->curr->wait_head = NULL;
+    }
     free_safe( tmp, sizeof( thread ) );
   }
 
-  all_head     = all_tail     = all_next = NULL;
-  active_head  = active_tail  = NULL;
-  delayed_head = delayed_tail = NULL;
+  all_head       = all_tail       = all_next = NULL;
+  active_head    = active_tail    = NULL;
+  dly_early_head = dly_early_tail = NULL;
+
+  /* Clear the delay queue */
+  for( level=0; level<DLY_WHEEL_LEVELS; level++ ) {
+    for( slot=0; slot<DLY_WHEEL_SLOTS; slot++ ) {
+      dly_wheel_head[level][slot] = NULL;
+      dly_wheel_tail[level][slot] = NULL;
+    }
+    for( slot=0; slot<DLY_WHEEL_MAP_WORDS; slot++ ) {
+      dly_wheel_map[level][slot] = 0;
+    }
+  }
+  dly_wheel_time = 0;
+  free_safe( dly_heap, (sizeof( dly_entry ) * dly_heap_alloc) );
+  dly_heap       = NULL;
+  dly_heap_size  = 0;
+  dly_heap_alloc = 0;
+  dly_heap_seq   = 0;
 
   /* Deallocate all static expressions, if there are any */
   exp_link_delete_list( static_exprs, static_expr_size, FALSE );
@@ -1300,6 +2091,12 @@ void sim_dealloc() { PROFILE(SIM_DEALLOC);
   /* Deallocate the non-blocking assignment queue */
   free_safe( nba_queue, (sizeof( nonblock_assign ) * nba_queue_size) );
 
+  /* Deallocate the expression program interpreter stack */
+  free_safe( exec_stack, (sizeof( exp_frame ) * exec_stack_size) );
+  exec_stack      = NULL;
+  exec_stack_size = 0;
+  exec_stack_top  = 0;
+
 #ifdef DEBUG_MODE
 #ifndef VPI_ONLY
   /* Clear CLI debug mode */
@@ -148,6 +148,8 @@ statement* statement_create(
   stmt->conn_id           = 0;
   stmt->suppl.all         = 0;
   stmt->funit             = funit;
+  stmt->wait_head         = NULL;
+  stmt->prog              = NULL;
 
   PROFILE_END;
 
@@ -155,6 +157,23 @@ statement* statement_create(
 
 }
 
+/*!
+ Deallocates the compiled expression program of the given statement, if one exists.
+*/
+static void statement_dealloc_program(
+  statement* stmt  /*!< Pointer to statement to deallocate program from */
+) { PROFILE(STATEMENT_DEALLOC_PROGRAM);
+
+  if( stmt->prog != NULL ) {
+    free_safe( stmt->prog->insts, (sizeof( exp_inst ) * stmt->prog->size) );
+    free_safe( stmt->prog, sizeof( exp_prog ) );
+    stmt->prog = NULL;
+  }
+
+  PROFILE_END;
+
+}
+
 #ifndef RUNLIB
 /*!
  Displays the current contents of the statement loop list for debug purposes only.
@@ -343,6 +362,34 @@ void statement_db_write(
 
 }
 
+/*!
+ Appends the specified statement to the binary CDD file as a binary record.  The record contains the same
+ information as the line written by statement_db_write.
+*/
+void statement_db_write_bin(
+  statement* stmt,       /*!< Pointer to statement to write out value */
+  FILE*      ofile,      /*!< Pointer to binary CDD file to write statement record to */
+  bool       ids_issued  /*!< Specifies that IDs were issued just prior to calling this function */
+) { PROFILE(STATEMENT_DB_WRITE_BIN);
+
+  uint32 fields[5];  /* Fixed-width fields of statement record */
+
+  assert( stmt != NULL );
+
+  fields[0] = (uint32)expression_get_id( stmt->exp, ids_issued );
+  fields[1] = (stmt->suppl.all & 0xff);
+  fields[2] = (uint32)((stmt->next_true   == NULL) ? 0 : expression_get_id( stmt->next_true->exp, ids_issued ));
+  fields[3] = (uint32)((stmt->next_false  == NULL) ? 0 : expression_get_id( stmt->next_false->exp, ids_issued ));
+  fields[4] = (uint32)((stmt->head        == NULL) ? 0 : expression_get_id( stmt->head->exp, ids_issued ));
+
+  db_bin_start_record( DB_TYPE_STATEMENT );
+  db_bin_put( fields, sizeof( fields ) );
+  db_bin_end_record( ofile );
+
+  PROFILE_END;
+
+}
+
 #ifndef RUNLIB
 /*!
  Traverses specified statement tree, outputting all statements within that tree.
@@ -408,7 +455,114 @@ void statement_db_write_expr_tree(
 #endif /* RUNLIB */
 
 /*!
- \throws anonymous Throw Throw
+ \throws anonymous Throw
+
+ Creates a new statement from the fields of a statement that were read from the database file, links it to
+ the statements that it refers to and adds it to the statement list of the specified functional unit.
+*/
+static void statement_db_build(
+  func_unit* curr_funit,  /*!< Pointer to current module */
+  int        read_mode,   /*!< If set to REPORT, adds statement to head of list; otherwise, adds statement to tail */
+  int        id,          /*!< ID of root expression that is associated with this statement */
+  uint32     suppl,       /*!< Supplemental field value */
+  int        true_id,     /*!< ID of root expression that is associated with the next_true statement */
+  int        false_id,    /*!< ID of root expression that is associated with the next_false statement */
+  int        head_id      /*!< ID of root expression that is associated with the head statement */
+) {
+
+  statement* stmt;   /* Pointer to newly created statement */
+  stmt_link* stmtl;  /* Pointer to found statement link */
+
+  if( curr_funit == NULL ) {
+
+    print_output( "Internal error:  statement in database written before its functional unit", FATAL, __FILE__, __LINE__ );
+    Throw 0;
+
+  } else {
+
+    /* Find associated root expression */
+    expression* exp = exp_link_find( id, curr_funit->exps, curr_funit->exp_size );
+    assert( exp != NULL );
+
+    stmt = statement_create( exp, curr_funit );
+    stmt->suppl.all = suppl;
+
+    /*
+     If this statement is a head statement and the current functional unit is a task, function or named block,
+     set the curr_funit->first_stmt pointer to this statement.
+    */
+    if( (stmt->suppl.part.head == 1) &&
+        ((curr_funit->suppl.part.type == FUNIT_TASK)        ||
+         (curr_funit->suppl.part.type == FUNIT_ATASK)       ||
+         (curr_funit->suppl.part.type == FUNIT_FUNCTION)    ||
+         (curr_funit->suppl.part.type == FUNIT_AFUNCTION)   ||
+         (curr_funit->suppl.part.type == FUNIT_NAMED_BLOCK) ||
+         (curr_funit->suppl.part.type == FUNIT_ANAMED_BLOCK)) ) {
+      curr_funit->first_stmt = stmt;
+    }
+
+    /* Find and link next_true */
+    if( true_id == id ) {
+      stmt->next_true = stmt;
+    } else if( true_id != 0 ) {
+      stmtl = stmt_link_find( true_id, curr_funit->stmt_head );
+      if( stmtl == NULL ) {
+        /* Add to statement loop queue */
+        statement_queue_add( stmt, true_id, 0 );
+      } else {
+        stmt->next_true = stmtl->stmt;
+      }
+      /* Check against statement queue */
+      statement_queue_compare( stmt );
+    }
+
+    /* Find and link next_false */
+    if( false_id == id ) {
+      stmt->next_false = stmt;
+    } else if( false_id != 0 ) {
+      stmtl = stmt_link_find( false_id, curr_funit->stmt_head );
+      if( stmtl == NULL ) {
+        statement_queue_add( stmt, false_id, 1 );
+      } else {
+        stmt->next_false = stmtl->stmt;
+      }
+      statement_queue_compare( stmt );
+    }
+
+    /* Find and link head */
+    if( head_id == id ) {
+      stmt->head = stmt;
+    } else if( head_id != 0 ) {
+      stmtl = stmt_link_find( head_id, curr_funit->stmt_head );
+      if( stmtl == NULL ) {
+        statement_queue_add( stmt, head_id, 2 );
+      } else {
+        stmt->head = stmtl->stmt;
+      }
+      statement_queue_compare( stmt );
+    }
+
+    /* Add the statement to the functional unit list */
+    stmt_link_add( stmt, TRUE, &(curr_funit->stmt_head), &(curr_funit->stmt_tail) );
+
+#ifndef RUNLIB
+    /*
+     Possibly add statement to presimulation queue (if the current functional unit is a task
+     or function, do not add this to the presimulation queue (this will be added when the expression
+     is called.
+    */
+    if( (read_mode == READ_MODE_NO_MERGE) && (stmt->suppl.part.is_called == 0) && (info_suppl.part.inlined == 0) ) {
+      sim_time tmp_time = {0,0,0,FALSE};
+      (void)sim_add_thread( NULL, stmt, curr_funit, &tmp_time );
+    }
+#endif /* RUNLIB */
+
+  }
+
+}
+
+/*!
+ \throws anonymous Throw statement_db_build
 
  Reads in the contents of the statement from the specified line, creates
  a statement structure to hold the contents.
@@ -423,107 +577,41 @@ void statement_db_read(
   int        true_id;     /* ID of root expression that is associated with the next_true statement */
   int        false_id;    /* ID of root expression that is associated with the next_false statement */
   int        head_id;
-  statement* stmt;        /* Pointer to newly created statement */
-  stmt_link* stmtl;       /* Pointer to found statement link */
-  int        chars_read;  /* Number of characters read from line */
   uint32     suppl;       /* Supplemental field value */
 
-  if( sscanf( *line, "%d %x %d %d %d%n", &id, &suppl, &true_id, &false_id, &head_id, &chars_read ) == 5 ) {
-
-    *line = *line + chars_read;
+  if( util_scan_int( line, &id, 10 ) && util_scan_uint( line, &suppl, 16 ) && util_scan_int( line, &true_id, 10 ) &&
+      util_scan_int( line, &false_id, 10 ) && util_scan_int( line, &head_id, 10 ) ) {
 
-    if( curr_funit == NULL ) {
+    statement_db_build( curr_funit, read_mode, id, suppl, true_id, false_id, head_id );
 
-      print_output( "Internal error:  statement in database written before its functional unit", FATAL, __FILE__, __LINE__ );
-      Throw 0;
-
-    } else {
-
-      /* Find associated root expression */
-      expression* exp = exp_link_find( id, curr_funit->exps, curr_funit->exp_size );
-      assert( exp != NULL );
-
-      stmt = statement_create( exp, curr_funit );
-      stmt->suppl.all = suppl;
-
-      /*
-       If this statement is a head statement and the current functional unit is a task, function or named block,
-       set the curr_funit->first_stmt pointer to this statement.
-      */
-      if( (stmt->suppl.part.head == 1) &&
-          ((curr_funit->suppl.part.type == FUNIT_TASK)        ||
-           (curr_funit->suppl.part.type == FUNIT_ATASK)       ||
-           (curr_funit->suppl.part.type == FUNIT_FUNCTION)    ||
-           (curr_funit->suppl.part.type == FUNIT_AFUNCTION)   ||
-           (curr_funit->suppl.part.type == FUNIT_NAMED_BLOCK) ||
-           (curr_funit->suppl.part.type == FUNIT_ANAMED_BLOCK)) ) {
-        curr_funit->first_stmt = stmt;
-      }
+  } else {
 
-      /* Find and link next_true */
-      if( true_id == id ) {
-        stmt->next_true = stmt;
-      } else if( true_id != 0 ) {
-        stmtl = stmt_link_find( true_id, curr_funit->stmt_head );
-        if( stmtl == NULL ) {
-          /* Add to statement loop queue */
-          statement_queue_add( stmt, true_id, 0 );
-        } else {
-          stmt->next_true = stmtl->stmt;
-        }
-        /* Check against statement queue */
-        statement_queue_compare( stmt );
-      }
+    print_output( "Unable to read statement value", FATAL, __FILE__, __LINE__ );
+    Throw 0;
 
-      /* Find and link next_false */
-      if( false_id == id ) {
-        stmt->next_false = stmt;
-      } else if( false_id != 0 ) {
-        stmtl = stmt_link_find( false_id, curr_funit->stmt_head );
-        if( stmtl == NULL ) {
-          statement_queue_add( stmt, false_id, 1 );
-        } else {
-          stmt->next_false = stmtl->stmt;
-        }
-        statement_queue_compare( stmt );
-      }
+  }
 
-      /* Find and link head */
-      if( head_id == id ) {
-        stmt->head = stmt;
-      } else if( head_id != 0 ) {
-        stmtl = stmt_link_find( head_id, curr_funit->stmt_head );
-        if( stmtl == NULL ) {
-          statement_queue_add( stmt, head_id, 2 );
-        } else {
-          stmt->head = stmtl->stmt;
-        }
-        statement_queue_compare( stmt );
-      }
+  PROFILE_END;
 
-      /* Add the statement to the functional unit list */
-      stmt_link_add( stmt, TRUE, &(curr_funit->stmt_head), &(curr_funit->stmt_tail) );
+}
 
-#ifndef RUNLIB
-      /*
-       Possibly add statement to presimulation queue (if the current functional unit is a task
-       or function, do not add this to the presimulation queue (this will be added when the expression
-       is called.
-      */
-      if( (read_mode == READ_MODE_NO_MERGE) && (stmt->suppl.part.is_called == 0) && (info_suppl.part.inlined == 0) ) {
-        sim_time tmp_time = {0,0,0,FALSE};
-        (void)sim_add_thread( NULL, stmt, curr_funit, &tmp_time );
-      }
-#endif /* RUNLIB */
+/*!
+ \throws anonymous statement_db_build db_bin_get
 
-    }
+ Reads in the contents of the statement from the specified binary CDD record (see statement_db_write_bin) and
+ creates a statement structure to hold the contents.
+*/
+void statement_db_read_bin(
+  char**     line,        /*!< Pointer to binary record to parse */
+  func_unit* curr_funit,  /*!< Pointer to current module */
+  int        read_mode    /*!< If set to REPORT, adds statement to head of list; otherwise, adds statement to tail */
+) { PROFILE(STATEMENT_DB_READ_BIN);
 
-  } else {
+  uint32 fields[5];  /* Fixed-width fields of statement record */
 
-    print_output( "Unable to read statement value", FATAL, __FILE__, __LINE__ );
-    Throw 0;
+  db_bin_get( line, fields, sizeof( fields ) );
 
-  }
+  statement_db_build( curr_funit, read_mode, (int)fields[0], fields[1], (int)fields[2], (int)fields[3], (int)fields[4] );
 
   PROFILE_END;
 
@@ -990,6 +1078,9 @@ void statement_dealloc_recursive(
     /* Disconnect statement from current functional unit */
     db_remove_statement_from_current_funit( stmt );
 
+    /* Deallocate the compiled expression program */
+    statement_dealloc_program( stmt );
+
     free_safe( stmt, sizeof( statement ) );
     
   }
@@ -1009,6 +1100,9 @@ void statement_dealloc(
 ) { PROFILE(STATEMENT_DEALLOC);
 
   if( stmt != NULL ) {
+
+    /* Deallocate the compiled expression program */
+    statement_dealloc_program( stmt );
  
     /* Finally, deallocate this statement */
     free_safe( stmt, sizeof( statement ) );
@@ -45,6 +45,13 @@ void statement_db_write(
   bool       ids_issued
 );
 
+/*! \brief Writes specified statement to the specified binary output file. */
+void statement_db_write_bin(
+  statement* stmt,
+  FILE*      ofile,
+  bool       ids_issued
+);
+
 /*! \brief Writes specified statement tree to the specified output file. */
 void statement_db_write_tree(
   statement* stmt,
@@ -64,6 +71,13 @@ void statement_db_read(
              int        read_mode
 );
 
+/*! \brief Reads in statement record from a binary database and stores statement in specified functional unit. */
+void statement_db_read_bin(
+             char**     line,
+  /*@null@*/ func_unit* curr_funit,
+             int        read_mode
+);
+
 /*! \brief Assigns unique expression IDs to each expression in the given statement block. */
 void statement_assign_expr_ids(
   statement* stmt,
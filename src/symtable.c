@@ -52,56 +52,50 @@
  VCD symbol to be used.
 
  \par The Symtable Structure
- A symtable is a tree-like structure that is used to hold three pieces of information
- that are used during the simulation phase of the score command:
+ A symtable entry is used to hold three pieces of information that are used during the
+ simulation phase of the score command:
 
  \par
- -# The name of the VCD symbol that a symtable entry represents
+ -# The VCD symbol that a symtable entry represents (implied by the entry's position)
  -# A list of pointers to signals which are represented by a VCD symbol.
  -# A temporary storage facility to hold value change information for a particular
-    VCD symbol.
+    VCD symbol.  Values are decoded into packed 4-state words as they are stored, so the
+    signals, expressions and FSMs of the symbol are assigned without re-parsing a string.
 
  \par
- The tree structure itself consists of nodes, one node per VCD symbol (with the exception
- of the root node -- this will be explained later) and each node contains an array of 94
- pointers to other nodes.  Having an array of 94 pointers allows us to use the name of the
- VCD symbol as the lookup index into the table.  Because VCD symbols are allowed to use any
- combination of printable ASCII characters, the length of a VCD symbol (even for a large
- design) is usually between 1-4 characters.  This means that finding the information for any
- given signal only takes between 0 and 3 node hops, making VCD symbol access during the
- simulation phase extremely fast.
+ VCD symbols are made up of the 94 printable ASCII characters '!' through '~', so a symbol can be
+ read as an integer written in base 94.  Dumpfile writers hand out symbols by counting (FST and LXT
+ handles are already dense integers that are turned into symbols this way), so decoding a symbol
+ yields a small, dense index.  Covered decodes each symbol once into this index and stores the
+ symtable entries in a flat array that is indexed by it.  Symbols are decoded little-endian (the
+ first character is the least significant digit) using bijective base-94 numbering, which makes
+ the index of the symbol that fstVcdID() generates for a handle equal to the handle minus one.
+ Finding the entry for a value change is then a single array access instead of one node hop per
+ symbol character, and the table costs one small entry per index instead of an array of 94 child
+ pointers per character node.
 
  \par
- The symtable is initially formed by creating a root node, the root node does not contain
- any symbol information (because the only symbol it could hold is the NULL character which
- is not an ASCII printable character).  Once the root node has been created, parsing of the
- VCD definition section begins.  When the first VCD symbol is encountered (let's say the
- character is '!'), we perform a symbol lookup by accessing the 33rd element of the root
- array (33 is the decimal form of the '!' symbol).  In this case the element is a pointer
- to NULL; therefore, a new node is created.  We then grab the next character in the VCD
- symbol name which is NULL.  Because we have hit NULL, we know that the current node that
- we are in (the newly created node) is the node for our VCD symbol.  Therefore, we initialize
- the new node with the VCD symbol information for our symbol (note that we do not need to
- store the VCD symbol string in the node because it is used as an index).  This process continues
- until we have processed all VCD symbols in the VCD file, creating a tree structure that remains
- in memory until the scoring process is complete.
+ A symbol that is longer than SYMTABLE_INDEX_CHARS characters, that contains a character outside
+ of the printable range, or whose index would leave the array mostly empty (a dumpfile writer
+ that hands out symbols sparsely) is instead placed into a small hash table that is keyed on the
+ symbol string.  Lookups check the array first and only fall back to the hash table when it is
+ not empty, so dumpfiles that use dense symbols never pay for it.
 
  \par
- When the simulation section is being parsed, VCD symbols are looked up in the same way that they
- were stored.  When we hit the NULL character in the VCD name string, we have found the node
- that contains the information for that symbol.  We then store the new value into the node.
+ When the simulation section is being parsed, VCD symbols are decoded in the same way that they
+ were stored and the new value is stored into the matching entry.
 
  \par The Timestep Array
  When a timestep is found in the VCD file, we need to perform a simulation of all signal changes
  made during that timestep.  If the symtable structure was the only structure used to find all
  signals that changed during that timestep, we would need to perform a complete traversal of the
- tree for each timestep (i.e., we would need to check every signal in the design to see if it had
+ table for each timestep (i.e., we would need to check every signal in the design to see if it had
  changed).  This is unnecessary and results in bad performance.
 
  \par
  To make this lookup of changed signals more efficient, an array called "timestep_tab" is used.  This
- array is an array of pointers to symtable tree nodes, one entry for each node in the symtable tree.
- The array is allocated after the symtable tree has been fully populated and is destroyed at the very
+ array is an array of pointers to symtable entries, one entry for each symbol added to the symtable.
+ The array is allocated after the symtable has been fully populated and is destroyed at the very
  end of the score command.
 */
 
@@ -109,6 +103,7 @@
 #include "config.h"
 #endif
 
+#include <stdio.h>
 #include <stdlib.h>
 #ifdef HAVE_STRING_H
 #include <string.h>
@@ -121,17 +116,142 @@
 #include "sim.h"
 #include "symtable.h"
 #include "util.h"
+#include "vector.h"
 #include "vsignal.h"
 
 
 extern const exp_info exp_op_info[EXP_OP_NUM];
+extern char           user_msg[USER_MSG_LENGTH];
+extern bool           debug_mode;
 
 
 /*!
- Pointer to the VCD symbol table.  Please see the file description for how this
- structure is used.
+ Maximum number of characters in a VCD symbol that is decoded into an index into the dense symbol
+ table array.  Four characters cover over 78 million symbols while keeping the index within 32 bits.
 */
-symtable* vcd_symtab = NULL;
+#define SYMTABLE_INDEX_CHARS  4
+
+/*!
+ Value returned by symtable_calc_index when a symbol does not decode into an array index.
+*/
+#define SYMTABLE_NO_INDEX     0xffffffff
+
+/*!
+ Number of array entries that may be left unused before a symbol is placed into the hash table
+ instead of growing the dense symbol table array to reach its index.
+*/
+#define SYMTABLE_DENSE_SLACK  65536
+
+/*!
+ Number of entries that the dense symbol table array is first allocated with.  The array doubles in size
+ from here as higher indices are seen, so small dumpfiles only pay for the symbols that they use.
+*/
+#define SYMTABLE_DENSE_INIT   16
+
+/*!
+ Number of bytes allocated for the value of a symbol table entry that is width bits wide.  This holds the
+ lower and upper value words of a packed 4-state value and is never smaller than a double.
+*/
+#define SYMTABLE_VALUE_SIZE(width)  (((2 * UL_SIZE(width) * sizeof( ulong )) < sizeof( double )) ? sizeof( double ) : (2 * UL_SIZE(width) * sizeof( ulong )))
+
+/*!
+ Size of a node in the 94-way character trie that the dense symbol table array replaced.  This is only
+ used to report how much memory the dense array saves.
+*/
+#define SYMTABLE_TRIE_NODE_SIZE  (sizeof( symtable ) + (94 * sizeof( symtable* )))
+
+/*!
+ Number of characters in the prefixes that are tracked in symtab_prefixes.
+*/
+#define SYMTABLE_PREFIX_CHARS  (SYMTABLE_INDEX_CHARS - 1)
+
+/*!
+ Number of distinct VCD symbols that are SYMTABLE_PREFIX_CHARS characters or less (94 + 94^2 + 94^3).
+*/
+#define SYMTABLE_PREFIX_NUM    839514
+
+
+/*!
+ Dense array of symbol table entries, indexed by the decoded VCD symbol.  Please see the file
+ description for how this structure is used.
+*/
+static symtable* symtab_array = NULL;
+
+/*!
+ Number of entries allocated in the symtab_array array.
+*/
+static unsigned int symtab_array_size = 0;
+
+/*!
+ Hash table containing the symbol table entries whose VCD symbols do not decode into symtab_array.
+*/
+static sym_hash** symtab_hash = NULL;
+
+/*!
+ Number of buckets allocated in the symtab_hash array (always a power of two).
+*/
+static unsigned int symtab_hash_size = 0;
+
+/*!
+ Number of entries stored in the symtab_hash table.
+*/
+static unsigned int symtab_hash_num = 0;
+
+/*!
+ Number of bytes allocated for the symtab_hash buckets and entries.
+*/
+static uint64 symtab_hash_bytes = 0;
+
+/*!
+ Number of distinct VCD symbols stored in the symbol table.
+*/
+static unsigned int symtab_num = 0;
+
+/*!
+ Bitmap of the VCD symbol prefixes of SYMTABLE_PREFIX_CHARS characters or less that have been seen.
+ This is used to count the nodes that a 94-way character trie would have needed for the same symbols.
+*/
+static unsigned char* symtab_prefixes = NULL;
+
+/*!
+ Number of bytes allocated in the symtab_prefixes bitmap.
+*/
+static unsigned int symtab_prefixes_size = 0;
+
+/*!
+ Number of nodes that a 94-way character trie would have needed for the symbols added so far.
+*/
+static unsigned int symtab_trie_nodes = 0;
+
+/*!
+ Number of bytes used by the symbol table lookup structures, recorded when the symbol table is
+ deallocated for reporting at the end of the score command.
+*/
+static uint64 symtab_stat_bytes = 0;
+
+/*!
+ Number of VCD symbols stored in the symbol table, recorded when the symbol table is deallocated.
+*/
+static unsigned int symtab_stat_num = 0;
+
+/*!
+ Number of trie nodes needed for the symbols in the symbol table, recorded when the symbol table is
+ deallocated.
+*/
+static unsigned int symtab_stat_trie_nodes = 0;
+
+#ifdef HAVE_SYS_TIME_H
+/*!
+ Accumulates the time spent looking up and creating symbol table entries while the dumpfile
+ definitions are read.
+*/
+static timer* symtab_timer = NULL;
+
+/*!
+ Number of microseconds spent building the symbol table, recorded when the symbol table is deallocated.
+*/
+static uint64 symtab_stat_time = 0;
+#endif
 
 /*!
  Maintains current number of nodes in the VCD symbol table.  This value is used
@@ -248,31 +368,114 @@ static void symtable_init(
 ) { PROFILE(SYMTABLE_INIT);
 
   /* Allocate and initialize the entry */
-  symtab->size     = (msb - lsb) + 2;
-  symtab->value    = (char*)malloc_safe( symtab->size );
-  symtab->value[0] = '\0';
+  symtab->width   = (msb - lsb) + 1;
+  symtab->value   = (ulong*)malloc_safe( SYMTABLE_VALUE_SIZE( symtab->width ) );
+  symtab->pending = FALSE;
+  symtab->real    = FALSE;
 
   PROFILE_END;
 
 }
 
 /*!
- \return Returns a pointer to the newly created symbol table entry.
+ \return Returns the index of the given VCD symbol in the dense symbol table array or SYMTABLE_NO_INDEX
+         if the symbol does not decode into an index.
 
- Creates a new symbol table entry and returns a pointer to the
- newly created structure.
+ Decodes the given VCD symbol as a little-endian, bijective base-94 number.  The symbol does not need
+ to be NULL-terminated.
 */
-symtable* symtable_create() { PROFILE(SYMTABLE_CREATE);
+static unsigned int symtable_calc_index(
+  const char*  sym,     /*!< VCD symbol to decode */
+  unsigned int sym_len  /*!< Number of characters in sym */
+) { PROFILE(SYMTABLE_CALC_INDEX);
+
+  unsigned int index = SYMTABLE_NO_INDEX;  /* Calculated index */
+
+  if( (sym_len > 0) && (sym_len <= SYMTABLE_INDEX_CHARS) ) {
+    unsigned int i = sym_len;
+    index = 0;
+    while( (i > 0) && (index != SYMTABLE_NO_INDEX) ) {
+      i--;
+      if( (sym[i] < '!') || (sym[i] > '~') ) {
+        index = SYMTABLE_NO_INDEX;
+      } else {
+        index = (index * 94) + (unsigned int)(sym[i] - ' ');
+      }
+    }
+    if( index != SYMTABLE_NO_INDEX ) {
+      index--;
+    }
+  }
+
+  PROFILE_END;
+
+  return( index );
+
+}
+
+/*!
+ Generates the VCD symbol that decodes to the given symbol table index.  The sym array must be able to
+ hold at least 6 characters.
+*/
+void symtable_index_to_symbol(
+  unsigned int index,  /*!< Symbol table index to generate a symbol for */
+  char*        sym     /*!< Array that will be populated with the NULL-terminated symbol */
+) { PROFILE(SYMTABLE_INDEX_TO_SYMBOL);
+
+  uint64       value = (uint64)index + 1;
+  unsigned int i     = 0;
+
+  while( value > 0 ) {
+    value--;
+    sym[i++] = (char)('!' + (value % 94));
+    value /= 94;
+  }
+  sym[i] = '\0';
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns the hash table bucket for the given symbol.
+*/
+static unsigned int symtable_hash_calc(
+  const char*  sym,     /*!< VCD symbol to hash */
+  unsigned int sym_len  /*!< Number of characters in sym */
+) { PROFILE(SYMTABLE_HASH_CALC);
 
-  symtable* symtab;  /* Pointer to new symtable entry */
-  int       i;       /* Loop iterator */
+  unsigned int hash = 2166136261u;
+  unsigned int i;
 
-  symtab             = (symtable*)malloc_safe( sizeof( symtable ) );
-  symtab->entry.sig  = NULL;
-  symtab->entry_type = 0;
-  symtab->value      = NULL;
-  for( i=0; i<94; i++ ) {
-    symtab->table[i] = NULL;
+  for( i=0; i<sym_len; i++ ) {
+    hash = (hash ^ (unsigned char)sym[i]) * 16777619u;
+  }
+
+  PROFILE_END;
+
+  return( hash & (symtab_hash_size - 1) );
+
+}
+
+/*!
+ \return Returns a pointer to the symbol table entry stored in the hash table for the given symbol,
+         if one exists; otherwise, returns NULL.
+*/
+static symtable* symtable_hash_find(
+  const char*  sym,     /*!< VCD symbol to find */
+  unsigned int sym_len  /*!< Number of characters in sym */
+) { PROFILE(SYMTABLE_HASH_FIND);
+
+  symtable* symtab = NULL;  /* Pointer to found symbol table entry */
+
+  if( symtab_hash_num > 0 ) {
+    sym_hash* curr = symtab_hash[symtable_hash_calc( sym, sym_len )];
+    while( (curr != NULL) && ((curr->sym_len != sym_len) || (memcmp( curr->sym, sym, sym_len ) != 0)) ) {
+      curr = curr->next;
+    }
+    if( curr != NULL ) {
+      symtab = &(curr->symtab);
+    }
   }
 
   PROFILE_END;
@@ -281,6 +484,133 @@ symtable* symtable_create() { PROFILE(SYMTABLE_CREATE);
 
 }
 
+/*!
+ \return Returns a pointer to the symbol table entry in the hash table for the given symbol, creating it
+         if it does not exist.
+*/
+static symtable* symtable_hash_add(
+  const char*  sym,     /*!< VCD symbol to add */
+  unsigned int sym_len  /*!< Number of characters in sym */
+) { PROFILE(SYMTABLE_HASH_ADD);
+
+  symtable* symtab;  /* Pointer to symbol table entry */
+
+  if( (symtab = symtable_hash_find( sym, sym_len )) == NULL ) {
+
+    sym_hash*    entry;
+    unsigned int bucket;
+
+    /* Double the number of buckets when the table gets full */
+    if( symtab_hash_num >= symtab_hash_size ) {
+      sym_hash**   old_hash = symtab_hash;
+      unsigned int old_size = symtab_hash_size;
+      unsigned int i;
+      symtab_hash_size = (old_size == 0) ? 64 : (old_size * 2);
+      symtab_hash      = (sym_hash**)calloc_safe( symtab_hash_size, sizeof( sym_hash* ) );
+      for( i=0; i<old_size; i++ ) {
+        while( old_hash[i] != NULL ) {
+          entry        = old_hash[i];
+          old_hash[i]  = entry->next;
+          bucket       = symtable_hash_calc( entry->sym, entry->sym_len );
+          entry->next  = symtab_hash[bucket];
+          symtab_hash[bucket] = entry;
+        }
+      }
+      free_safe( old_hash, (sizeof( sym_hash* ) * old_size) );
+      symtab_hash_bytes += (sizeof( sym_hash* ) * (symtab_hash_size - old_size));
+    }
+
+    entry                   = (sym_hash*)malloc_safe( sizeof( sym_hash ) );
+    entry->sym              = (char*)malloc_safe( sym_len + 1 );
+    entry->sym_len          = sym_len;
+    entry->symtab.entry.sig = NULL;
+    entry->symtab.entry_type = 0;
+    entry->symtab.value     = NULL;
+    entry->symtab.width     = 0;
+    entry->symtab.pending   = FALSE;
+    entry->symtab.real      = FALSE;
+    memcpy( entry->sym, sym, sym_len );
+    entry->sym[sym_len]     = '\0';
+
+    bucket              = symtable_hash_calc( sym, sym_len );
+    entry->next         = symtab_hash[bucket];
+    symtab_hash[bucket] = entry;
+    symtab_hash_num++;
+    symtab_hash_bytes  += sizeof( sym_hash ) + sym_len + 1;
+
+    symtab = &(entry->symtab);
+
+  }
+
+  PROFILE_END;
+
+  return( symtab );
+
+}
+
+/*!
+ Counts the nodes that a 94-way character trie would have created for the given new symbol (one node
+ per symbol prefix that has not been seen before).
+*/
+static void symtable_count_trie_nodes(
+  const char*  sym,     /*!< VCD symbol that was added to the symbol table */
+  unsigned int sym_len  /*!< Number of characters in sym */
+) { PROFILE(SYMTABLE_COUNT_TRIE_NODES);
+
+  unsigned int i;
+
+  for( i=1; (i<=sym_len) && (i<=SYMTABLE_PREFIX_CHARS); i++ ) {
+    unsigned int index = symtable_calc_index( sym, i );
+    if( index == SYMTABLE_NO_INDEX ) {
+      symtab_trie_nodes++;
+    } else {
+      /* Grow the bitmap to cover the prefix, doubling it to keep the number of reallocations small */
+      if( (index >> 3) >= symtab_prefixes_size ) {
+        unsigned int new_size = symtab_prefixes_size * 2;
+        if( new_size <= (index >> 3) ) {
+          new_size = (index >> 3) + 1;
+        }
+        symtab_prefixes = (unsigned char*)realloc_safe_nolimit( symtab_prefixes, symtab_prefixes_size, new_size );
+        memset( (symtab_prefixes + symtab_prefixes_size), 0, (new_size - symtab_prefixes_size) );
+        symtab_prefixes_size = new_size;
+      }
+      if( (symtab_prefixes[index >> 3] & (1 << (index & 0x7))) == 0 ) {
+        symtab_prefixes[index >> 3] |= (unsigned char)(1 << (index & 0x7));
+        symtab_trie_nodes++;
+      }
+    }
+  }
+
+  /* Longer prefixes are assumed to be unique, which is exact for symbols of up to SYMTABLE_INDEX_CHARS characters */
+  if( sym_len > SYMTABLE_PREFIX_CHARS ) {
+    symtab_trie_nodes += (sym_len - SYMTABLE_PREFIX_CHARS);
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ Initializes the symbol table, removing any previously stored symbols.  This must be called
+ before any symbols are added.
+*/
+void symtable_create() { PROFILE(SYMTABLE_CREATE);
+
+  symtab_array         = NULL;
+  symtab_array_size    = 0;
+  symtab_hash          = NULL;
+  symtab_hash_size     = 0;
+  symtab_hash_num      = 0;
+  symtab_hash_bytes    = 0;
+  symtab_num           = 0;
+  symtab_trie_nodes    = 1;  /* The trie root node */
+  symtab_prefixes      = NULL;
+  symtab_prefixes_size = 0;
+
+  PROFILE_END;
+
+}
+
 /*!
  \return Returns a pointer to the symtable to use for the new entry.
 */
@@ -288,23 +618,55 @@ static symtable* symtable_get_table(
   const char* sym  /*!< Symbol to use as a lookup mechanism into the table */
 ) { PROFILE(SYMTABLE_GET_TABLE);
 
-  symtable*   curr;  /* Pointer to current symtable entry */
-  const char* ptr;   /* Pointer to current character in sym */
+  symtable*    curr;                            /* Pointer to current symtable entry */
+  unsigned int sym_len = strlen( sym );         /* Number of characters in symbol */
+  unsigned int index   = symtable_calc_index( sym, sym_len );  /* Index of symbol in dense array */
 
-  assert( vcd_symtab != NULL );
-  assert( sym[0]     != '\0' );
+  assert( sym_len > 0 );
 
-  curr = vcd_symtab;
-  ptr  = sym;
+#ifdef HAVE_SYS_TIME_H
+  timer_start( &symtab_timer );
+#endif
 
-  while( *ptr != '\0' ) {
-    if( curr->table[(int)(*ptr) - 33] == NULL ) {
-      curr->table[(int)(*ptr) - 33] = symtable_create();
+  /* Only grow the dense array when most of it will be used */
+  if( (index < symtab_array_size) || ((index != SYMTABLE_NO_INDEX) && (((uint64)index / 4) < ((uint64)symtab_num + SYMTABLE_DENSE_SLACK))) ) {
+
+    if( index >= symtab_array_size ) {
+      unsigned int new_size = (symtab_array_size == 0) ? SYMTABLE_DENSE_INIT : symtab_array_size;
+      while( new_size <= index ) {
+        new_size *= 2;
+      }
+      symtab_array = (symtable*)realloc_safe_nolimit( symtab_array, (sizeof( symtable ) * symtab_array_size), (sizeof( symtable ) * new_size) );
+      memset( (symtab_array + symtab_array_size), 0, (sizeof( symtable ) * (new_size - symtab_array_size)) );
+      symtab_array_size = new_size;
     }
-    curr = curr->table[(int)(*ptr) - 33];
-    ptr++;
+
+    curr = &(symtab_array[index]);
+
+    /* A symbol that was placed in the hash table before the array reached it stays there */
+    if( (curr->value == NULL) && (symtab_hash_num > 0) ) {
+      symtable* hashed = symtable_hash_find( sym, sym_len );
+      if( hashed != NULL ) {
+        curr = hashed;
+      }
+    }
+
+  } else {
+
+    curr = symtable_hash_add( sym, sym_len );
+
+  }
+
+  /* Keep track of the number of distinct symbols */
+  if( curr->value == NULL ) {
+    symtab_num++;
+    symtable_count_trie_nodes( sym, sym_len );
   }
 
+#ifdef HAVE_SYS_TIME_H
+  timer_stop( &symtab_timer );
+#endif
+
   PROFILE_END;
 
   return( curr );
@@ -313,7 +675,7 @@ static symtable* symtable_get_table(
 
 /*!
  Using the symbol as a unique ID, creates a new symtable element for specified information
- and places it into the binary tree.
+ and places it into the symbol table.
 */
 void symtable_add_signal(
   const char* sym,  /*!< VCD symbol for the specified signal */
@@ -333,6 +695,7 @@ void symtable_add_signal(
     } else {
       symtable_init( curr, msb, lsb );
     }
+    curr->real = (sig->value != NULL) && (sig->value->suppl.part.data_type != VDATA_UL);
   }
 
   symtable_add_sym_sig( curr, sig, msb, lsb );
@@ -348,7 +711,7 @@ void symtable_add_signal(
 
 /*!
  Using the symbol as a unique ID, creates a new symtable element for specified information
- and places it into the binary tree.
+ and places it into the symbol table.
 */
 void symtable_add_expression(
   const char* sym,    /*!< VCD symbol for the specified signal */
@@ -388,7 +751,7 @@ void symtable_add_expression(
 
 /*!
  Using the symbol as a unique ID, creates a new symtable element for specified information and
- places it into the binary tree.
+ places it into the symbol table.
 */
 void symtable_add_memory(
   const char* sym,     /*!< VCD symbol for the specified signal */
@@ -419,7 +782,7 @@ void symtable_add_memory(
 
 /*!
  Using the symobl as a unique ID, creates a new symtable element for specified information
- and places it into the lookup tree.
+ and places it into the symbol table.
 */
 void symtable_add_fsm(
   const char* sym,    /*!< VCD symbol for the specified signal */
@@ -449,47 +812,234 @@ void symtable_add_fsm(
 }
 
 /*!
- Performs a binary search of the specified tree to find all matching symtable entries.
- When the signal is found, the specified value is assigned to the symtable entry.
+ Places the given symbol table entry into the timestep array if this is the first value stored for
+ it in the current timestep.
+*/
+static void symtable_queue_entry(
+  symtable* curr  /*!< Pointer to symbol table entry that has been set */
+) { PROFILE(SYMTABLE_QUEUE_ENTRY);
+
+  if( !curr->pending ) {
+
+    /* Place in postsim queue */
+    timestep_tab[postsim_size] = curr;
+    postsim_size++;
+    curr->pending = TRUE;
+
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ Decodes the given value into the given symbol table entry and places the entry into the timestep
+ array if this is the first value stored for it in the current timestep.  The value does not need
+ to be NULL-terminated.
+*/
+void symtable_set_value_entry(
+  symtable*    curr,      /*!< Pointer to symbol table entry to set */
+  const char*  value,     /*!< Value to set symtable entry to */
+  unsigned int value_len  /*!< Number of characters in value */
+) { PROFILE(SYMTABLE_SET_VALUE_ENTRY);
+
+  bool valid = TRUE;  /* Specifies if the value could be decoded */
+
+  if( curr->real ) {
+
+    char   buf[64];
+    char*  str = buf;
+    char*  end;
+    double real;
+
+    /* The value is not NUL-terminated, so copy it out; long values get a buffer of their own */
+    if( value_len >= sizeof( buf ) ) {
+      str = (char*)malloc_safe_nolimit( value_len + 1 );
+    }
+    memcpy( str, value, value_len );
+    str[value_len] = '\0';
+    real = strtod( str, &end );
+    if( (valid = (end != str)) ) {
+      memcpy( curr->value, &real, sizeof( double ) );
+    }
+    if( str != buf ) {
+      free_safe( str, (value_len + 1) );
+    }
+
+  } else if( (curr->width == 1) && (value_len == 1) ) {
+
+    /* Single-bit values are the common case, so decode them here */
+    char c = value[0] | 0x20;
+    curr->value[0] = ((c == '1') || (c == 'z') || (c == '?')) ? 1 : 0;
+    curr->value[1] = ((c == 'x') || (c == 'z') || (c == '?')) ? 1 : 0;
+
+  } else {
+
+    vector_decode_vcd_value( value, value_len, curr->value, (curr->value + UL_SIZE( curr->width )), curr->width );
+
+  }
+
+  if( valid ) {
+    symtable_queue_entry( curr );
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ Stores the given packed 4-state value into the given symbol table entry and places the entry into the
+ timestep array if this is the first value stored for it in the current timestep.  This allows value
+ sources that already hold the value in binary form (VPI) to skip formatting and decoding a string.
+ The value is ignored if the entry belongs to a real signal.
+*/
+void symtable_set_value_ulong(
+  symtable*    curr,   /*!< Pointer to symbol table entry to set */
+  const ulong* vall,   /*!< Lower value array of packed value */
+  const ulong* valh,   /*!< Upper value array of packed value */
+  unsigned int width   /*!< Number of bits in packed value */
+) { PROFILE(SYMTABLE_SET_VALUE_ULONG);
+
+  unsigned int size  = UL_SIZE( curr->width );
+  unsigned int num   = UL_SIZE( (width < curr->width) ? width : curr->width );
+  ulong*       tvall = curr->value;
+  ulong*       tvalh = curr->value + size;
+  unsigned int i;
+
+  if( !curr->real ) {
+
+    for( i=0; i<num; i++ ) {
+      tvall[i] = vall[i];
+      tvalh[i] = valh[i];
+    }
+    for( ; i<size; i++ ) {
+      tvall[i] = 0;
+      tvalh[i] = 0;
+    }
+
+    symtable_queue_entry( curr );
+
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ Stores the given real value into the given symbol table entry and places the entry into the timestep array
+ if this is the first value stored for it in the current timestep.  The value is ignored if the entry does
+ not belong to a real signal.
+*/
+void symtable_set_value_real(
+  symtable* curr,  /*!< Pointer to symbol table entry to set */
+  double    real   /*!< Value to set symtable entry to */
+) { PROFILE(SYMTABLE_SET_VALUE_REAL);
+
+  if( curr->real ) {
+    memcpy( curr->value, &real, sizeof( double ) );
+    symtable_queue_entry( curr );
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ Decodes the specified symbol and, if a matching symtable entry exists, assigns the specified value to it.
+ Neither the symbol nor the value need to be NULL-terminated, allowing both to point directly into
+ the dumpfile read buffer.
+*/
+void symtable_set_value_slice(
+  const char*  sym,        /*!< Name of symbol to find in the table */
+  unsigned int sym_len,    /*!< Number of characters in sym */
+  const char*  value,      /*!< Value to set symtable entry to when match found */
+  unsigned int value_len   /*!< Number of characters in value */
+) { PROFILE(SYMTABLE_SET_VALUE_SLICE);
+
+  unsigned int index = symtable_calc_index( sym, sym_len );  /* Index of symbol in dense array */
+  symtable*    curr  = NULL;                                 /* Pointer to matching symtable entry */
+
+  assert( sym_len > 0 );
+
+  if( index < symtab_array_size ) {
+    curr = &(symtab_array[index]);
+  }
+
+  if( ((curr == NULL) || (curr->value == NULL)) && (symtab_hash_num > 0) ) {
+    curr = symtable_hash_find( sym, sym_len );
+  }
+
+  if( (curr != NULL) && (curr->value != NULL) ) {
+    symtable_set_value_entry( curr, value, value_len );
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ Finds the symtable entry matching the specified symbol and, if one exists, assigns the
+ specified value to it.
 */
 void symtable_set_value(
   const char* sym,   /*!< Name of symbol to find in the table */
   const char* value  /*!< Value to set symtable entry to when match found */
 ) { PROFILE(SYMTABLE_SET_VALUE);
 
-  symtable*   curr;         /* Pointer to current symtable */
-  const char* ptr;          /* Pointer to current character in symbol */
-  bool        set = FALSE;  /* Specifies if this symtable entry has been set this timestep yet */
+  symtable_set_value_slice( sym, strlen( sym ), value, strlen( value ) );
 
-  assert( vcd_symtab != NULL );
-  assert( sym[0] != '\0' );
+  PROFILE_END;
 
-  curr = vcd_symtab;
-  ptr  = sym;
+}
 
-  while( (curr != NULL) && (*ptr != '\0') ) {
-    curr = curr->table[(int)(*ptr) - 33];
-    ptr++;
+/*!
+ \return Returns a pointer to the symtable entry at the given index or NULL if no signal, expression
+         or FSM was added for it.
+
+ Dumpfile readers that identify signals by dense integer handles (FST and LXT) can use this to resolve
+ each handle to its symtable entry once, after the definitions have been read.
+*/
+symtable* symtable_get_index(
+  unsigned int index  /*!< Index of symbol in table (as decoded from its VCD symbol) */
+) { PROFILE(SYMTABLE_GET_INDEX);
+
+  symtable* curr = NULL;  /* Pointer to matching symtable entry */
+
+  if( index < symtab_array_size ) {
+    curr = &(symtab_array[index]);
   }
 
-  if( (curr != NULL) && (curr->value != NULL) ) {
+  if( ((curr == NULL) || (curr->value == NULL)) && (symtab_hash_num > 0) ) {
+    char sym[8];
+    symtable_index_to_symbol( index, sym );
+    curr = symtable_hash_find( sym, strlen( sym ) );
+  }
 
-    if( curr->value[0] != '\0' ) {
-      set = TRUE;
-    }
+  if( (curr != NULL) && (curr->value == NULL) ) {
+    curr = NULL;
+  }
 
-    /* printf( "strlen( value ): %d, curr->size: %d\n", strlen( value ), curr->size ); */
-    assert( strlen( value ) < curr->size );     /* Useful for debugging but not necessary */
-    strcpy( curr->value, value );
+  PROFILE_END;
 
-    if( !set ) {
+  return( curr );
 
-      /* Place in postsim queue */
-      timestep_tab[postsim_size] = curr;
-      postsim_size++;
-   
-    }
+}
+
+/*!
+ Assigns the specified value to the symtable entry at the given index, if one exists.  This allows
+ dumpfile readers that identify signals by dense integer handles (LXT) to skip generating and
+ decoding VCD symbols for every value change.  The value does not need to be NULL-terminated.
+*/
+void symtable_set_value_index(
+  unsigned int index,     /*!< Index of symbol in table (as decoded from its VCD symbol) */
+  const char*  value,     /*!< Value to set symtable entry to when match found */
+  unsigned int value_len  /*!< Number of characters in value */
+) { PROFILE(SYMTABLE_SET_VALUE_INDEX);
 
+  symtable* curr = symtable_get_index( index );  /* Pointer to matching symtable entry */
+
+  if( curr != NULL ) {
+    symtable_set_value_entry( curr, value, value_len );
   }
 
   PROFILE_END;
@@ -499,7 +1049,7 @@ void symtable_set_value(
 /*!
  \throws anonymous vsignal_vcd_assign
 
- Traverses simulation symentry array, assigning stored string value to the
+ Traverses simulation symentry array, assigning stored packed value to the
  stored signal.
 */
 void symtable_assign(
@@ -510,23 +1060,27 @@ void symtable_assign(
   int       i;     /* Loop iterator */
 
   for( i=0; i<postsim_size; i++ ) {
+    const ulong* vall;
+    const ulong* valh;
     curr = timestep_tab[i];
+    vall = curr->value;
+    valh = curr->value + UL_SIZE( curr->width );
     if( curr->entry_type == 1 ) {
       sym_sig* sig = curr->entry.sig;
       while( sig != NULL ) {
-        vsignal_vcd_assign( sig->sig, curr->value, sig->msb, sig->lsb, time );
+        vsignal_vcd_assign( sig->sig, vall, valh, curr->width, sig->msb, sig->lsb, time );
         sig = sig->next;
       }
     } else if( curr->entry_type == 2 ) {
       sym_exp* exp = curr->entry.exp;
       while( exp != NULL ) {
-        expression_vcd_assign( exp->exp, exp->action, curr->value );
+        expression_vcd_assign( exp->exp, exp->action, vall, valh, curr->width );
         exp = exp->next;
       }
     } else if( curr->entry_type == 3 ) {
-      fsm_vcd_assign( curr->entry.table, curr->value );
+      fsm_vcd_assign( curr->entry.table, vall, valh, curr->width );
     }
-    curr->value[0] = '\0';
+    curr->pending = FALSE;
   }
   postsim_size = 0;
 
@@ -535,57 +1089,139 @@ void symtable_assign(
 }
 
 /*!
- Recursively deallocates all elements of specifies symbol table.
-*/ 
-void symtable_dealloc(
-  symtable* symtab  /*!< Pointer to root of symtable to clear */
-) { PROFILE(SYMTABLE_DEALLOC);
+ Deallocates the value and signal/expression list of the specified symbol table entry.
+*/
+static void symtable_dealloc_entry(
+  symtable* symtab  /*!< Pointer to symtable entry to clear */
+) { PROFILE(SYMTABLE_DEALLOC_ENTRY);
+
+  if( symtab->value != NULL ) {
+    free_safe( symtab->value, SYMTABLE_VALUE_SIZE( symtab->width ) );
+  }
 
-  if( symtab != NULL ) {
+  if( symtab->entry_type == 1 ) {
 
-    int i;
+    sym_sig* curr;
+    sym_sig* tmp;
 
-    for( i=0; i<94; i++ ) {
-      symtable_dealloc( symtab->table[i] );
+    /* Remove sym_sig list */
+    curr = symtab->entry.sig;
+    while( curr != NULL ) {
+      tmp = curr->next;
+      free_safe( curr, sizeof( sym_sig ) );
+      curr = tmp;
     }
 
-    if( symtab->value != NULL ) {
-      free_safe( symtab->value, symtab->size );
+  } else if( symtab->entry_type == 2 ) {
+
+    sym_exp* curr;
+    sym_exp* tmp;
+
+    /* Remove sym_exp list */
+    curr = symtab->entry.exp;
+    while( curr != NULL ) {
+      tmp = curr->next;
+      free_safe( curr, sizeof( sym_exp ) );
+      curr = tmp;
     }
 
-    if( symtab->entry_type == 1 ) {
+  }
 
-      sym_sig* curr;
-      sym_sig* tmp;
+  PROFILE_END;
 
-      /* Remove sym_sig list */
-      curr = symtab->entry.sig;
-      while( curr != NULL ) {
-        tmp = curr->next;
-        free_safe( curr, sizeof( sym_sig ) );
-        curr = tmp;
-      }
+}
 
-    } else if( symtab->entry_type == 2 ) {
+/*!
+ Deallocates all elements of the symbol table, recording its size for symtable_display_stats.
+*/ 
+void symtable_dealloc() { PROFILE(SYMTABLE_DEALLOC);
 
-      sym_exp* curr;
-      sym_exp* tmp;
+  unsigned int i;
 
-      /* Remove sym_exp list */
-      curr = symtab->entry.exp;
-      while( curr != NULL ) {
-        tmp = curr->next;
-        free_safe( curr, sizeof( sym_exp ) );
-        curr = tmp;
-      }
+  /* Record statistics for the end of the score command */
+  if( symtab_num > 0 ) {
+    symtab_stat_bytes      = (sizeof( symtable ) * (uint64)symtab_array_size) + symtab_hash_bytes;
+    symtab_stat_num        = symtab_num;
+    symtab_stat_trie_nodes = symtab_trie_nodes;
+  }
 
+#ifdef HAVE_SYS_TIME_H
+  if( symtab_timer != NULL ) {
+    symtab_stat_time = symtab_timer->total;
+    free_safe( symtab_timer, sizeof( timer ) );
+    symtab_timer = NULL;
+  }
+#endif
+
+  for( i=0; i<symtab_array_size; i++ ) {
+    symtable_dealloc_entry( &(symtab_array[i]) );
+  }
+  free_safe( symtab_array, (sizeof( symtable ) * symtab_array_size) );
+
+  for( i=0; i<symtab_hash_size; i++ ) {
+    while( symtab_hash[i] != NULL ) {
+      sym_hash* tmp = symtab_hash[i];
+      symtab_hash[i] = tmp->next;
+      symtable_dealloc_entry( &(tmp->symtab) );
+      free_safe( tmp->sym, (tmp->sym_len + 1) );
+      free_safe( tmp, sizeof( sym_hash ) );
     }
+  }
+  free_safe( symtab_hash, (sizeof( sym_hash* ) * symtab_hash_size) );
 
-    free_safe( symtab, sizeof( symtable ) );
+  free_safe( symtab_prefixes, symtab_prefixes_size );
 
-  }
+  symtab_array         = NULL;
+  symtab_array_size    = 0;
+  symtab_hash          = NULL;
+  symtab_hash_size     = 0;
+  symtab_hash_num      = 0;
+  symtab_hash_bytes    = 0;
+  symtab_num           = 0;
+  symtab_prefixes      = NULL;
+  symtab_prefixes_size = 0;
 
   PROFILE_END;
 
 }
 
+/*!
+ Outputs the number of symbols that were stored in the symbol table and the memory used for looking
+ them up.  When the dense array needed less memory than the 94-way character trie that it replaced
+ would have for the same symbols (or when Covered is running in debug mode), the trie size and the
+ time spent building the table are also output.
+*/
+void symtable_display_stats() { PROFILE(SYMTABLE_DISPLAY_STATS);
+
+  if( symtab_stat_num > 0 ) {
+
+    uint64       trie_bytes = (uint64)symtab_stat_trie_nodes * SYMTABLE_TRIE_NODE_SIZE;
+    unsigned int rv;
+
+    /*@-duplicatequals -formattype -formatcode@*/
+    if( (trie_bytes > symtab_stat_bytes) || debug_mode ) {
+      rv = snprintf( user_msg, USER_MSG_LENGTH, "Symbol table:               %u symbols in %" FMT64 "u bytes (94-way trie: %u nodes in %" FMT64 "u bytes)",
+                     symtab_stat_num, symtab_stat_bytes, symtab_stat_trie_nodes, trie_bytes );
+    } else {
+      rv = snprintf( user_msg, USER_MSG_LENGTH, "Symbol table:               %u symbols in %" FMT64 "u bytes", symtab_stat_num, symtab_stat_bytes );
+    }
+    /*@=duplicatequals =formattype =formatcode@*/
+    assert( rv < USER_MSG_LENGTH );
+    print_output( user_msg, NORMAL, __FILE__, __LINE__ );
+
+#ifdef HAVE_SYS_TIME_H
+    if( (trie_bytes > symtab_stat_bytes) || debug_mode ) {
+      timer build_time;
+      build_time.total = symtab_stat_time;
+      rv = snprintf( user_msg, USER_MSG_LENGTH, "Symbol table build time:    %s (%u trie node allocations avoided)",
+                     timer_to_string( &build_time ), symtab_stat_trie_nodes );
+      assert( rv < USER_MSG_LENGTH );
+      print_output( user_msg, NORMAL, __FILE__, __LINE__ );
+    }
+#endif
+
+  }
+
+  PROFILE_END;
+
+}
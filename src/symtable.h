@@ -26,8 +26,14 @@
 #include "defines.h"
 
 
-/*! \brief Creates a new symtable structure. */
-symtable* symtable_create();
+/*! \brief Initializes the symbol table. */
+void symtable_create();
+
+/*! \brief Generates the VCD symbol that decodes to the given symbol table index. */
+void symtable_index_to_symbol(
+  unsigned int index,
+  char*        sym
+);
 
 /*! \brief Creates a new symtable entry and adds it to the specified symbol table. */
 void symtable_add_signal(
@@ -66,15 +72,57 @@ void symtable_set_value(
   const char* value
 );
 
+/*! \brief Sets all matching symtable entries to specified value, given as non-terminated character slices */
+void symtable_set_value_slice(
+  const char*  sym,
+  unsigned int sym_len,
+  const char*  value,
+  unsigned int value_len
+);
+
+/*! \brief Returns the symtable entry at the given index, if one exists */
+symtable* symtable_get_index(
+  unsigned int index
+);
+
+/*! \brief Sets the given symtable entry to specified value */
+void symtable_set_value_entry(
+  symtable*    symtab,
+  const char*  value,
+  unsigned int value_len
+);
+
+/*! \brief Sets the given symtable entry to specified packed 4-state value */
+void symtable_set_value_ulong(
+  symtable*    symtab,
+  const ulong* vall,
+  const ulong* valh,
+  unsigned int width
+);
+
+/*! \brief Sets the given symtable entry to specified real value */
+void symtable_set_value_real(
+  symtable* symtab,
+  double    real
+);
+
+/*! \brief Sets the symtable entry at the given index to specified value */
+void symtable_set_value_index(
+  unsigned int index,
+  const char*  value,
+  unsigned int value_len
+);
+
 /*! \brief Assigns stored values to all associated signals stored in specified symbol table. */
 void symtable_assign(
   const sim_time* time
 );
 
-/*! \brief Deallocates all symtable entries for specified symbol table. */
-void symtable_dealloc(
-  symtable* symtab
-);
+/*! \brief Deallocates all symtable entries. */
+void symtable_dealloc();
+
+/*! \brief Outputs the size and build time of the last symbol table. */
+void symtable_display_stats();
 
 #endif
 
@@ -99,6 +99,11 @@ static funit_inst** gui_inst_list = NULL;
 */
 static int gui_inst_index = 0;
 
+/*!
+ Set to TRUE when the instance database has been loaded and gui_inst_list has been populated.
+*/
+static bool gui_inst_ready = FALSE;
+
 
 /*!
  \return Returns TCL_OK if there are no errors encountered when running this command; otherwise, returns
@@ -185,6 +190,41 @@ int tcl_func_get_instances(
 
 }
 
+/*!
+ \return Returns TRUE if the instance database was successfully loaded; otherwise, returns FALSE.
+
+ The instance database of a CDD file opened in the GUI is not loaded until the user first needs it (see
+ report_ready_instances).  This function loads it (if it has not been loaded yet) and populates the list
+ of instances that are looked up for coverage purposes.
+*/
+static bool tcl_func_ready_instances(
+  Tcl_Interp* tcl  /*!< Pointer to the Tcl interpreter */
+) { PROFILE(TCL_FUNC_READY_INSTANCES);
+
+  bool retval = TRUE;  /* Return value for this function */
+
+  Try {
+    report_ready_instances();
+  } Catch_anonymous {
+    retval = FALSE;
+  }
+
+  /* Gather the functional unit instances */
+  if( retval && !gui_inst_ready ) {
+    inst_link* instl = db_list[0]->inst_head;
+    while( instl != NULL ) {
+      tcl_func_get_instances( tcl, instl->inst );
+      instl = instl->next;
+    }
+    gui_inst_ready = TRUE;
+  }
+
+  PROFILE_END;
+
+  return( retval );
+
+}
+
 /*!
  \return Returns TCL_OK if there are no errors encountered when running this command; otherwise, returns
          TCL_ERROR.
@@ -203,10 +243,19 @@ int tcl_func_get_instance_list(
   int        i;                /* Loop iterator */
   char       str[30];          /* Temporary string */
 
-  /* Create the functional unit list */
-  for( i=0; i<gui_inst_index; i++ ) {
-    snprintf( str, 30, "%d 1", i );
-    Tcl_AppendElement( tcl, str );
+  /* Load the instance database if this is the first time that it is needed */
+  if( tcl_func_ready_instances( tcl ) ) {
+
+    /* Create the functional unit list */
+    for( i=0; i<gui_inst_index; i++ ) {
+      snprintf( str, 30, "%d 1", i );
+      Tcl_AppendElement( tcl, str );
+    }
+
+  } else {
+
+    retval = TCL_ERROR;
+
   }
 
   return( retval );
@@ -1623,7 +1672,6 @@ int tcl_func_open_cdd(
   if( argv[1][0] != '\0' ) {
 
     funit_link* funitl;
-    inst_link*  instl;
 
     ifile = strdup_safe( argv[1] );
 
@@ -1635,12 +1683,7 @@ int tcl_func_open_cdd(
 
     free_safe( ifile, (strlen( ifile ) + 1) );
 
-    /* Gather the functional unit instances */
-    instl = db_list[0]->inst_head;
-    while( instl != NULL ) {
-      tcl_func_get_instances( tcl, instl->inst );
-      instl = instl->next;
-    }
+    /* The functional unit instances are gathered when the instance database is first needed */
 
     /* Gather the functional units */
     funitl = db_list[1]->funit_head;
@@ -1686,6 +1729,7 @@ int tcl_func_close_cdd(
     free_safe( gui_inst_list,  (sizeof( funit_inst* ) * gui_inst_index) );
     gui_inst_list  = NULL;
     gui_inst_index = 0;
+    gui_inst_ready = FALSE;
 
   } Catch_anonymous {
     retval = TCL_ERROR;
@@ -1773,6 +1817,11 @@ int tcl_func_merge_cdd(
       retval = TCL_ERROR;
     }
 
+    /* If the instance database has already been loaded, merge the CDD file into it now */
+    if( (retval == TCL_OK) && gui_inst_ready && !tcl_func_ready_instances( tcl ) ) {
+      retval = TCL_ERROR;
+    }
+
   }
 
   return( retval );
@@ -2322,6 +2371,9 @@ int tcl_func_set_line_exclude(
 
       unsigned int i;
 
+      /* Make sure that the instance database is loaded before its exclusions are modified */
+      (void)tcl_func_ready_instances( tcl );
+
       /* Set the line exclusion value for the functional unit database */
       exclude_set_line_exclude( funit, line, value, ((reason != NULL) ? strdup_safe( reason ) : NULL), TRUE, TRUE, funit->stat );
 
@@ -2420,6 +2472,9 @@ int tcl_func_set_toggle_exclude(
 
       unsigned int i;
 
+      /* Make sure that the instance database is loaded before its exclusions are modified */
+      (void)tcl_func_ready_instances( tcl );
+
       /* Set the toggle exclusion value for the functional unit database */
       exclude_set_toggle_exclude( funit, sig_name, value, 'T', ((reason != NULL) ? strdup_safe( reason ) : NULL), funit->stat );
 
@@ -2519,6 +2574,9 @@ int tcl_func_set_memory_exclude(
 
       unsigned int i;
 
+      /* Make sure that the instance database is loaded before its exclusions are modified */
+      (void)tcl_func_ready_instances( tcl );
+
       /* Set the memory exclusion value for the functional unit database */
       exclude_set_toggle_exclude( funit, sig_name, value, 'M', ((reason != NULL) ? strdup_safe( reason ) : NULL), funit->stat );
 
@@ -2621,6 +2679,9 @@ int tcl_func_set_comb_exclude(
     
       unsigned int i;
 
+      /* Make sure that the instance database is loaded before its exclusions are modified */
+      (void)tcl_func_ready_instances( tcl );
+
       /* Set the combinational logic exclusion value for the functional unit database */
       exclude_set_comb_exclude( funit, expr_id, uline_id, value, ((reason != NULL) ? strdup_safe( reason ) : NULL), TRUE, TRUE, funit->stat );
 
@@ -2723,6 +2784,9 @@ int tcl_func_set_fsm_exclude(
 
       unsigned int i;
 
+      /* Make sure that the instance database is loaded before its exclusions are modified */
+      (void)tcl_func_ready_instances( tcl );
+
       /* Set the combinational logic exclusion value for the functional unit database */
       exclude_set_fsm_exclude( funit, expr_id, from_state, to_state, value, ((reason != NULL) ? strdup_safe( reason ) : NULL), funit->stat );
 
@@ -2825,6 +2889,9 @@ int tcl_func_set_assert_exclude(
 
       unsigned int i;
 
+      /* Make sure that the instance database is loaded before its exclusions are modified */
+      (void)tcl_func_ready_instances( tcl );
+
       /* Set the combinational logic exclusion value for the functional unit database */
       curr_db = 1;
       exclude_set_assert_exclude( funit, inst_name, expr_id, value, ((reason != NULL) ? strdup_safe( reason ) : NULL), TRUE, TRUE, funit->stat );
@@ -2931,8 +2998,13 @@ int tcl_func_generate_report(
 
       report_print_header( ofile );
 
-      /* Set the current database correctly */
-      curr_db = report_instance ? 0 : 1;
+      /* Set the current database correctly (loading the instance database if it is needed) */
+      if( report_instance ) {
+        report_ready_instances();
+        curr_db = 0;
+      } else {
+        curr_db = 1;
+      }
 
       /* Call out the proper reports for the specified metrics to report */
       if( report_line ) {
@@ -793,7 +793,9 @@ bool file_exists(
  \return Returns FALSE if feof is encountered; otherwise, returns TRUE.
 
  Reads in a single line of information from the specified file and returns a string
- containing the read line to the calling function.
+ containing the read line to the calling function.  The line is read in blocks with fgets()
+ directly into the specified line buffer (which is reused between calls), so only lines that
+ do not fit into the current buffer cause it to be reallocated.
 */
 bool util_readline(
             FILE*         file,      /*!< File to read next line from */
@@ -801,36 +803,165 @@ bool util_readline(
   /*@out@*/ unsigned int* line_size  /*!< Pointer to number of characters allocated for line */
 ) { PROFILE(UTIL_READLINE);
 
-  char         c;      /* Character recently read from file */
-  unsigned int i = 0;  /* Current index of line */
+  unsigned int i   = 0;      /* Current index of line */
+  bool         eol = FALSE;  /* Set to TRUE when the newline character has been read */
 
   if( *line == NULL ) {
     *line_size = 128;
     *line      = (char*)malloc_safe( *line_size );
   }
 
-  while( !feof( file ) && ((c = (char)fgetc( file )) != '\n') ) {
+  while( !eol && (fgets( (*line + i), (*line_size - i), file ) != NULL) ) {
 
-    if( i == (*line_size - 1) ) {
+    i += strlen( *line + i );
+
+    if( (i > 0) && ((*line)[i-1] == '\n') ) {
+      (*line)[i-1] = '\0';
+      eol          = TRUE;
+    } else if( i == (*line_size - 1) ) {
       *line_size *= 2;
       *line       = (char*)realloc_safe( *line, (*line_size / 2), *line_size );
     }
 
-    (*line)[i] = c;
-    i++;
-
   }
 
-  if( !feof( file ) ) {
-    (*line)[i] = '\0';
-  } else {
+  /* A partial line at the end of the file is dropped */
+  if( !eol ) {
     free_safe( *line, *line_size );
     *line = NULL;
   }
 
   PROFILE_END;
 
-  return( !feof( file ) );
+  return( eol );
+
+}
+
+/*!
+ \return Returns TRUE if an integer value was parsed from the specified line; otherwise, returns FALSE.
+
+ Parses a signed integer value of the given base from the specified line (skipping any leading whitespace)
+ and advances the line pointer past the parsed value.  This is a fast replacement for sscanf( "%d%n" ).
+*/
+bool util_scan_int(
+            char** line,   /*!< Pointer to line to parse (advanced past the parsed value) */
+  /*@out@*/ int*   value,  /*!< Set to the parsed value */
+            int    base    /*!< Base of the value to parse (10 or 16) */
+) { PROFILE(UTIL_SCAN_INT);
+
+  bool  retval = FALSE;  /* Return value for this function */
+  char* end;             /* Pointer to the first character after the parsed value */
+
+  *value = (int)strtol( *line, &end, base );
+
+  if( end != *line ) {
+    *line  = end;
+    retval = TRUE;
+  }
+
+  PROFILE_END;
+
+  return( retval );
+
+}
+
+/*!
+ \return Returns TRUE if an unsigned integer value was parsed from the specified line; otherwise, returns FALSE.
+
+ Parses an unsigned integer value of the given base from the specified line (skipping any leading whitespace)
+ and advances the line pointer past the parsed value.  This is a fast replacement for sscanf( "%u%n" ) and
+ sscanf( "%x%n" ).
+*/
+bool util_scan_uint(
+            char**        line,   /*!< Pointer to line to parse (advanced past the parsed value) */
+  /*@out@*/ unsigned int* value,  /*!< Set to the parsed value */
+            int           base    /*!< Base of the value to parse (10 or 16) */
+) { PROFILE(UTIL_SCAN_UINT);
+
+  bool  retval = FALSE;  /* Return value for this function */
+  char* end;             /* Pointer to the first character after the parsed value */
+
+  *value = (unsigned int)strtoul( *line, &end, base );
+
+  if( end != *line ) {
+    *line  = end;
+    retval = TRUE;
+  }
+
+  PROFILE_END;
+
+  return( retval );
+
+}
+
+/*!
+ \return Returns TRUE if an unsigned long value was parsed from the specified line; otherwise, returns FALSE.
+
+ Parses an unsigned long value of the given base from the specified line (skipping any leading whitespace)
+ and advances the line pointer past the parsed value.  This is a fast replacement for sscanf( "%lx%n" ).
+*/
+bool util_scan_ulong(
+            char**         line,   /*!< Pointer to line to parse (advanced past the parsed value) */
+  /*@out@*/ unsigned long* value,  /*!< Set to the parsed value */
+            int            base    /*!< Base of the value to parse (10 or 16) */
+) { PROFILE(UTIL_SCAN_ULONG);
+
+  bool  retval = FALSE;  /* Return value for this function */
+  char* end;             /* Pointer to the first character after the parsed value */
+
+  *value = strtoul( *line, &end, base );
+
+  if( end != *line ) {
+    *line  = end;
+    retval = TRUE;
+  }
+
+  PROFILE_END;
+
+  return( retval );
+
+}
+
+/*!
+ \return Returns a pointer to the next whitespace-delimited token of the specified line or NULL if the
+         line does not contain any more tokens.
+
+ Destructively tokenizes the specified line.  Leading whitespace is skipped, the whitespace character
+ following the token is overwritten with a NUL character and the line pointer is advanced past it.  The
+ returned token points into the line buffer, so it is only valid until the line buffer is reused.  This
+ is a fast replacement for sscanf( "%s%n" ) that does not copy the token.
+*/
+char* util_scan_token(
+  char** line  /*!< Pointer to line to parse (advanced past the token) */
+) { PROFILE(UTIL_SCAN_TOKEN);
+
+  char* token = *line;  /* Pointer to start of the token */
+  char* end;            /* Pointer to the character following the token */
+
+  while( isspace( (unsigned char)*token ) ) token++;
+
+  if( *token == '\0' ) {
+
+    *line = token;
+    token = NULL;
+
+  } else {
+
+    end = token;
+    while( (*end != '\0') && !isspace( (unsigned char)*end ) ) end++;
+
+    if( *end != '\0' ) {
+      *end  = '\0';
+      *line = end + 1;
+    } else {
+      *line = end;
+    }
+
+  }
+
+  PROFILE_END;
+
+  return( token );
 
 }
 
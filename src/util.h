@@ -148,6 +148,32 @@ bool util_readline(
   /*@out@*/ unsigned int*   line_size
 );
 
+/*! \brief Parses a signed integer value from the specified line and advances the line past it. */
+bool util_scan_int(
+            char** line,
+  /*@out@*/ int*   value,
+            int    base
+);
+
+/*! \brief Parses an unsigned integer value from the specified line and advances the line past it. */
+bool util_scan_uint(
+            char**        line,
+  /*@out@*/ unsigned int* value,
+            int           base
+);
+
+/*! \brief Parses an unsigned long value from the specified line and advances the line past it. */
+bool util_scan_ulong(
+            char**         line,
+  /*@out@*/ unsigned long* value,
+            int            base
+);
+
+/*! \brief Destructively returns the next whitespace-delimited token of the specified line. */
+char* util_scan_token(
+  char** line
+);
+
 /*! \brief Reads in line from file and returns the contents of the quoted string following optional whitespace */
 bool get_quoted_string(
             FILE* file,
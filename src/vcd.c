@@ -38,7 +38,6 @@
 
 
 extern char       user_msg[USER_MSG_LENGTH];
-extern symtable*  vcd_symtab;
 extern int        vcd_symtab_size;
 extern symtable** timestep_tab;
 
@@ -474,7 +473,7 @@ void vcd_parse(
     unsigned int rv;
 
     /* Create initial symbol table */
-    vcd_symtab = symtable_create();
+    symtable_create();
 
     Try {
 
@@ -488,7 +487,7 @@ void vcd_parse(
       vcd_parse_sim( vcd_handle );
 
     } Catch_anonymous {
-      symtable_dealloc( vcd_symtab );
+      symtable_dealloc();
       free_safe( timestep_tab, (sizeof( symtable*) * vcd_symtab_size) );
       rv = fclose( vcd_handle );
       assert( rv == 0 );
@@ -496,7 +495,7 @@ void vcd_parse(
     }
 
     /* Deallocate memory */
-    symtable_dealloc( vcd_symtab );
+    symtable_dealloc();
     free_safe( timestep_tab, (sizeof( symtable*) * vcd_symtab_size) );
 
     /* Close VCD file */
@@ -30,6 +30,20 @@
 #ifdef HAVE_STRING_H
 #include <string.h>
 #endif
+#include <sys/types.h>
+#ifdef HAVE_SYS_MMAN_H
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+/* The pipelined reader needs POSIX threads and atomic builtins; the profiler is not thread-safe */
+#if defined(HAVE_PTHREAD_H) && defined(HAVE_LIBPTHREAD) && defined(__ATOMIC_ACQUIRE) && !defined(PROFILER)
+#define VCD_PIPELINE
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#endif
 
 #include "defines.h"
 #include "vcd.new.h"
@@ -63,12 +77,59 @@
 */
 #define vcd_append_token(vcd, new_start) vcd_get_token1( vcd, (new_start = (vcd_yylen + 1)) )
 
+/*!
+ Specifies the number of bytes of the dumpfile that are mapped into memory at a time.
+*/
+#define VCD_MAP_WINDOW   (256 * 1024 * 1024)
+
+/*!
+ Specifies the byte size of the buffer that the simulation portion of the dumpfile is read into when
+ it cannot be mapped.  This is also the largest token that can be read.
+*/
+#define VCD_WIN_BUFSIZE  (4 * 1024 * 1024)
+
+
+#ifdef VCD_PIPELINE
+/*!
+ Specifies the number of batches in the ring buffer between the VCD reader thread and the simulation thread.
+*/
+#define VCD_PIPE_BATCHES      8
+
+/*!
+ Specifies the byte size of each batch of records passed from the VCD reader thread to the simulation thread.
+*/
+#define VCD_PIPE_BATCH_SIZE   (1024 * 1024)
+
+/*!
+ \addtogroup vcd_pipe_records VCD pipeline record types
+
+ The following defines specify the types of records that the VCD reader thread passes to the simulation thread.
+
+ @{
+*/
+
+/*! Value change; the record holds the symbol followed by the value string */
+#define VCD_PIPE_VALUE        0
+
+/*! Timestep; the record holds the 64-bit timestep value */
+#define VCD_PIPE_TIME         1
+
+/*! Read error; the record holds the error message */
+#define VCD_PIPE_ERROR        2
+
+/*! End of the VCD file; the record holds no data */
+#define VCD_PIPE_END          3
+
+/*! @} */
+#endif
+
 extern char       user_msg[USER_MSG_LENGTH];
-extern symtable*  vcd_symtab;
 extern int        vcd_symtab_size;
 extern symtable** timestep_tab;
 extern char**     curr_inst_scope;
 extern int        curr_inst_scope_size;
+extern bool       flag_vcd_stdio;
+extern bool       flag_vcd_pipeline;
 
 /*!
  Pointer to start of VCD read buffer.
@@ -100,6 +161,95 @@ static int vcd_yytext_size = 0;
 */
 static int vcd_yylen = 0;
 
+/*!
+ Pointer to start of the VCD simulation window.
+*/
+static const char* vcd_win_start = NULL;
+
+/*!
+ Pointer to end of the VCD simulation window.
+*/
+static const char* vcd_win_end = NULL;
+
+/*!
+ Pointer to the next unconsumed character in the VCD simulation window.
+*/
+static const char* vcd_win_cur = NULL;
+
+/*!
+ Pointer to the first character in the VCD simulation window that must be kept when more of
+ the file is fetched (the start of the oldest token still in use).
+*/
+static const char* vcd_win_mark = NULL;
+
+/*!
+ Number of bytes allocated for the VCD simulation window (0 if the dumpfile is mapped).
+*/
+static unsigned int vcd_win_size = 0;
+
+/*!
+ Offset of vcd_win_start within the dumpfile.
+*/
+static uint64 vcd_win_offset = 0;
+
+/*!
+ Describes the error that stopped the VCD simulation window from being filled (NULL if no error occurred).
+*/
+static const char* vcd_win_error = NULL;
+
+#ifdef VCD_PIPELINE
+/*!
+ Batch of records passed from the VCD reader thread to the simulation thread.  Each record consists of three
+ unsigned integers (the record type, the symbol length and the data length) followed by the symbol and data.
+*/
+typedef struct vcd_batch_s vcd_batch;
+
+/*!
+ Contains the records of one entry of the VCD pipeline ring buffer.
+*/
+struct vcd_batch_s {
+  char*        data;  /*!< Packed records */
+  unsigned int used;  /*!< Number of bytes of data that are filled */
+};
+
+/*!
+ Ring buffer of batches passed from the VCD reader thread to the simulation thread.
+*/
+static vcd_batch vcd_pipe_ring[VCD_PIPE_BATCHES];
+
+/*!
+ Number of batches published by the VCD reader thread.  Only written by the reader thread.
+*/
+static unsigned int vcd_pipe_head = 0;
+
+/*!
+ Number of batches released by the simulation thread.  Only written by the simulation thread.
+*/
+static unsigned int vcd_pipe_tail = 0;
+
+/*!
+ Set by the simulation thread to tell the VCD reader thread to stop reading.
+*/
+static int vcd_pipe_stop = 0;
+#endif
+
+#ifdef HAVE_SYS_MMAN_H
+/*!
+ Pointer to the currently mapped window of the dumpfile (NULL if the dumpfile is not mapped).
+*/
+static void* vcd_map_base = NULL;
+
+/*!
+ Number of bytes in the currently mapped window of the dumpfile.
+*/
+static size_t vcd_map_size = 0;
+
+/*!
+ Total number of bytes in the mapped dumpfile.
+*/
+static uint64 vcd_file_size = 0;
+#endif
+
 
 /*!
  \return Returns a 32-bit value containing the index into the symbol array based off of the
@@ -534,7 +684,575 @@ static void vcd_parse_sim(
 }
 
 /*!
- \throws anonymous Throw Throw vcd_parse_def vcd_parse_sim
+ Prepares the simulation window of the specified VCD file.  The window starts at the first character of
+ the VCD read buffer that has not been consumed yet.  Regular files are mapped into memory a window
+ at a time; all other files (and systems without mmap support) are read in large blocks into an allocated
+ buffer that starts out with the unconsumed characters of the VCD read buffer.
+*/
+static void vcd_win_open(
+  FILE* vcd  /*!< File handle of opened VCD file */
+) { PROFILE(VCD_WIN_OPEN);
+
+  size_t left = vcd_rdbuf_end - vcd_rdbuf_cur;  /* Number of characters read from the file but not consumed yet */
+  off_t  pos  = ftello( vcd );                    /* Current position within the VCD file (or -1 if unknown) */
+
+  vcd_win_offset = (pos > (off_t)left) ? ((uint64)pos - left) : 0;
+  vcd_win_error  = NULL;
+  vcd_win_start  = NULL;
+  vcd_win_mark   = NULL;
+  vcd_win_cur    = NULL;
+  vcd_win_end    = NULL;
+  vcd_win_size   = VCD_WIN_BUFSIZE;
+
+#ifdef HAVE_SYS_MMAN_H
+  {
+    struct stat st;
+    if( (pos >= 0) && (fstat( fileno( vcd ), &st ) == 0) && S_ISREG( st.st_mode ) ) {
+      vcd_file_size = (uint64)st.st_size;
+      vcd_map_base  = NULL;
+      vcd_map_size  = 0;
+      vcd_win_size  = 0;
+    }
+  }
+#endif
+
+  if( vcd_win_size > 0 ) {
+    vcd_win_start = (const char*)malloc_safe_nolimit( vcd_win_size );
+    memcpy( (char*)vcd_win_start, vcd_rdbuf_cur, left );
+    vcd_win_mark  = vcd_win_start;
+    vcd_win_cur   = vcd_win_start;
+    vcd_win_end   = vcd_win_start + left;
+  }
+
+  /* The unconsumed characters now belong to the simulation window */
+  vcd_rdbuf_cur = vcd_rdbuf_end;
+
+  PROFILE_END;
+
+}
+
+/*!
+ Releases the simulation window of the VCD file.
+*/
+static void vcd_win_close() { PROFILE(VCD_WIN_CLOSE);
+
+#ifdef HAVE_SYS_MMAN_H
+  if( vcd_map_base != NULL ) {
+    int rv = munmap( vcd_map_base, vcd_map_size );
+    assert( rv == 0 );
+    vcd_map_base = NULL;
+    vcd_map_size = 0;
+  }
+#endif
+
+  if( vcd_win_size > 0 ) {
+    free_safe( (char*)vcd_win_start, vcd_win_size );
+    vcd_win_size = 0;
+  }
+
+  vcd_win_start = NULL;
+  vcd_win_mark  = NULL;
+  vcd_win_cur   = NULL;
+  vcd_win_end   = NULL;
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns TRUE if more characters were made available; otherwise, returns FALSE at the
+         end of the file or if an error occurred (in which case vcd_win_error is set).
+
+ Makes more of the VCD file available to the tokenizer.  The characters from vcd_win_mark to
+ vcd_win_end are kept (possibly at a different address, in which case vcd_win_mark and
+ vcd_win_cur are moved with them) so that tokens which straddle the end of the buffer can be
+ resumed after the call.  This function does not throw or output anything so that it may be
+ called from the VCD reader thread.
+*/
+static bool vcd_win_fetch(
+  FILE* vcd  /*!< File handle of opened VCD file */
+) { PROFILE(VCD_WIN_FETCH);
+
+  bool   retval = FALSE;                            /* Return value for this function */
+  size_t keep   = vcd_win_end - vcd_win_mark;  /* Number of characters to keep */
+  size_t cur    = vcd_win_cur - vcd_win_mark;  /* Offset of the current character from the mark */
+
+#ifdef HAVE_SYS_MMAN_H
+  if( vcd_win_size == 0 ) {
+
+    uint64 offset = vcd_win_offset + (vcd_win_mark - vcd_win_start);  /* File offset of the first kept character */
+
+    if( (offset + keep) < vcd_file_size ) {
+
+      long   page = sysconf( _SC_PAGESIZE );
+      uint64 base = offset - (offset % page);
+      size_t size = ((vcd_file_size - base) < VCD_MAP_WINDOW) ? (size_t)(vcd_file_size - base) : VCD_MAP_WINDOW;
+      void*  map;
+
+      if( (offset + keep) >= (base + size) ) {
+        vcd_win_error = "VCD token is too large";
+      } else if( (map = mmap( NULL, size, PROT_READ, MAP_PRIVATE, fileno( vcd ), (off_t)base )) == MAP_FAILED ) {
+        vcd_win_error = "Unable to map VCD file into memory";
+      } else {
+#ifdef MADV_SEQUENTIAL
+        (void)madvise( map, size, MADV_SEQUENTIAL );
+#endif
+        if( vcd_map_base != NULL ) {
+          int rv = munmap( vcd_map_base, vcd_map_size );
+          assert( rv == 0 );
+        }
+        vcd_map_base     = map;
+        vcd_map_size     = size;
+        vcd_win_offset = base;
+        vcd_win_start  = (const char*)map;
+        vcd_win_mark   = vcd_win_start + (offset - base);
+        vcd_win_end    = vcd_win_start + size;
+        retval           = TRUE;
+      }
+
+    }
+
+  } else
+#endif
+  if( keep == vcd_win_size ) {
+
+    vcd_win_error = "VCD token is too large";
+
+  } else {
+
+    size_t rd;
+
+    /* Slide the kept characters to the front of the buffer */
+    vcd_win_offset += vcd_win_mark - vcd_win_start;
+    memmove( (char*)vcd_win_start, vcd_win_mark, keep );
+    vcd_win_mark = vcd_win_start;
+    vcd_win_end  = vcd_win_start + keep;
+
+    rd = fread( (char*)vcd_win_end, sizeof( char ), (vcd_win_size - keep), vcd );
+    if( rd > 0 ) {
+      vcd_win_end += rd;
+      retval         = TRUE;
+    } else if( ferror( vcd ) ) {
+      vcd_win_error = "Unable to read from VCD file";
+    }
+
+  }
+
+  vcd_win_cur = vcd_win_mark + cur;
+
+  PROFILE_END;
+
+  return( retval );
+
+}
+
+/*!
+ \return Returns TRUE if a token was found; otherwise, returns FALSE at the end of the file.
+
+ Finds the next whitespace-delimited token in the VCD file.  The token is returned as a pointer
+ into the read buffer (or mapped window) and a length; it remains valid until the next call.  If
+ keep_prev is TRUE, the previously returned token is kept valid as well, although it may have been
+ moved to vcd_win_mark by the time this function returns.
+*/
+static bool vcd_get_slice(
+            FILE*         vcd,       /*!< File handle of opened VCD file */
+  /*@out@*/ const char**  tok,       /*!< Set to point to the first character of the token */
+  /*@out@*/ unsigned int* len,       /*!< Set to the number of characters in the token */
+            bool          keep_prev  /*!< Set to TRUE to keep the previously returned token valid */
+) { PROFILE(VCD_GET_SLICE);
+
+  bool        found = TRUE;  /* Return value for this function */
+  const char* ptr;           /* Pointer to the current character */
+
+  /* Skip whitespace */
+  for( ;; ) {
+    while( (vcd_win_cur != vcd_win_end) && (*((const unsigned char*)vcd_win_cur) <= ' ') ) {
+      vcd_win_cur++;
+    }
+    if( !keep_prev ) {
+      vcd_win_mark = vcd_win_cur;
+    }
+    if( (vcd_win_cur != vcd_win_end) || !(found = vcd_win_fetch( vcd )) ) {
+      break;
+    }
+  }
+
+  if( found ) {
+
+    /* Find the end of the token, fetching more of the file if it straddles the end of the buffer */
+    ptr = vcd_win_cur;
+    for( ;; ) {
+      size_t scanned;
+      while( (ptr != vcd_win_end) && (*((const unsigned char*)ptr) > ' ') ) {
+        ptr++;
+      }
+      scanned = ptr - vcd_win_cur;
+      if( (ptr != vcd_win_end) || !vcd_win_fetch( vcd ) ) {
+        break;
+      }
+      ptr = vcd_win_cur + scanned;
+    }
+
+    *tok          = vcd_win_cur;
+    *len          = ptr - vcd_win_cur;
+    vcd_win_cur = ptr;
+    found         = (vcd_win_error == NULL);
+
+  }
+
+  PROFILE_END;
+
+  return( found );
+
+}
+
+/*!
+ \throws anonymous db_do_timestep db_do_timestep Throw Throw Throw
+
+ Parses all tokens that occur in the simulation portion of the VCD file directly from the read
+ buffer (or mapped window) without copying them.  This performs the same function as vcd_parse_sim.
+*/
+static void vcd_parse_sim_slices(
+  FILE* vcd  /*!< File handle of opened VCD file */
+) { PROFILE(VCD_PARSE_SIM_SLICES);
+
+  const char*  token;                      /* Pointer to current token */
+  unsigned int len;                        /* Number of characters in current token */
+  uint64       last_timestep     = 0;      /* Value of last timestamp from file */
+  bool         use_last_timestep = FALSE;  /* Specifies if timestep has been encountered */
+  bool         simulate          = TRUE;   /* Specifies if we should continue to simulate */
+
+  while( vcd_get_slice( vcd, &token, &len, FALSE ) ) {
+
+    if( token[0] == '$' ) {
+
+      /* Ignore */
+
+    } else if( (token[0] == 'b') || (token[0] == 'B') || (token[0] == 'r') || (token[0] == 'R') ) {
+
+      unsigned int value_len = len - 1;  /* Number of characters in the value */
+
+      /* Read the symbol while keeping the value, which is found at the mark afterwards */
+      if( !vcd_get_slice( vcd, &token, &len, TRUE ) ) {
+        print_output( "Bad file format", FATAL, __FILE__, __LINE__ );
+        Throw 0;
+      }
+
+      db_set_symbol_slice( token, len, (vcd_win_mark + 1), value_len );
+
+    } else if( token[0] == '#' ) {
+
+      unsigned int i;
+
+      if( use_last_timestep ) {
+        simulate = db_do_timestep( last_timestep, FALSE );
+      }
+      last_timestep = 0;
+      for( i=1; (i < len) && (token[i] >= '0') && (token[i] <= '9'); i++ ) {
+        last_timestep = (last_timestep * 10) + (token[i] - '0');
+      }
+      use_last_timestep = TRUE;
+
+    } else if( (token[0] == '0') ||
+               (token[0] == '1') ||
+               (token[0] == 'x') ||
+               (token[0] == 'X') ||
+               (token[0] == 'z') ||
+               (token[0] == 'Z') ) {
+
+      db_set_symbol_slice( (token + 1), (len - 1), token, 1 );
+
+    } else {
+
+      unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "Badly placed token \"%.*s\"", ((len < 256) ? len : 256), token );
+      assert( rv < USER_MSG_LENGTH );
+      print_output( user_msg, FATAL, __FILE__, __LINE__ );
+      Throw 0;
+
+    }
+
+  }
+
+  if( vcd_win_error != NULL ) {
+    print_output( vcd_win_error, FATAL, __FILE__, __LINE__ );
+    Throw 0;
+  }
+
+  /* Simulate the last timestep now */
+  if( use_last_timestep && simulate ) {
+    (void)db_do_timestep( last_timestep, FALSE );
+  }
+
+  PROFILE_END;
+
+}
+
+#ifdef VCD_PIPELINE
+/*!
+ \return Returns TRUE if the record was added; otherwise, returns FALSE if the simulation thread
+         has asked the reader thread to stop.
+
+ Adds a record to the batch currently being filled by the VCD reader thread, publishing the batch
+ to the simulation thread and waiting for the next free batch when it runs out of room.
+*/
+static bool vcd_pipe_add(
+  unsigned int type,     /*!< Record type (see \ref vcd_pipe_records) */
+  const char*  sym,      /*!< Symbol characters of the record */
+  unsigned int sym_len,  /*!< Number of symbol characters */
+  const char*  data,     /*!< Data characters of the record */
+  unsigned int data_len  /*!< Number of data characters */
+) {
+
+  bool         retval = TRUE;                                                 /* Return value for this function */
+  unsigned int hdr[3];                                                        /* Record header */
+  unsigned int need   = sizeof( hdr ) + sym_len + data_len;                   /* Number of bytes needed for the record */
+  vcd_batch*   batch  = &vcd_pipe_ring[vcd_pipe_head % VCD_PIPE_BATCHES];  /* Batch being filled */
+
+  assert( need <= VCD_PIPE_BATCH_SIZE );
+
+  /* Publish the current batch and wait for the next one to be released if the record does not fit */
+  if( (batch->used + need) > VCD_PIPE_BATCH_SIZE ) {
+    __atomic_store_n( &vcd_pipe_head, (vcd_pipe_head + 1), __ATOMIC_RELEASE );
+    while( retval && ((vcd_pipe_head - __atomic_load_n( &vcd_pipe_tail, __ATOMIC_ACQUIRE )) == VCD_PIPE_BATCHES) ) {
+      if( __atomic_load_n( &vcd_pipe_stop, __ATOMIC_ACQUIRE ) ) {
+        retval = FALSE;
+      } else {
+        (void)sched_yield();
+      }
+    }
+    batch       = &vcd_pipe_ring[vcd_pipe_head % VCD_PIPE_BATCHES];
+    batch->used = 0;
+  }
+
+  if( retval ) {
+    hdr[0] = type;
+    hdr[1] = sym_len;
+    hdr[2] = data_len;
+    memcpy( (batch->data + batch->used), hdr, sizeof( hdr ) );
+    if( sym_len > 0 ) {
+      memcpy( (batch->data + batch->used + sizeof( hdr )), sym, sym_len );
+    }
+    if( data_len > 0 ) {
+      memcpy( (batch->data + batch->used + sizeof( hdr ) + sym_len), data, data_len );
+    }
+    batch->used += need;
+  }
+
+  return( retval );
+
+}
+
+/*!
+ \return Returns NULL.
+
+ Body of the VCD reader thread.  Tokenizes the simulation portion of the VCD file and passes the
+ value changes and timesteps to the simulation thread in batches.  Errors are passed along as
+ records since only the simulation thread may output messages or throw.
+*/
+static void* vcd_pipe_reader(
+  void* arg  /*!< File handle of opened VCD file */
+) {
+
+  FILE*        vcd = (FILE*)arg;  /* File handle of opened VCD file */
+  const char*  token;             /* Pointer to current token */
+  unsigned int len;               /* Number of characters in current token */
+  const char*  error = NULL;      /* Error message to pass to the simulation thread */
+  char         msg[USER_MSG_LENGTH];  /* Storage for error messages built by this thread */
+  bool         run   = TRUE;      /* Cleared when the reader should stop */
+
+  while( run && vcd_get_slice( vcd, &token, &len, FALSE ) ) {
+
+    if( token[0] == '$' ) {
+
+      /* Ignore */
+
+    } else if( (token[0] == 'b') || (token[0] == 'B') || (token[0] == 'r') || (token[0] == 'R') ) {
+
+      unsigned int value_len = len - 1;  /* Number of characters in the value */
+
+      if( !vcd_get_slice( vcd, &token, &len, TRUE ) ) {
+        error = "Bad file format";
+        run   = FALSE;
+      } else if( (value_len + len + (3 * sizeof( unsigned int ))) > VCD_PIPE_BATCH_SIZE ) {
+        error = "VCD token is too large";
+        run   = FALSE;
+      } else {
+        run = vcd_pipe_add( VCD_PIPE_VALUE, token, len, (vcd_win_mark + 1), value_len );
+      }
+
+    } else if( token[0] == '#' ) {
+
+      uint64       timestep = 0;
+      unsigned int i;
+
+      for( i=1; (i < len) && (token[i] >= '0') && (token[i] <= '9'); i++ ) {
+        timestep = (timestep * 10) + (token[i] - '0');
+      }
+      run = vcd_pipe_add( VCD_PIPE_TIME, NULL, 0, (const char*)&timestep, sizeof( timestep ) );
+
+    } else if( (token[0] == '0') ||
+               (token[0] == '1') ||
+               (token[0] == 'x') ||
+               (token[0] == 'X') ||
+               (token[0] == 'z') ||
+               (token[0] == 'Z') ) {
+
+      if( (len + (3 * sizeof( unsigned int ))) > VCD_PIPE_BATCH_SIZE ) {
+        error = "VCD token is too large";
+        run   = FALSE;
+      } else {
+        run = vcd_pipe_add( VCD_PIPE_VALUE, (token + 1), (len - 1), token, 1 );
+      }
+
+    } else {
+
+      unsigned int rv = snprintf( msg, USER_MSG_LENGTH, "Badly placed token \"%.*s\"", ((len < 256) ? len : 256), token );
+      assert( rv < USER_MSG_LENGTH );
+      error = msg;
+      run   = FALSE;
+
+    }
+
+  }
+
+  if( (error == NULL) && (vcd_win_error != NULL) ) {
+    error = vcd_win_error;
+  }
+
+  /* Send the error or the end marker and publish the last batch */
+  if( (error != NULL) ? vcd_pipe_add( VCD_PIPE_ERROR, NULL, 0, error, strlen( error ) )
+                      : vcd_pipe_add( VCD_PIPE_END, NULL, 0, NULL, 0 ) ) {
+    __atomic_store_n( &vcd_pipe_head, (vcd_pipe_head + 1), __ATOMIC_RELEASE );
+  }
+
+  return( NULL );
+
+}
+
+/*!
+ \return Returns TRUE if the VCD file was parsed by the pipelined reader; otherwise, returns FALSE if the
+         reader thread could not be started, in which case nothing was read.
+
+ \throws anonymous db_do_timestep db_do_timestep Throw
+
+ Parses the simulation portion of the VCD file with two threads.  A reader thread tokenizes the file
+ and fills batches in a lock-free, single-producer/single-consumer ring buffer while this (the simulation)
+ thread consumes the batches, assigning the value changes to the symbol table and simulating each
+ timestep, just as vcd_parse_sim_slices does.
+*/
+static bool vcd_parse_sim_pipelined(
+  FILE* vcd  /*!< File handle of opened VCD file */
+) { PROFILE(VCD_PARSE_SIM_PIPELINED);
+
+  bool         started;                    /* Return value for this function */
+  pthread_t    reader;                     /* VCD reader thread */
+  uint64       last_timestep     = 0;      /* Value of last timestamp from file */
+  bool         use_last_timestep = FALSE;  /* Specifies if timestep has been encountered */
+  bool         simulate          = TRUE;   /* Specifies if we should continue to simulate */
+  bool         done              = FALSE;  /* Set when the end or error record is consumed */
+  char*        error             = NULL;   /* Error message received from the reader thread */
+  unsigned int i;                          /* Loop iterator */
+
+  for( i=0; i<VCD_PIPE_BATCHES; i++ ) {
+    vcd_pipe_ring[i].data = (char*)malloc_safe_nolimit( VCD_PIPE_BATCH_SIZE );
+    vcd_pipe_ring[i].used = 0;
+  }
+  vcd_pipe_head = 0;
+  vcd_pipe_tail = 0;
+  vcd_pipe_stop = 0;
+
+  if( (started = (pthread_create( &reader, NULL, vcd_pipe_reader, vcd ) == 0)) ) {
+
+    Try {
+
+      while( !done ) {
+
+        vcd_batch*   batch;
+        unsigned int pos = 0;
+
+        /* Wait for the reader thread to publish the next batch */
+        while( __atomic_load_n( &vcd_pipe_head, __ATOMIC_ACQUIRE ) == vcd_pipe_tail ) {
+          (void)sched_yield();
+        }
+        batch = &vcd_pipe_ring[vcd_pipe_tail % VCD_PIPE_BATCHES];
+
+        while( !done && (pos < batch->used) ) {
+          unsigned int hdr[3];
+          const char*  sym;
+          const char*  data;
+          memcpy( hdr, (batch->data + pos), sizeof( hdr ) );
+          sym  = batch->data + pos + sizeof( hdr );
+          data = sym + hdr[1];
+          pos += sizeof( hdr ) + hdr[1] + hdr[2];
+          switch( hdr[0] ) {
+            case VCD_PIPE_VALUE :
+              db_set_symbol_slice( sym, hdr[1], data, hdr[2] );
+              break;
+            case VCD_PIPE_TIME :
+              if( use_last_timestep ) {
+                simulate = db_do_timestep( last_timestep, FALSE );
+              }
+              memcpy( &last_timestep, data, sizeof( last_timestep ) );
+              use_last_timestep = TRUE;
+              break;
+            case VCD_PIPE_ERROR :
+              error = (char*)malloc_safe( hdr[2] + 1 );
+              memcpy( error, data, hdr[2] );
+              error[hdr[2]] = '\0';
+              done  = TRUE;
+              break;
+            case VCD_PIPE_END :
+              done = TRUE;
+              break;
+            default :
+              assert( 0 );
+              break;
+          }
+        }
+
+        /* Release the batch back to the reader thread */
+        __atomic_store_n( &vcd_pipe_tail, (vcd_pipe_tail + 1), __ATOMIC_RELEASE );
+
+      }
+
+      /* Simulate the last timestep now */
+      if( (error == NULL) && use_last_timestep && simulate ) {
+        (void)db_do_timestep( last_timestep, FALSE );
+      }
+
+    } Catch_anonymous {
+      __atomic_store_n( &vcd_pipe_stop, 1, __ATOMIC_RELEASE );
+      (void)pthread_join( reader, NULL );
+      for( i=0; i<VCD_PIPE_BATCHES; i++ ) {
+        free_safe( vcd_pipe_ring[i].data, VCD_PIPE_BATCH_SIZE );
+      }
+      Throw 0;
+    }
+
+    /* The reader thread has published its last batch */
+    (void)pthread_join( reader, NULL );
+
+  }
+
+  for( i=0; i<VCD_PIPE_BATCHES; i++ ) {
+    free_safe( vcd_pipe_ring[i].data, VCD_PIPE_BATCH_SIZE );
+  }
+
+  if( error != NULL ) {
+    print_output( error, FATAL, __FILE__, __LINE__ );
+    free_safe( error, (strlen( error ) + 1) );
+    Throw 0;
+  }
+
+  PROFILE_END;
+
+  return( started );
+
+}
+#endif
+
+/*!
+ \throws anonymous Throw Throw vcd_parse_def vcd_parse_sim vcd_parse_sim_slices vcd_parse_sim_pipelined
 
  Reads specified VCD file for relevant information and calls the database
  functions when appropriate to store this information.  This replaces the
@@ -544,14 +1262,22 @@ void vcd_parse(
   const char* vcd_file  /*!< Name of VCD file to parse */
 ) { PROFILE(VCD_PARSE);
 
-  FILE* vcd_handle;        /* Pointer to opened VCD file */
+  FILE*  vcd_handle;         /* Pointer to opened VCD file */
+  uint64 bytes      = 0;     /* Number of bytes of the VCD file that were read */
+#ifdef HAVE_SYS_TIME_H
+  timer* vcd_timer  = NULL;  /* Measures the time needed to read and score the VCD file */
+#endif
 
   if( (vcd_handle = fopen( vcd_file, "r" )) != NULL ) {
 
     unsigned int rv;
 
     /* Create initial symbol table */
-    vcd_symtab = symtable_create();
+    symtable_create();
+
+#ifdef HAVE_SYS_TIME_H
+    timer_start( &vcd_timer );
+#endif
 
     Try {
 
@@ -568,20 +1294,53 @@ void vcd_parse(
         timestep_tab = malloc_safe_nolimit( sizeof( symtable*) * vcd_symtab_size );
       }
     
-      vcd_parse_sim( vcd_handle );
+      if( flag_vcd_stdio ) {
+        off_t pos;
+        vcd_parse_sim( vcd_handle );
+        bytes = ((pos = ftello( vcd_handle )) > 0) ? ((uint64)pos - (vcd_rdbuf_end - vcd_rdbuf_cur)) : 0;
+      } else {
+        vcd_win_open( vcd_handle );
+#ifdef VCD_PIPELINE
+        if( !flag_vcd_pipeline || !vcd_parse_sim_pipelined( vcd_handle ) )
+#else
+        if( flag_vcd_pipeline ) {
+          print_output( "VCD pipelining is not supported by this build of Covered; the VCD file will be read by a single thread", WARNING, __FILE__, __LINE__ );
+        }
+#endif
+        {
+          vcd_parse_sim_slices( vcd_handle );
+        }
+        bytes = vcd_win_offset + (vcd_win_cur - vcd_win_start);
+        vcd_win_close();
+      }
 
     } Catch_anonymous {
-      symtable_dealloc( vcd_symtab );
+      vcd_win_close();
+      symtable_dealloc();
       free_safe( timestep_tab, (sizeof( symtable*) * vcd_symtab_size) );
       free_safe( vcd_rdbuf_start, VCD_BUFSIZE );
       free_safe( vcd_yytext, vcd_yytext_size );
+#ifdef HAVE_SYS_TIME_H
+      free_safe( vcd_timer, sizeof( timer ) );
+#endif
       rv = fclose( vcd_handle );
       assert( rv == 0 );
       Throw 0;
     }
 
+#ifdef HAVE_SYS_TIME_H
+    timer_stop( &vcd_timer );
+    /*@-duplicatequals -formattype -formatcode@*/
+    rv = snprintf( user_msg, USER_MSG_LENGTH, "  Read %" FMT64 "u bytes of VCD data in %s (%.3f GB/s)",
+                   bytes, timer_to_string( vcd_timer ), ((vcd_timer->total > 0) ? ((double)bytes / ((double)vcd_timer->total * 1000.0)) : 0.0) );
+    /*@=duplicatequals =formattype =formatcode@*/
+    assert( rv < USER_MSG_LENGTH );
+    print_output( user_msg, NORMAL, __FILE__, __LINE__ );
+    free_safe( vcd_timer, sizeof( timer ) );
+#endif
+
     /* Deallocate memory */
-    symtable_dealloc( vcd_symtab );
+    symtable_dealloc();
     free_safe( timestep_tab, (sizeof( symtable*) * vcd_symtab_size) );
     free_safe( vcd_rdbuf_start, VCD_BUFSIZE );
     free_safe( vcd_yytext, vcd_yytext_size );
@@ -600,4 +1359,3 @@ void vcd_parse(
   PROFILE_END;
 
 }
-
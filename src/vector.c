@@ -39,14 +39,25 @@
 #endif
 
 #include "defines.h"
+#include "db.h"
 #include "vector.h"
 #include "util.h"
 
-
-/*!
- Returns the number of unsigned long elements are required to store a vector with a bit width of width.
+/*
+ SIMD implementations of the signal/memory toggle update are built for x86-64 compilers that can
+ target AVX2 on a per-function basis; the implementation is selected at runtime.
 */
-#define UL_SIZE(width)      (UL_DIV((width) - 1) + 1)
+#if defined(__GNUC__) && defined(__x86_64__) && (UL_BITS == 64) && ((__GNUC__ > 4) || ((__GNUC__ == 4) && (__GNUC_MINOR__ >= 9)) || defined(__clang__))
+#define VECTOR_TOGGLE_SIMD
+#include <immintrin.h>
+#endif
+
+/* Value strings are decoded sixteen characters at a time wherever SSE2 is part of the base instruction set */
+#if defined(__SSE2__) && (UL_BITS >= 32)
+#define VECTOR_DECODE_SSE2
+#include <emmintrin.h>
+#endif
+
 
 /*! Lower mask */
 #define UL_LMASK(lsb)       (UL_SET << UL_MOD(lsb))
@@ -54,6 +65,32 @@
 /*! Upper mask */
 #define UL_HMASK(msb)       (UL_SET >> ((UL_BITS - 1) - UL_MOD(msb)))
 
+/*!
+ Returns the number of bytes needed to store num value planes of size machine words each.
+*/
+#define VECTOR_UL_ALLOC_SIZE(num,size)  (sizeof( ulong ) * (size) * (num))
+
+/*! Number of bits in half of an unsigned long (the digit size used by the multi-word division kernel) */
+#define UL_HALF_BITS        (UL_BITS >> 1)
+
+/*! Mask for the lower half of an unsigned long */
+#define UL_HALF_MASK        (UL_SET >> UL_HALF_BITS)
+
+/*!
+ Number of machine words in the smaller multiplication operand at which the multi-word multiply
+ switches from the schoolbook algorithm to Karatsuba (must be at least 4 for the recursion to end).
+*/
+#define VECTOR_KARATSUBA_THRESHOLD  32
+
+
+static bool vector_toggle_words_select( vector*, const ulong*, const ulong*, unsigned int, unsigned int, ulong, ulong, bool );
+
+/*!
+ Pointer to the implementation used to assign signal and memory words and update their toggle
+ information (see vector_toggle_words_scalar).  This starts out pointing to a function that selects
+ the fastest implementation supported by the running CPU.
+*/
+static bool (*vector_toggle_words)( vector*, const ulong*, const ulong*, unsigned int, unsigned int, ulong, ulong, bool ) = vector_toggle_words_select;
 
 /*! Contains the structure sizes for the various vector types (vector "type" supplemental field is the index to this array */
 static const unsigned int vector_type_sizes[4] = {VTYPE_INDEX_VAL_NUM, VTYPE_INDEX_SIG_NUM, VTYPE_INDEX_EXP_NUM, VTYPE_INDEX_MEM_NUM};
@@ -61,6 +98,73 @@ static const unsigned int vector_type_sizes[4] = {VTYPE_INDEX_VAL_NUM, VTYPE_IND
 extern char   user_msg[USER_MSG_LENGTH];
 extern isuppl info_suppl;
 
+/*!
+ Number of ulong value arrays allocated by vector_create.
+*/
+uint64 vector_ul_allocs = 0;
+
+/*!
+ Number of bytes allocated for ulong value arrays by vector_create.
+*/
+uint64 vector_ul_bytes = 0;
+
+/*!
+ Number of ulong value arrays that were small enough to be stored inline within their vector structure.
+*/
+uint64 vector_ul_inline = 0;
+
+/*!
+ Number of allocations that the same value arrays would have required if each machine word had been
+ allocated separately.
+*/
+uint64 vector_ul_word_allocs = 0;
+
+/*!
+ Number of bytes that the same value arrays would have required if each machine word had been
+ allocated separately.
+*/
+uint64 vector_ul_word_bytes = 0;
+
+
+/*!
+ \return Returns a pointer to the value planes to use for the given vector.
+
+ Selects the storage for the value planes of a vector of the given width and type.  If all of the
+ planes fit within the inline storage of the vector structure, that storage is used and no memory
+ is allocated; otherwise, the planes are allocated contiguously in a single block of heap memory.
+ In either case the returned planes are cleared and the vector must be initialized with
+ vector_init_ulong using the returned pointer.
+*/
+ulong* vector_alloc_ulong(
+  vector* vec,    /*!< Pointer to vector that will own the value planes */
+  int     width,  /*!< Bit width of vector */
+  int     type    /*!< Type of vector (see \ref vector_types for valid values) */
+) { PROFILE(VECTOR_ALLOC_ULONG);
+
+  unsigned int num  = vector_type_sizes[type];
+  unsigned int size = UL_SIZE(width);
+  ulong*       value;
+
+  assert( width > 0 );
+
+  if( (num * size) <= VECTOR_INLINE_SIZE ) {
+    value = vec->small;
+    vector_ul_inline++;
+  } else {
+    value = (ulong*)malloc_safe_nolimit( VECTOR_UL_ALLOC_SIZE( num, size ) );
+    vector_ul_allocs++;
+    vector_ul_bytes += VECTOR_UL_ALLOC_SIZE( num, size );
+  }
+  memset( value, 0, VECTOR_UL_ALLOC_SIZE( num, size ) );
+
+  vector_ul_word_allocs += size + 1;
+  vector_ul_word_bytes  += (sizeof( ulong* ) + (sizeof( ulong ) * num)) * size;
+
+  PROFILE_END;
+
+  return( value );
+
+}
 
 /*!
  Initializes the specified vector with the contents of width
@@ -69,7 +173,7 @@ extern isuppl info_suppl;
 */
 void vector_init_ulong(
   vector* vec,         /*!< Pointer to vector to initialize */
-  ulong** value,       /*!< Pointer to vec_data array for vector */
+  ulong*  value,       /*!< Pointer to vec_data array for vector */
   ulong   data_l,      /*!< Initial value to set each lower data value to */
   ulong   data_h,      /*!< Initial value to set each upper data value to */
   bool    owns_value,  /*!< Set to TRUE if this vector is responsible for deallocating the given value array */
@@ -86,25 +190,25 @@ void vector_init_ulong(
 
   if( value != NULL ) {
 
-    int    i, j;
+    int    i;
     int    size  = UL_SIZE(width);
     int    num   = vector_type_sizes[type];
     ulong  lmask = UL_HMASK(width - 1);
+    ulong* vall  = VEC_PLANE( vec, VTYPE_INDEX_VAL_VALL );
+    ulong* valh  = VEC_PLANE( vec, VTYPE_INDEX_VAL_VALH );
 
     assert( width > 0 );
 
     for( i=0; i<(size - 1); i++ ) {
-      vec->value.ul[i][VTYPE_INDEX_VAL_VALL] = data_l;
-      vec->value.ul[i][VTYPE_INDEX_VAL_VALH] = data_h;
-      for( j=2; j<num; j++ ) {
-        vec->value.ul[i][j] = 0x0;
-      }
+      vall[i] = data_l;
+      valh[i] = data_h;
     }
+    vall[i] = data_l & lmask;
+    valh[i] = data_h & lmask;
 
-    vec->value.ul[i][VTYPE_INDEX_VAL_VALL] = data_l & lmask;
-    vec->value.ul[i][VTYPE_INDEX_VAL_VALH] = data_h & lmask;
-    for( j=2; j<num; j++ ) {
-      vec->value.ul[i][j] = 0x0;
+    /* The remaining planes are contiguous so clear them all at once */
+    if( num > 2 ) {
+      memset( VEC_PLANE( vec, 2 ), 0, (sizeof( ulong ) * size * (num - 2)) );
     }
 
   } else {
@@ -206,15 +310,9 @@ vector* vector_create(
   switch( data_type ) {
     case VDATA_UL :
       {
-        ulong** value = NULL;
+        ulong* value = NULL;
         if( (data == TRUE) && (width > 0) ) {
-          int          num  = vector_type_sizes[type];
-          unsigned int size = UL_SIZE(width);
-          unsigned int i;
-          value = (ulong**)malloc_safe( sizeof( ulong* ) * size );
-          for( i=0; i<size; i++ ) {
-            value[i] = (ulong*)malloc_safe( sizeof( ulong ) * num );
-          }
+          value = vector_alloc_ulong( new_vec, width, type );
         }
         vector_init_ulong( new_vec, value, 0x0, 0x0, (value != NULL), width, type );
       }
@@ -254,8 +352,6 @@ void vector_copy(
   vector*       to_vec     /*!< Newly created vector copy */
 ) { PROFILE(VECTOR_COPY);
 
-  unsigned int i, j;  /* Loop iterators */
-
   assert( from_vec != NULL );
   assert( to_vec != NULL );
   assert( from_vec->width == to_vec->width );
@@ -266,11 +362,7 @@ void vector_copy(
       {
         unsigned int size      = UL_SIZE( from_vec->width );
         unsigned int type_size = (from_vec->suppl.part.type != to_vec->suppl.part.type) ? 2 : vector_type_sizes[to_vec->suppl.part.type];
-        for( i=0; i<size; i++ ) {
-          for( j=0; j<type_size; j++ ) {
-            to_vec->value.ul[i][j] = from_vec->value.ul[i][j];
-          }
-        }
+        memcpy( to_vec->value.ul, from_vec->value.ul, VECTOR_UL_ALLOC_SIZE( type_size, size ) );
       }
       break;
     case VDATA_R64 :
@@ -317,9 +409,9 @@ void vector_copy_range(
           unsigned int their_offset = UL_MOD(i + lsb);
           for( j=0; j<vector_type_sizes[to_vec->suppl.part.type]; j++ ) {
             if( UL_MOD(i) == 0 ) {
-              to_vec->value.ul[my_index][j] = 0;
+              VEC_PLANE( to_vec, j )[my_index] = 0;
             }
-            to_vec->value.ul[my_index][j] |= (((from_vec->value.ul[their_index][j] >> their_offset) & 0x1) << i);
+            VEC_PLANE( to_vec, j )[my_index] |= (((VEC_PLANE( from_vec, j )[their_index] >> their_offset) & 0x1) << i);
           }
         }
       }
@@ -407,21 +499,21 @@ void vector_db_write(
           unsigned int i, j;
           ulong        hmask  = UL_HMASK( vec->width - 1 );
           for( i=0; i<(UL_SIZE(vec->width) - 1); i++ ) {
-            fprintf( file, " %lx", (write_data && (vec->value.ul != NULL)) ? vec->value.ul[i][VTYPE_INDEX_VAL_VALL] : dflt_l );
-            fprintf( file, " %lx", (write_data && (vec->value.ul != NULL)) ? vec->value.ul[i][VTYPE_INDEX_VAL_VALH] : dflt_h );
+            fprintf( file, " %lx", (write_data && (vec->value.ul != NULL)) ? VEC_PLANE( vec, VTYPE_INDEX_VAL_VALL )[i] : dflt_l );
+            fprintf( file, " %lx", (write_data && (vec->value.ul != NULL)) ? VEC_PLANE( vec, VTYPE_INDEX_VAL_VALH )[i] : dflt_h );
             for( j=2; j<vector_type_sizes[vec->suppl.part.type]; j++ ) {
               if( ((mask >> j) & 0x1) == 1 ) {
-                fprintf( file, " %lx", (vec->value.ul != NULL) ? vec->value.ul[i][j] : 0 );
+                fprintf( file, " %lx", (vec->value.ul != NULL) ? VEC_PLANE( vec, j )[i] : 0 );
               } else {
                 fprintf( file, " 0" );
               }
             }
           }
-          fprintf( file, " %lx", ((write_data && (vec->value.ul != NULL)) ? vec->value.ul[i][VTYPE_INDEX_VAL_VALL] : dflt_l) & hmask );
-          fprintf( file, " %lx", ((write_data && (vec->value.ul != NULL)) ? vec->value.ul[i][VTYPE_INDEX_VAL_VALH] : dflt_h) & hmask );
+          fprintf( file, " %lx", ((write_data && (vec->value.ul != NULL)) ? VEC_PLANE( vec, VTYPE_INDEX_VAL_VALL )[i] : dflt_l) & hmask );
+          fprintf( file, " %lx", ((write_data && (vec->value.ul != NULL)) ? VEC_PLANE( vec, VTYPE_INDEX_VAL_VALH )[i] : dflt_h) & hmask );
           for( j=2; j<vector_type_sizes[vec->suppl.part.type]; j++ ) {
             if( ((mask >> j) & 0x1) == 1 ) {
-              fprintf( file, " %lx", (vec->value.ul != NULL) ? (vec->value.ul[i][j] & hmask) : 0 );
+              fprintf( file, " %lx", (vec->value.ul != NULL) ? (VEC_PLANE( vec, j )[i] & hmask) : 0 );
             } else {
               fprintf( file, " 0" );
             }
@@ -459,6 +551,135 @@ void vector_db_write(
 
 }
 
+/*!
+ Appends the given value plane of a VDATA_UL vector to the binary CDD record being built as 64-bit words (the
+ unused bits of the last word are cleared).
+*/
+static void vector_db_write_bin_plane(
+  const ulong* plane,  /*!< Pointer to value plane to write */
+  unsigned int width   /*!< Bit width of vector */
+) {
+
+  unsigned int size  = UL_SIZE( width );
+  ulong        hmask = UL_HMASK( width - 1 );
+
+#if SIZEOF_LONG == 8
+  ulong last = plane[size - 1] & hmask;
+
+  if( size > 1 ) {
+    db_bin_put( plane, (sizeof( ulong ) * (size - 1)) );
+  }
+  db_bin_put( &last, sizeof( ulong ) );
+#else
+  unsigned int i;
+
+  for( i=0; i<size; i+=2 ) {
+    uint64 word = (uint64)((i == (size - 1)) ? (plane[i] & hmask) : plane[i]);
+    if( (i + 1) < size ) {
+      word |= (uint64)(((i + 1) == (size - 1)) ? (plane[i + 1] & hmask) : plane[i + 1]) << 32;
+    }
+    db_bin_put( &word, sizeof( uint64 ) );
+  }
+#endif
+
+}
+
+/*!
+ Appends the specified vector to the binary CDD record currently being built.  The stored planes match those of
+ vector_db_write but each plane is written as raw 64-bit words.  A plane whose contents are not written (or
+ whose words are all zero) is stored as a single fill word.
+*/
+void vector_db_write_bin(
+  vector* vec,         /*!< Pointer to vector to write */
+  bool    write_data,  /*!< If set to TRUE, causes 4-state data bytes to be included */
+  bool    net          /*!< If set to TRUE, causes default value to be written as Z instead of X */
+) { PROFILE(VECTOR_DB_WRITE_BIN);
+
+  uint8  mask;    /* Mask value for vector values */
+  uint32 hdr[2];  /* Width and supplemental field */
+
+  assert( vec != NULL );
+
+  /* Calculate vector data mask */
+  mask = write_data ? 0xff : 0xfc;
+  switch( vec->suppl.part.type ) {
+    case VTYPE_VAL :  mask = mask & 0x03;  break;
+    case VTYPE_SIG :  mask = mask & 0x1b;  break;
+    case VTYPE_EXP :  mask = mask & 0x3f;  break;
+    case VTYPE_MEM :  mask = mask & 0x7b;  break;
+    default        :  break;
+  }
+
+  hdr[0] = vec->width;
+  hdr[1] = (vec->suppl.all & VSUPPL_MASK);
+  db_bin_put( hdr, sizeof( hdr ) );
+
+  /* Only write our data if we own it */
+  if( vec->suppl.part.owns_data == 1 ) {
+
+    assert( vec->width > 0 );
+
+    switch( vec->suppl.part.data_type ) {
+      case VDATA_UL :
+        {
+          uint64       fill[VTYPE_INDEX_MEM_NUM];
+          uint32       raw  = 0;
+          unsigned int size = UL_SIZE( vec->width );
+          unsigned int i, j;
+
+          /* Figure out which planes need to be stored word by word */
+          for( j=0; j<vector_type_sizes[vec->suppl.part.type]; j++ ) {
+            fill[j] = 0;
+            if( j < 2 ) {
+              if( write_data && (vec->value.ul != NULL) ) {
+                raw |= (1 << j);
+              } else if( j == VTYPE_INDEX_VAL_VALL ) {
+                fill[j] = net ? ~((uint64)0) : 0;
+              } else {
+                fill[j] = (vec->suppl.part.is_2state == 1) ? 0 : ~((uint64)0);
+              }
+            } else if( (((mask >> j) & 0x1) == 1) && (vec->value.ul != NULL) ) {
+              const ulong* plane = VEC_PLANE( vec, j );
+              for( i=0; (i<size) && (plane[i] == 0); i++ );
+              if( i < size ) {
+                raw |= (1 << j);
+              }
+            }
+          }
+
+          db_bin_put( &raw, sizeof( uint32 ) );
+          for( j=0; j<vector_type_sizes[vec->suppl.part.type]; j++ ) {
+            if( ((raw >> j) & 0x1) == 1 ) {
+              vector_db_write_bin_plane( VEC_PLANE( vec, j ), vec->width );
+            } else {
+              db_bin_put( &(fill[j]), sizeof( uint64 ) );
+            }
+          }
+        }
+        break;
+      case VDATA_R64 :
+        {
+          double val = (vec->value.r64 != NULL) ? vec->value.r64->val : 0.0;
+          db_bin_put( &val, sizeof( double ) );
+          db_bin_put_str( (vec->value.r64 != NULL) ? vec->value.r64->str : NULL );
+        }
+        break;
+      case VDATA_R32 :
+        {
+          double val = (vec->value.r32 != NULL) ? (double)vec->value.r32->val : 0.0;
+          db_bin_put( &val, sizeof( double ) );
+          db_bin_put_str( (vec->value.r32 != NULL) ? vec->value.r32->str : NULL );
+        }
+        break;
+      default :  assert( 0 );  break;
+    }
+
+  }
+
+  PROFILE_END;
+
+}
+
 /*!
  \throws anonymous Throw Throw
 
@@ -471,15 +692,14 @@ void vector_db_read(
 ) { PROFILE(VECTOR_DB_READ);
 
   unsigned int width;       /* Vector bit width */
+  unsigned int suppl_all;   /* Supplemental value as read */
   vsuppl       suppl;       /* Temporary supplemental value */
   int          chars_read;  /* Number of characters read */
 
   /* Read in vector information */
-  /*@-formatcode@*/
-  if( sscanf( *line, "%u %hhu%n", &width, &(suppl.all), &chars_read ) == 2 ) {
-  /*@=formatcode@*/
+  if( util_scan_uint( line, &width, 10 ) && util_scan_uint( line, &suppl_all, 10 ) ) {
 
-    *line = *line + chars_read;
+    suppl.all = (uint8)suppl_all;
 
     /* Create new vector */
     *vec              = vector_create( width, suppl.part.type, suppl.part.data_type, TRUE );
@@ -503,9 +723,7 @@ void vector_db_read(
 #else
 #error "Unsupported long size"
 #endif
-                    if( sscanf( *line, "%lx%n", &((*vec)->value.ul[i][j]), &chars_read ) == 1 ) {
-                      *line += chars_read;
-                    } else {
+                    if( !util_scan_ulong( line, &(VEC_PLANE( (*vec), j )[i]), 16 ) ) {
                       print_output( "Unable to parse vector information in database file.  Unable to read.", FATAL, __FILE__, __LINE__ );
                       Throw 0;
                     }
@@ -513,13 +731,12 @@ void vector_db_read(
 #if SIZEOF_LONG == 8
                   /* If the CDD file size is 32-bit and we are 64-bit, store two elements to our one */
                   } else if( info_suppl.part.vec_ul_size == 2 ) {
-                    uint32 val;
-                    if( sscanf( *line, "%x%n", &val, &chars_read ) == 1 ) {
-                      *line += chars_read;
+                    unsigned int val;
+                    if( util_scan_uint( line, &val, 16 ) ) {
                       if( i == 0 ) {
-                        (*vec)->value.ul[i/2][j] = (ulong)val;
+                        VEC_PLANE( (*vec), j )[i/2] = (ulong)val;
                       } else {
-                        (*vec)->value.ul[i/2][j] |= ((ulong)val << 32);
+                        VEC_PLANE( (*vec), j )[i/2] |= ((ulong)val << 32);
                       }
                     } else {
                       print_output( "Unable to parse vector information in database file.  Unable to read.", FATAL, __FILE__, __LINE__ );
@@ -534,8 +751,8 @@ void vector_db_read(
                     if( sscanf( *line, "%llx%n", &val, &chars_read ) == 1 ) {
                     /*@=duplicatequals =ignorequals@*/
                       *line += chars_read;
-                      (*vec)->value.ul[(i*2)+0][j] = (ulong)(val & 0xffffffffLL);
-                      (*vec)->value.ul[(i*2)+1][j] = (ulong)((val >> 32) & 0xffffffffLL);
+                      VEC_PLANE( (*vec), j )[(i*2)+0] = (ulong)(val & 0xffffffffLL);
+                      VEC_PLANE( (*vec), j )[(i*2)+1] = (ulong)((val >> 32) & 0xffffffffLL);
                     } else {
                       print_output( "Unable to parse vector information in database file.  Unable to read.", FATAL, __FILE__, __LINE__ );
                       Throw 0;
@@ -653,6 +870,144 @@ void vector_db_read(
 
 }
 
+/*!
+ \throws anonymous db_bin_get db_bin_get db_bin_get
+
+ Parses a value plane of a VDATA_UL vector from the binary CDD record being read and stores it into the given
+ plane (or bitwise ORs it into the plane if merge is TRUE).  The plane was stored by vector_db_write_bin either
+ as raw 64-bit words or as a single fill word.
+*/
+static void vector_db_read_bin_plane(
+  char**       line,   /*!< Pointer to current position in binary record */
+  ulong*       plane,  /*!< Pointer to value plane to populate */
+  unsigned int width,  /*!< Bit width of vector */
+  bool         raw,    /*!< Set to TRUE if the plane was stored word by word */
+  bool         merge   /*!< Set to TRUE to merge the stored plane into the existing plane */
+) {
+
+  unsigned int size = UL_SIZE( width );
+  unsigned int i;
+  uint64       word;
+
+  if( raw ) {
+
+#if SIZEOF_LONG == 8
+    if( !merge ) {
+      db_bin_get( line, plane, (sizeof( ulong ) * size) );
+    } else {
+      for( i=0; i<size; i++ ) {
+        db_bin_get( line, &word, sizeof( uint64 ) );
+        plane[i] |= (ulong)word;
+      }
+    }
+#else
+    for( i=0; i<size; i+=2 ) {
+      db_bin_get( line, &word, sizeof( uint64 ) );
+      plane[i] = merge ? (plane[i] | (ulong)(word & 0xffffffffLL)) : (ulong)(word & 0xffffffffLL);
+      if( (i + 1) < size ) {
+        plane[i + 1] = merge ? (plane[i + 1] | (ulong)(word >> 32)) : (ulong)(word >> 32);
+      }
+    }
+#endif
+
+  } else {
+
+    ulong fill;
+
+    db_bin_get( line, &word, sizeof( uint64 ) );
+    fill = (ulong)word;
+
+    for( i=0; i<size; i++ ) {
+      ulong val = (i == (size - 1)) ? (fill & UL_HMASK( width - 1 )) : fill;
+      plane[i]  = merge ? (plane[i] | val) : val;
+    }
+
+  }
+
+}
+
+/*!
+ \throws anonymous Throw db_bin_get db_bin_get db_bin_get vector_db_read_bin_plane
+
+ Creates a new vector structure and populates it with the vector information stored at the current position of
+ the binary CDD record being read (see vector_db_write_bin).
+*/
+void vector_db_read_bin(
+  vector** vec,  /*!< Pointer to vector to create */
+  char**   line  /*!< Pointer to current position in binary record */
+) { PROFILE(VECTOR_DB_READ_BIN);
+
+  uint32 hdr[2];  /* Width and supplemental field */
+  vsuppl suppl;   /* Temporary supplemental value */
+
+  db_bin_get( line, hdr, sizeof( hdr ) );
+
+  suppl.all = (uint8)hdr[1];
+
+  if( (hdr[0] == 0) && (suppl.part.owns_data == 1) ) {
+    print_output( "Unable to parse vector information in database file.  Unable to read.", FATAL, __FILE__, __LINE__ );
+    Throw 0;
+  }
+
+  /* Create new vector */
+  *vec              = vector_create( hdr[0], suppl.part.type, suppl.part.data_type, TRUE );
+  (*vec)->suppl.all = suppl.all;
+
+  if( suppl.part.owns_data == 1 ) {
+
+    Try {
+
+      switch( suppl.part.data_type ) {
+        case VDATA_UL :
+          {
+            uint32       raw;
+            unsigned int j;
+            db_bin_get( line, &raw, sizeof( uint32 ) );
+            for( j=0; j<vector_type_sizes[suppl.part.type]; j++ ) {
+              vector_db_read_bin_plane( line, VEC_PLANE( (*vec), j ), hdr[0], (((raw >> j) & 0x1) == 1), FALSE );
+            }
+          }
+          break;
+        case VDATA_R64 :
+          {
+            char* str;
+            db_bin_get( line, &((*vec)->value.r64->val), sizeof( double ) );
+            if( (str = db_bin_get_str( line )) != NULL ) {
+              (*vec)->value.r64->str = strdup_safe( str );
+            }
+          }
+          break;
+        case VDATA_R32 :
+          {
+            double val;
+            char*  str;
+            db_bin_get( line, &val, sizeof( double ) );
+            (*vec)->value.r32->val = (float)val;
+            if( (str = db_bin_get_str( line )) != NULL ) {
+              (*vec)->value.r32->str = strdup_safe( str );
+            }
+          }
+          break;
+        default :  assert( 0 );  break;
+      }
+
+    } Catch_anonymous {
+      vector_dealloc( *vec );
+      *vec = NULL;
+      Throw 0;
+    }
+
+  /* Otherwise, deallocate the vector data */
+  } else {
+
+    vector_dealloc_value( *vec );
+
+  }
+
+  PROFILE_END;
+
+}
+
 /*!
  \throws anonymous Throw Throw Throw
 
@@ -669,16 +1024,15 @@ void vector_db_merge(
 ) { PROFILE(VECTOR_DB_MERGE);
 
   unsigned int width;       /* Width of read vector */
+  unsigned int suppl_all;   /* Supplemental value as read */
   vsuppl       suppl;       /* Supplemental value of vector */
   int          chars_read;  /* Number of characters read */
 
   assert( base != NULL );
 
-  /*@-formatcode@*/
-  if( sscanf( *line, "%u %hhu%n", &width, &(suppl.all), &chars_read ) == 2 ) {
-  /*@=formatcode@*/
+  if( util_scan_uint( line, &width, 10 ) && util_scan_uint( line, &suppl_all, 10 ) ) {
 
-    *line = *line + chars_read;
+    suppl.all = (uint8)suppl_all;
 
     if( base->width != width ) {
 
@@ -706,10 +1060,9 @@ void vector_db_merge(
 #error "Unsupported long size"
 #endif
                   ulong val;
-                  if( sscanf( *line, "%lx%n", &val, &chars_read ) == 1 ) {
-                    *line += chars_read;
+                  if( util_scan_ulong( line, &val, 16 ) ) {
                     if( j >= 2 ) {
-                      base->value.ul[i][j] |= val;
+                      VEC_PLANE( base, j )[i] |= val;
                     }
                   } else {
                     print_output( "Unable to parse vector information in database file.  Unable to merge.", FATAL, __FILE__, __LINE__ );
@@ -719,14 +1072,13 @@ void vector_db_merge(
 #if SIZEOF_LONG == 8
                 /* If the CDD file size is 32-bit and we are 64-bit, store two elements to our one */
                 } else if( info_suppl.part.vec_ul_size == 2 ) {
-                  uint32 val;
-                  if( sscanf( *line, "%x%n", &val, &chars_read ) == 1 ) {
-                    *line += chars_read;
+                  unsigned int val;
+                  if( util_scan_uint( line, &val, 16 ) ) {
                     if( j >= 2 ) {
                       if( i == 0 ) {
-                        base->value.ul[i/2][j] = (ulong)val;
+                        VEC_PLANE( base, j )[i/2] = (ulong)val;
                       } else {
-                        base->value.ul[i/2][j] |= ((ulong)val << 32);
+                        VEC_PLANE( base, j )[i/2] |= ((ulong)val << 32);
                       }
                     }
                   } else {
@@ -743,8 +1095,8 @@ void vector_db_merge(
                   /*@=duplicatequals =ignorequals@*/
                     *line += chars_read;
                     if( j >= 2 ) {
-                      base->value.ul[(i*2)+0][j] = (ulong)(val & 0xffffffffLL);
-                      base->value.ul[(i*2)+1][j] = (ulong)((val >> 32) & 0xffffffffLL);
+                      VEC_PLANE( base, j )[(i*2)+0] = (ulong)(val & 0xffffffffLL);
+                      VEC_PLANE( base, j )[(i*2)+1] = (ulong)((val >> 32) & 0xffffffffLL);
                     }
                   } else {
                     print_output( "Unable to parse vector information in database file.  Unable to merge.", FATAL, __FILE__, __LINE__ );
@@ -800,6 +1152,57 @@ void vector_db_merge(
 
 }
 
+/*!
+ \throws anonymous Throw db_bin_get db_bin_get vector_db_read_bin_plane
+
+ Parses the vector information stored at the current position of the binary CDD record being read and merges it
+ into the base vector (see vector_db_merge).
+*/
+void vector_db_merge_bin(
+  vector* base,  /*!< Base vector to merge data into */
+  char**  line,  /*!< Pointer to current position in binary record */
+  bool    same   /*!< Specifies if vector to merge needs to be exactly the same as the existing vector */
+) { PROFILE(VECTOR_DB_MERGE_BIN);
+
+  uint32 hdr[2];  /* Width and supplemental field */
+  vsuppl suppl;   /* Supplemental value of vector */
+
+  assert( base != NULL );
+
+  db_bin_get( line, hdr, sizeof( hdr ) );
+
+  suppl.all = (uint8)hdr[1];
+
+  if( base->width != hdr[0] ) {
+
+    if( same ) {
+      print_output( "Attempting to merge databases derived from different designs.  Unable to merge",
+                    FATAL, __FILE__, __LINE__ );
+      Throw 0;
+    }
+
+  } else if( (base->suppl.part.owns_data == 1) && (suppl.part.owns_data == 1) && (base->suppl.part.data_type == VDATA_UL) ) {
+
+    uint32       raw;
+    unsigned int j;
+
+    db_bin_get( line, &raw, sizeof( uint32 ) );
+
+    /* The value planes are skipped and all other planes are merged */
+    for( j=0; j<vector_type_sizes[suppl.part.type]; j++ ) {
+      if( j < 2 ) {
+        *line += (((raw >> j) & 0x1) == 1) ? (sizeof( uint64 ) * ((hdr[0] + 63) / 64)) : sizeof( uint64 );
+      } else {
+        vector_db_read_bin_plane( line, VEC_PLANE( base, j ), hdr[0], (((raw >> j) & 0x1) == 1), TRUE );
+      }
+    }
+
+  }
+
+  PROFILE_END;
+
+}
+
 /*!
  Merges two vectors, placing the result back into the base vector.  This function is used by the GUI for calculating
  module coverage.
@@ -820,7 +1223,7 @@ void vector_merge(
       case VDATA_UL :
         for( i=0; i<UL_SIZE(base->width); i++ ) {
           for( j=2; j<vector_type_sizes[base->suppl.part.type]; j++ ) {
-            base->value.ul[i][j] |= other->value.ul[i][j];
+            VEC_PLANE( base, j )[i] |= VEC_PLANE( other, j )[i];
           }
         }
         break;
@@ -851,7 +1254,7 @@ int vector_get_eval_a(
   assert( vec->suppl.part.type == VTYPE_EXP );
 
   switch( vec->suppl.part.data_type ) {
-    case VDATA_UL  :  retval = (vec->value.ul[UL_DIV(index)][VTYPE_INDEX_EXP_EVAL_A] >> UL_MOD(index)) & 0x1;  break;
+    case VDATA_UL  :  retval = (VEC_PLANE( vec, VTYPE_INDEX_EXP_EVAL_A )[UL_DIV(index)] >> UL_MOD(index)) & 0x1;  break;
     case VDATA_R64 :  retval = 0;
     default        :  assert( 0 );  break;
   }
@@ -876,7 +1279,7 @@ int vector_get_eval_b(
   assert( vec->suppl.part.type == VTYPE_EXP );
 
   switch( vec->suppl.part.data_type ) {
-    case VDATA_UL  :  retval = (vec->value.ul[UL_DIV(index)][VTYPE_INDEX_EXP_EVAL_B] >> UL_MOD(index)) & 0x1;  break;
+    case VDATA_UL  :  retval = (VEC_PLANE( vec, VTYPE_INDEX_EXP_EVAL_B )[UL_DIV(index)] >> UL_MOD(index)) & 0x1;  break;
     case VDATA_R64 :  retval = 0;
     default        :  assert( 0 );  break;
   }
@@ -901,7 +1304,7 @@ int vector_get_eval_c(
   assert( vec->suppl.part.type == VTYPE_EXP );
 
   switch( vec->suppl.part.data_type ) {
-    case VDATA_UL  :  retval = (vec->value.ul[UL_DIV(index)][VTYPE_INDEX_EXP_EVAL_C] >> UL_MOD(index)) & 0x1;  break;
+    case VDATA_UL  :  retval = (VEC_PLANE( vec, VTYPE_INDEX_EXP_EVAL_C )[UL_DIV(index)] >> UL_MOD(index)) & 0x1;  break;
     case VDATA_R64 :  retval = 0;
     default        :  assert( 0 );  break;
   }
@@ -926,7 +1329,7 @@ int vector_get_eval_d(
   assert( vec->suppl.part.type == VTYPE_EXP );
 
   switch( vec->suppl.part.data_type ) {
-    case VDATA_UL  :  retval = (vec->value.ul[UL_DIV(index)][VTYPE_INDEX_EXP_EVAL_D] >> UL_MOD(index)) & 0x1;  break;
+    case VDATA_UL  :  retval = (VEC_PLANE( vec, VTYPE_INDEX_EXP_EVAL_D )[UL_DIV(index)] >> UL_MOD(index)) & 0x1;  break;
     case VDATA_R64 :  retval = 0;
     default        :  assert( 0 );  break;
   }
@@ -950,8 +1353,8 @@ int vector_get_eval_ab_count(
   switch( vec->suppl.part.data_type ) {
     case VDATA_UL :
       for( i=0; i<UL_SIZE( vec->width ); i++ ) {
-        ulong value_a = vec->value.ul[i][VTYPE_INDEX_EXP_EVAL_A];
-        ulong value_b = vec->value.ul[i][VTYPE_INDEX_EXP_EVAL_B];
+        ulong value_a = VEC_PLANE( vec, VTYPE_INDEX_EXP_EVAL_A )[i];
+        ulong value_b = VEC_PLANE( vec, VTYPE_INDEX_EXP_EVAL_B )[i];
         for( j=0; j<UL_BITS; j++ ) {
           count += (value_a >> j) & 0x1;
           count += (value_b >> j) & 0x1;
@@ -982,9 +1385,9 @@ int vector_get_eval_abc_count(
   switch( vec->suppl.part.data_type ) {
     case VDATA_UL :
       for( i=0; i<UL_SIZE( vec->width ); i++ ) {
-        ulong value_a = vec->value.ul[i][VTYPE_INDEX_EXP_EVAL_A]; 
-        ulong value_b = vec->value.ul[i][VTYPE_INDEX_EXP_EVAL_B]; 
-        ulong value_c = vec->value.ul[i][VTYPE_INDEX_EXP_EVAL_C]; 
+        ulong value_a = VEC_PLANE( vec, VTYPE_INDEX_EXP_EVAL_A )[i]; 
+        ulong value_b = VEC_PLANE( vec, VTYPE_INDEX_EXP_EVAL_B )[i]; 
+        ulong value_c = VEC_PLANE( vec, VTYPE_INDEX_EXP_EVAL_C )[i]; 
         for( j=0; j<UL_BITS; j++ ) {
           count += (value_a >> j) & 0x1;
           count += (value_b >> j) & 0x1;
@@ -1016,10 +1419,10 @@ int vector_get_eval_abcd_count(
   switch( vec->suppl.part.data_type ) {
     case VDATA_UL :
       for( i=0; i<UL_SIZE( vec->width ); i++ ) {
-        ulong value_a = vec->value.ul[i][VTYPE_INDEX_EXP_EVAL_A]; 
-        ulong value_b = vec->value.ul[i][VTYPE_INDEX_EXP_EVAL_B]; 
-        ulong value_c = vec->value.ul[i][VTYPE_INDEX_EXP_EVAL_C]; 
-        ulong value_d = vec->value.ul[i][VTYPE_INDEX_EXP_EVAL_D]; 
+        ulong value_a = VEC_PLANE( vec, VTYPE_INDEX_EXP_EVAL_A )[i]; 
+        ulong value_b = VEC_PLANE( vec, VTYPE_INDEX_EXP_EVAL_B )[i]; 
+        ulong value_c = VEC_PLANE( vec, VTYPE_INDEX_EXP_EVAL_C )[i]; 
+        ulong value_d = VEC_PLANE( vec, VTYPE_INDEX_EXP_EVAL_D )[i]; 
         for( j=0; j<UL_BITS; j++ ) {
           count += (value_a >> j) & 0x1;
           count += (value_b >> j) & 0x1;
@@ -1043,7 +1446,7 @@ int vector_get_eval_abcd_count(
  \return Returns a string showing the toggle 0 -> 1 information.
 */
 char* vector_get_toggle01_ulong(
-  ulong** value,  /*!< Pointer to vector data array to get string from */
+  ulong*  value,  /*!< Pointer to vector data array to get string from */
   int     width   /*!< Width of given vector data array */
 ) { PROFILE(VECTOR_GET_TOGGLE01_ULONG);
 
@@ -1053,7 +1456,7 @@ char* vector_get_toggle01_ulong(
 
   for( i=width; i--; ) {
     /*@-formatcode@*/
-    unsigned int rv = snprintf( tmp, 2, "%hhx", (unsigned char)((value[UL_DIV(i)][VTYPE_INDEX_SIG_TOG01] >> UL_MOD(i)) & 0x1) );
+    unsigned int rv = snprintf( tmp, 2, "%hhx", (unsigned char)((UL_PLANE( value, width, VTYPE_INDEX_SIG_TOG01 )[UL_DIV(i)] >> UL_MOD(i)) & 0x1) );
     /*@=formatcode@*/
     assert( rv < 2 );
     bits[i] = tmp[0];
@@ -1071,7 +1474,7 @@ char* vector_get_toggle01_ulong(
  \return Returns a string showing the toggle 1 -> 0 information.
 */
 char* vector_get_toggle10_ulong(
-  ulong** value,  /*!< Pointer to vector data array to get string from */
+  ulong*  value,  /*!< Pointer to vector data array to get string from */
   int     width   /*!< Width of given vector data array */
 ) { PROFILE(VECTOR_GET_TOGGLE10_ULONG);
 
@@ -1081,7 +1484,7 @@ char* vector_get_toggle10_ulong(
   
   for( i=width; i--; ) {
     /*@-formatcode@*/ 
-    unsigned int rv = snprintf( tmp, 2, "%hhx", (unsigned char)((value[UL_DIV(i)][VTYPE_INDEX_SIG_TOG10] >> UL_MOD(i)) & 0x1) );
+    unsigned int rv = snprintf( tmp, 2, "%hhx", (unsigned char)((UL_PLANE( value, width, VTYPE_INDEX_SIG_TOG10 )[UL_DIV(i)] >> UL_MOD(i)) & 0x1) );
     /*@=formatcode@*/ 
     assert( rv < 2 );
     bits[i] = tmp[0];
@@ -1100,7 +1503,7 @@ char* vector_get_toggle10_ulong(
  stream specified in ofile.
 */
 void vector_display_toggle01_ulong(
-  ulong** value,  /*!< Value array to display toggle information */
+  ulong*  value,  /*!< Value array to display toggle information */
   int     width,  /*!< Number of bits in value array to display */
   FILE*   ofile   /*!< Stream to output information to */
 ) { PROFILE(VECTOR_DISPLAY_TOGGLE01_ULONG);
@@ -1113,7 +1516,7 @@ void vector_display_toggle01_ulong(
 
   for( i=UL_SIZE(width); i--; ) {
     for( j=bits_left; j>=0; j-- ) {
-      nib |= (((value[i][VTYPE_INDEX_SIG_TOG01] >> (unsigned int)j) & 0x1) << ((unsigned int)j % 4));
+      nib |= (((UL_PLANE( value, width, VTYPE_INDEX_SIG_TOG01 )[i] >> (unsigned int)j) & 0x1) << ((unsigned int)j % 4));
       if( (j % 4) == 0 ) {
         fprintf( ofile, "%1x", nib );
         nib = 0;
@@ -1134,7 +1537,7 @@ void vector_display_toggle01_ulong(
  stream specified in ofile.
 */
 void vector_display_toggle10_ulong(
-  ulong** value,  /*!< Value array to display toggle information */
+  ulong*  value,  /*!< Value array to display toggle information */
   int     width,  /*!< Number of bits of value array to display */
   FILE*   ofile   /*!< Stream to output information to */
 ) { PROFILE(VECTOR_DISPLAY_TOGGLE10_ULONG);
@@ -1147,7 +1550,7 @@ void vector_display_toggle10_ulong(
       
   for( i=UL_SIZE(width); i--; ) {
     for( j=bits_left; j>=0; j-- ) {
-      nib |= (((value[i][VTYPE_INDEX_SIG_TOG10] >> (unsigned int)j) & 0x1) << ((unsigned int)j % 4));
+      nib |= (((UL_PLANE( value, width, VTYPE_INDEX_SIG_TOG10 )[i] >> (unsigned int)j) & 0x1) << ((unsigned int)j % 4));
       if( (j % 4) == 0 ) {
         fprintf( ofile, "%1x", nib );
         nib = 0;
@@ -1167,7 +1570,7 @@ void vector_display_toggle10_ulong(
  Displays the binary value of the specified ulong vector data array to standard output.
 */
 void vector_display_value_ulong(
-  ulong** value,  /*!< Pointer to vector value array */
+  ulong*  value,  /*!< Pointer to vector value array */
   int     width   /*!< Number of elements in value array */
 ) {
 
@@ -1178,10 +1581,10 @@ void vector_display_value_ulong(
 
   for( i=UL_SIZE(width); i--; ) {
     for( j=bits_left; j>=0; j-- ) {
-      if( ((value[i][VTYPE_INDEX_VAL_VALH] >> (unsigned int)j) & 0x1) == 0 ) {
-        printf( "%lu", ((value[i][VTYPE_INDEX_VAL_VALL] >> (unsigned int)j) & 0x1) );
+      if( ((UL_PLANE( value, width, VTYPE_INDEX_VAL_VALH )[i] >> (unsigned int)j) & 0x1) == 0 ) {
+        printf( "%lu", ((UL_PLANE( value, width, VTYPE_INDEX_VAL_VALL )[i] >> (unsigned int)j) & 0x1) );
       } else {
-        if( ((value[i][VTYPE_INDEX_VAL_VALL] >> (unsigned int)j) & 0x1) == 0 ) {
+        if( ((UL_PLANE( value, width, VTYPE_INDEX_VAL_VALL )[i] >> (unsigned int)j) & 0x1) == 0 ) {
           printf( "x" );
         } else {
           printf( "z" );
@@ -1229,7 +1632,7 @@ static void vector_display_value_ulongs(
  width parameter.
 */
 void vector_display_ulong(
-  ulong**      value,  /*!< Value array to display */
+  ulong*       value,  /*!< Value array to display */
   unsigned int width,  /*!< Number of bits in array to display */
   unsigned int type   /*!< Type of vector to display */
 ) {
@@ -1239,7 +1642,7 @@ void vector_display_ulong(
   for( i=0; i<vector_type_sizes[type]; i++ ) {
     for( j=UL_SIZE(width); j--; ) {
       /*@-formatcode@*/
-      printf( " %lx", value[j][i] );
+      printf( " %lx", UL_PLANE( value, width, i )[j] );
       /*@=formatcode@*/
     }
   }
@@ -1269,9 +1672,9 @@ void vector_display_ulong(
       for( i=UL_SIZE(width); i--; ) {
         /*@-formatcode@*/
 #if SIZEOF_LONG == 4
-        printf( "%08lx", value[i][VTYPE_INDEX_EXP_EVAL_A] );
+        printf( "%08lx", UL_PLANE( value, width, VTYPE_INDEX_EXP_EVAL_A )[i] );
 #elif SIZEOF_LONG == 8
-        printf( "%016lx", value[i][VTYPE_INDEX_EXP_EVAL_A] );
+        printf( "%016lx", UL_PLANE( value, width, VTYPE_INDEX_EXP_EVAL_A )[i] );
 #else
 #error "Unsupported long size"
 #endif
@@ -1283,9 +1686,9 @@ void vector_display_ulong(
       for( i=UL_SIZE(width); i--; ) {
         /*@-formatcode@*/
 #if SIZEOF_LONG == 4
-        printf( "%08lx", value[i][VTYPE_INDEX_EXP_EVAL_B] );
+        printf( "%08lx", UL_PLANE( value, width, VTYPE_INDEX_EXP_EVAL_B )[i] );
 #elif SIZEOF_LONG == 8
-        printf( "%016lx", value[i][VTYPE_INDEX_EXP_EVAL_B] );
+        printf( "%016lx", UL_PLANE( value, width, VTYPE_INDEX_EXP_EVAL_B )[i] );
 #endif
         /*@=formatcode@*/
       }
@@ -1295,9 +1698,9 @@ void vector_display_ulong(
       for( i=UL_SIZE(width); i--; ) {
         /*@-formatcode@*/
 #if SIZEOF_LONG == 4
-        printf( "%08lx", value[i][VTYPE_INDEX_EXP_EVAL_C] );
+        printf( "%08lx", UL_PLANE( value, width, VTYPE_INDEX_EXP_EVAL_C )[i] );
 #elif SIZEOF_LONG == 8
-        printf( "%016lx", value[i][VTYPE_INDEX_EXP_EVAL_C] );
+        printf( "%016lx", UL_PLANE( value, width, VTYPE_INDEX_EXP_EVAL_C )[i] );
 #endif
         /*@=formatcode@*/
       }
@@ -1307,9 +1710,9 @@ void vector_display_ulong(
       for( i=UL_SIZE(width); i--; ) {
         /*@-formatcode@*/
 #if SIZEOF_LONG == 4
-        printf( "%08lx", value[i][VTYPE_INDEX_EXP_EVAL_D] );
+        printf( "%08lx", UL_PLANE( value, width, VTYPE_INDEX_EXP_EVAL_D )[i] );
 #elif SIZEOF_LONG == 8
-        printf( "%016lx", value[i][VTYPE_INDEX_EXP_EVAL_D] );
+        printf( "%016lx", UL_PLANE( value, width, VTYPE_INDEX_EXP_EVAL_D )[i] );
 #endif
         /*@=formatcode@*/
       }
@@ -1331,9 +1734,9 @@ void vector_display_ulong(
       for( i=UL_SIZE(width); i--; ) {
         /*@-formatcode@*/
 #if SIZEOF_LONG == 4
-        printf( "%08lx", value[i][VTYPE_INDEX_MEM_WR] );
+        printf( "%08lx", UL_PLANE( value, width, VTYPE_INDEX_MEM_WR )[i] );
 #elif SIZEOF_LONG == 8
-        printf( "%016lx", value[i][VTYPE_INDEX_MEM_WR] );
+        printf( "%016lx", UL_PLANE( value, width, VTYPE_INDEX_MEM_WR )[i] );
 #endif
         /*@=formatcode@*/
       }
@@ -1343,9 +1746,9 @@ void vector_display_ulong(
       for( i=UL_SIZE(width); i--; ) {
         /*@-formatcode@*/
 #if SIZEOF_LONG == 4
-        printf( "%08lx", value[i][VTYPE_INDEX_MEM_RD] );
+        printf( "%08lx", UL_PLANE( value, width, VTYPE_INDEX_MEM_RD )[i] );
 #elif SIZEOF_LONG == 8
-        printf( "%016lx", value[i][VTYPE_INDEX_MEM_RD] );
+        printf( "%016lx", UL_PLANE( value, width, VTYPE_INDEX_MEM_RD )[i] );
 #endif
         /*@=formatcode@*/
       }
@@ -1427,8 +1830,8 @@ void vector_toggle_count(
       case VDATA_UL :
         for( i=0; i<UL_SIZE(vec->width); i++ ) {
           for( j=0; j<UL_BITS; j++ ) {
-            *tog01_cnt += ((vec->value.ul[i][VTYPE_INDEX_SIG_TOG01] >> j) & 0x1);
-            *tog10_cnt += ((vec->value.ul[i][VTYPE_INDEX_SIG_TOG10] >> j) & 0x1);
+            *tog01_cnt += ((VEC_PLANE( vec, VTYPE_INDEX_SIG_TOG01 )[i] >> j) & 0x1);
+            *tog10_cnt += ((VEC_PLANE( vec, VTYPE_INDEX_SIG_TOG10 )[i] >> j) & 0x1);
           }
         }
         break;
@@ -1443,6 +1846,33 @@ void vector_toggle_count(
 
 }
 
+/*!
+ Sets the toggle01 and toggle10 bits of the lower 64 bits of the specified signal vector from the given
+ toggle bitmaps.
+*/
+void vector_set_toggles(
+  vector* vec,    /*!< Pointer to vector to set */
+  uint64  tog01,  /*!< Bitmap of bits that toggled from 0 to 1 */
+  uint64  tog10   /*!< Bitmap of bits that toggled from 1 to 0 */
+) { PROFILE(VECTOR_SET_TOGGLES);
+
+  if( (vec->suppl.part.type == VTYPE_SIG) && (vec->suppl.part.data_type == VDATA_UL) && ((tog01 | tog10) != 0) ) {
+
+    unsigned int width = (vec->width < 64) ? vec->width : 64;
+    unsigned int i;
+
+    for( i=0; i<UL_SIZE( width ); i++ ) {
+      ulong mask = (i == UL_DIV( width - 1 )) ? UL_HMASK( width - 1 ) : UL_SET;
+      VEC_PLANE( vec, VTYPE_INDEX_SIG_TOG01 )[i] |= (ulong)(tog01 >> (i * UL_BITS)) & mask;
+      VEC_PLANE( vec, VTYPE_INDEX_SIG_TOG10 )[i] |= (ulong)(tog10 >> (i * UL_BITS)) & mask;
+    }
+
+  }
+
+  PROFILE_END;
+
+}
+
 /*!
  Counts the number of bits that were written and read for the given memory
  vector.
@@ -1467,8 +1897,8 @@ void vector_mem_rw_count(
         }
         for( i=UL_DIV(lsb); i<=UL_DIV(msb); i++ ) {
           ulong mask = (i == UL_DIV(lsb)) ? lmask : ((i == UL_DIV(msb)) ? hmask : UL_SET);
-          ulong wr   = vec->value.ul[i][VTYPE_INDEX_MEM_WR] & mask;
-          ulong rd   = vec->value.ul[i][VTYPE_INDEX_MEM_RD] & mask;
+          ulong wr   = VEC_PLANE( vec, VTYPE_INDEX_MEM_WR )[i] & mask;
+          ulong rd   = VEC_PLANE( vec, VTYPE_INDEX_MEM_RD )[i] & mask;
           for( j=0; j<UL_BITS; j++ ) {
             *wr_cnt += (wr >> j) & 0x1;
             *rd_cnt += (rd >> j) & 0x1;
@@ -1513,17 +1943,17 @@ bool vector_set_assigned(
         int   msb_index = UL_DIV(msb);
         if( i == msb_index ) {
           lmask &= hmask;
-          prev_assigned = ((vec->value.ul[i][VTYPE_INDEX_SIG_MISC] & lmask) != 0);
-          vec->value.ul[i][VTYPE_INDEX_SIG_MISC] |= lmask;
+          prev_assigned = ((VEC_PLANE( vec, VTYPE_INDEX_SIG_MISC )[i] & lmask) != 0);
+          VEC_PLANE( vec, VTYPE_INDEX_SIG_MISC )[i] |= lmask;
         } else {
-          prev_assigned |= ((vec->value.ul[i][VTYPE_INDEX_SIG_MISC] & lmask) != 0);
-          vec->value.ul[i][VTYPE_INDEX_SIG_MISC] |= lmask;
+          prev_assigned |= ((VEC_PLANE( vec, VTYPE_INDEX_SIG_MISC )[i] & lmask) != 0);
+          VEC_PLANE( vec, VTYPE_INDEX_SIG_MISC )[i] |= lmask;
           for( i++; i<msb_index; i++ ) {
-            prev_assigned = (vec->value.ul[i][VTYPE_INDEX_SIG_MISC] != 0);
-            vec->value.ul[i][VTYPE_INDEX_SIG_MISC] |= UL_SET;
+            prev_assigned = (VEC_PLANE( vec, VTYPE_INDEX_SIG_MISC )[i] != 0);
+            VEC_PLANE( vec, VTYPE_INDEX_SIG_MISC )[i] |= UL_SET;
           }
-          prev_assigned |= ((vec->value.ul[i][VTYPE_INDEX_SIG_MISC] & hmask) != 0);
-          vec->value.ul[i][VTYPE_INDEX_SIG_MISC] |= hmask;
+          prev_assigned |= ((VEC_PLANE( vec, VTYPE_INDEX_SIG_MISC )[i] & hmask) != 0);
+          VEC_PLANE( vec, VTYPE_INDEX_SIG_MISC )[i] |= hmask;
         }
       }
       break;
@@ -1539,13 +1969,244 @@ bool vector_set_assigned(
 }
 
 /*!
- \return Returns TRUE if the assigned value has changed; otherwise, returns FALSE.
+ \return Returns TRUE if any of the assigned words changed value; otherwise, returns FALSE.
 
- This function is called after a value has been stored in the SCRATCH arrays.  This
- function calculates the vector coverage information based on the vector type and performs the assignment
- from the SCRATCH array to the 
+ Assigns words first through last of the scratch arrays to the given signal or memory vector (using
+ lmask for the first word and hmask for the last word), updating the toggle, X-hold and misc planes
+ (and the write plane of a memory) for every word whose value changes.  Toggles are only recorded
+ if tog is TRUE.  This is the portable implementation of vector_toggle_words.
 */
-bool vector_set_coverage_and_assign_ulong(
+static bool vector_toggle_words_scalar(
+  vector*      vec,       /*!< Pointer to signal or memory vector to assign */
+  const ulong* scratchl,  /*!< Pointer to scratch array containing new lower data */
+  const ulong* scratchh,  /*!< Pointer to scratch array containing new upper data */
+  unsigned int first,     /*!< Index of first word to assign */
+  unsigned int last,      /*!< Index of last word to assign */
+  ulong        lmask,     /*!< Mask of bits to assign in the first word */
+  ulong        hmask,     /*!< Mask of bits to assign in the last word */
+  bool         tog        /*!< Set to TRUE if toggles should be recorded */
+) {
+
+  bool         changed = FALSE;
+  bool         is_mem  = (vec->suppl.part.type == VTYPE_MEM);
+  ulong*       vall    = VEC_PLANE( vec, VTYPE_INDEX_SIG_VALL );
+  ulong*       valh    = VEC_PLANE( vec, VTYPE_INDEX_SIG_VALH );
+  ulong*       xhold   = VEC_PLANE( vec, VTYPE_INDEX_SIG_XHOLD );
+  ulong*       tog01   = VEC_PLANE( vec, VTYPE_INDEX_SIG_TOG01 );
+  ulong*       tog10   = VEC_PLANE( vec, VTYPE_INDEX_SIG_TOG10 );
+  ulong*       misc    = VEC_PLANE( vec, (is_mem ? VTYPE_INDEX_MEM_MISC : VTYPE_INDEX_SIG_MISC) );
+  ulong*       wr      = is_mem ? VEC_PLANE( vec, VTYPE_INDEX_MEM_WR ) : NULL;
+  unsigned int i;
+
+  for( i=first; i<=last; i++ ) {
+    ulong  mask  = ((i==first) ? lmask : UL_SET) & ((i==last) ? hmask : UL_SET);
+    ulong  fvall = scratchl[i] & mask;
+    ulong  fvalh = scratchh[i] & mask;
+    ulong  tvall = vall[i];
+    ulong  tvalh = valh[i];
+    if( (fvall != (tvall & mask)) || (fvalh != (tvalh & mask)) ) {
+      ulong tvalx = tvalh & ~tvall & misc[i];
+      ulong xval  = xhold[i];
+      ulong xmask = mask & ~tvalh;
+      if( tog ) {
+        tog01[i] |= ((~tvalh & ~tvall) | (tvalx & ~xval)) & (~fvalh &  fvall) & mask;
+        tog10[i] |= ((~tvalh &  tvall) | (tvalx &  xval)) & (~fvalh & ~fvall) & mask;
+      }
+      if( is_mem ) {
+        wr[i] |= mask;
+      }
+      vall[i]  = (tvall & ~mask)  | fvall;
+      valh[i]  = (tvalh & ~mask)  | fvalh;
+      xhold[i] = (xval  & ~xmask) | (tvall & xmask);
+      misc[i] |= ~fvalh & mask;
+      changed = TRUE;
+    }
+  }
+
+  return( changed );
+
+}
+
+#ifdef VECTOR_TOGGLE_SIMD
+/*!
+ \return Returns TRUE if any of the assigned words changed value; otherwise, returns FALSE.
+
+ SSE2 implementation of vector_toggle_words.  The edge words and any words left over after the last
+ full register are assigned by vector_toggle_words_scalar; the remaining words are assigned two at a
+ time using the same bit equations.  Each lane is masked with all ones if its word changed value, as
+ unchanged words must keep their X-hold and misc values.  The new value of an unchanged word equals
+ its old value, so the value planes are stored unconditionally.
+*/
+static bool vector_toggle_words_sse2(
+  vector*      vec,       /*!< Pointer to signal or memory vector to assign */
+  const ulong* scratchl,  /*!< Pointer to scratch array containing new lower data */
+  const ulong* scratchh,  /*!< Pointer to scratch array containing new upper data */
+  unsigned int first,     /*!< Index of first word to assign */
+  unsigned int last,      /*!< Index of last word to assign */
+  ulong        lmask,     /*!< Mask of bits to assign in the first word */
+  ulong        hmask,     /*!< Mask of bits to assign in the last word */
+  bool         tog        /*!< Set to TRUE if toggles should be recorded */
+) {
+
+  bool         changed;
+  bool         is_mem = (vec->suppl.part.type == VTYPE_MEM);
+  ulong*       vall   = VEC_PLANE( vec, VTYPE_INDEX_SIG_VALL );
+  ulong*       valh   = VEC_PLANE( vec, VTYPE_INDEX_SIG_VALH );
+  ulong*       xhold  = VEC_PLANE( vec, VTYPE_INDEX_SIG_XHOLD );
+  ulong*       tog01  = VEC_PLANE( vec, VTYPE_INDEX_SIG_TOG01 );
+  ulong*       tog10  = VEC_PLANE( vec, VTYPE_INDEX_SIG_TOG10 );
+  ulong*       misc   = VEC_PLANE( vec, (is_mem ? VTYPE_INDEX_MEM_MISC : VTYPE_INDEX_SIG_MISC) );
+  ulong*       wr     = is_mem ? VEC_PLANE( vec, VTYPE_INDEX_MEM_WR ) : NULL;
+  __m128i      ones   = _mm_set1_epi32( -1 );
+  __m128i      any    = _mm_setzero_si128();
+  unsigned int i;
+
+  if( (last - first) <= 2 ) {
+    return( vector_toggle_words_scalar( vec, scratchl, scratchh, first, last, lmask, hmask, tog ) );
+  }
+
+  changed = vector_toggle_words_scalar( vec, scratchl, scratchh, first, first, lmask, UL_SET, tog );
+
+  for( i=(first + 1); (i + 2) <= last; i+=2 ) {
+    __m128i fl   = _mm_loadu_si128( (const __m128i*)(scratchl + i) );
+    __m128i fh   = _mm_loadu_si128( (const __m128i*)(scratchh + i) );
+    __m128i tl   = _mm_loadu_si128( (const __m128i*)(vall + i) );
+    __m128i th   = _mm_loadu_si128( (const __m128i*)(valh + i) );
+    __m128i m    = _mm_loadu_si128( (const __m128i*)(misc + i) );
+    __m128i x    = _mm_loadu_si128( (const __m128i*)(xhold + i) );
+    __m128i eq   = _mm_cmpeq_epi32( _mm_or_si128( _mm_xor_si128( fl, tl ), _mm_xor_si128( fh, th ) ), _mm_setzero_si128() );
+    __m128i lane = _mm_andnot_si128( _mm_and_si128( eq, _mm_shuffle_epi32( eq, _MM_SHUFFLE( 2, 3, 0, 1 ) ) ), ones );
+    __m128i xm   = _mm_andnot_si128( th, lane );
+    if( tog ) {
+      __m128i tx  = _mm_and_si128( _mm_andnot_si128( tl, th ), m );
+      __m128i t01 = _mm_and_si128( _mm_or_si128( _mm_andnot_si128( _mm_or_si128( th, tl ), ones ), _mm_andnot_si128( x, tx ) ), _mm_andnot_si128( fh, fl ) );
+      __m128i t10 = _mm_and_si128( _mm_or_si128( _mm_andnot_si128( th, tl ), _mm_and_si128( tx, x ) ), _mm_andnot_si128( _mm_or_si128( fh, fl ), ones ) );
+      _mm_storeu_si128( (__m128i*)(tog01 + i), _mm_or_si128( _mm_loadu_si128( (const __m128i*)(tog01 + i) ), _mm_and_si128( t01, lane ) ) );
+      _mm_storeu_si128( (__m128i*)(tog10 + i), _mm_or_si128( _mm_loadu_si128( (const __m128i*)(tog10 + i) ), _mm_and_si128( t10, lane ) ) );
+    }
+    if( is_mem ) {
+      _mm_storeu_si128( (__m128i*)(wr + i), _mm_or_si128( _mm_loadu_si128( (const __m128i*)(wr + i) ), lane ) );
+    }
+    _mm_storeu_si128( (__m128i*)(vall + i),  fl );
+    _mm_storeu_si128( (__m128i*)(valh + i),  fh );
+    _mm_storeu_si128( (__m128i*)(xhold + i), _mm_or_si128( _mm_andnot_si128( xm, x ), _mm_and_si128( tl, xm ) ) );
+    _mm_storeu_si128( (__m128i*)(misc + i),  _mm_or_si128( m, _mm_andnot_si128( fh, lane ) ) );
+    any = _mm_or_si128( any, lane );
+  }
+
+  changed |= (_mm_movemask_epi8( _mm_cmpeq_epi8( any, _mm_setzero_si128() ) ) != 0xffff);
+  changed |= vector_toggle_words_scalar( vec, scratchl, scratchh, i, last, UL_SET, hmask, tog );
+
+  return( changed );
+
+}
+
+/*!
+ \return Returns TRUE if any of the assigned words changed value; otherwise, returns FALSE.
+
+ AVX2 implementation of vector_toggle_words.  This is the same as vector_toggle_words_sse2 except that
+ four words are assigned at a time.
+*/
+__attribute__((target("avx2"))) static bool vector_toggle_words_avx2(
+  vector*      vec,       /*!< Pointer to signal or memory vector to assign */
+  const ulong* scratchl,  /*!< Pointer to scratch array containing new lower data */
+  const ulong* scratchh,  /*!< Pointer to scratch array containing new upper data */
+  unsigned int first,     /*!< Index of first word to assign */
+  unsigned int last,      /*!< Index of last word to assign */
+  ulong        lmask,     /*!< Mask of bits to assign in the first word */
+  ulong        hmask,     /*!< Mask of bits to assign in the last word */
+  bool         tog        /*!< Set to TRUE if toggles should be recorded */
+) {
+
+  bool         changed;
+  bool         is_mem = (vec->suppl.part.type == VTYPE_MEM);
+  ulong*       vall   = VEC_PLANE( vec, VTYPE_INDEX_SIG_VALL );
+  ulong*       valh   = VEC_PLANE( vec, VTYPE_INDEX_SIG_VALH );
+  ulong*       xhold  = VEC_PLANE( vec, VTYPE_INDEX_SIG_XHOLD );
+  ulong*       tog01  = VEC_PLANE( vec, VTYPE_INDEX_SIG_TOG01 );
+  ulong*       tog10  = VEC_PLANE( vec, VTYPE_INDEX_SIG_TOG10 );
+  ulong*       misc   = VEC_PLANE( vec, (is_mem ? VTYPE_INDEX_MEM_MISC : VTYPE_INDEX_SIG_MISC) );
+  ulong*       wr     = is_mem ? VEC_PLANE( vec, VTYPE_INDEX_MEM_WR ) : NULL;
+  __m256i      ones   = _mm256_set1_epi32( -1 );
+  __m256i      any    = _mm256_setzero_si256();
+  unsigned int i;
+
+  if( (last - first) <= 4 ) {
+    return( vector_toggle_words_scalar( vec, scratchl, scratchh, first, last, lmask, hmask, tog ) );
+  }
+
+  changed = vector_toggle_words_scalar( vec, scratchl, scratchh, first, first, lmask, UL_SET, tog );
+
+  for( i=(first + 1); (i + 4) <= last; i+=4 ) {
+    __m256i fl   = _mm256_loadu_si256( (const __m256i*)(scratchl + i) );
+    __m256i fh   = _mm256_loadu_si256( (const __m256i*)(scratchh + i) );
+    __m256i tl   = _mm256_loadu_si256( (const __m256i*)(vall + i) );
+    __m256i th   = _mm256_loadu_si256( (const __m256i*)(valh + i) );
+    __m256i m    = _mm256_loadu_si256( (const __m256i*)(misc + i) );
+    __m256i x    = _mm256_loadu_si256( (const __m256i*)(xhold + i) );
+    __m256i lane = _mm256_andnot_si256( _mm256_cmpeq_epi64( _mm256_or_si256( _mm256_xor_si256( fl, tl ), _mm256_xor_si256( fh, th ) ), _mm256_setzero_si256() ), ones );
+    __m256i xm   = _mm256_andnot_si256( th, lane );
+    if( tog ) {
+      __m256i tx  = _mm256_and_si256( _mm256_andnot_si256( tl, th ), m );
+      __m256i t01 = _mm256_and_si256( _mm256_or_si256( _mm256_andnot_si256( _mm256_or_si256( th, tl ), ones ), _mm256_andnot_si256( x, tx ) ), _mm256_andnot_si256( fh, fl ) );
+      __m256i t10 = _mm256_and_si256( _mm256_or_si256( _mm256_andnot_si256( th, tl ), _mm256_and_si256( tx, x ) ), _mm256_andnot_si256( _mm256_or_si256( fh, fl ), ones ) );
+      _mm256_storeu_si256( (__m256i*)(tog01 + i), _mm256_or_si256( _mm256_loadu_si256( (const __m256i*)(tog01 + i) ), _mm256_and_si256( t01, lane ) ) );
+      _mm256_storeu_si256( (__m256i*)(tog10 + i), _mm256_or_si256( _mm256_loadu_si256( (const __m256i*)(tog10 + i) ), _mm256_and_si256( t10, lane ) ) );
+    }
+    if( is_mem ) {
+      _mm256_storeu_si256( (__m256i*)(wr + i), _mm256_or_si256( _mm256_loadu_si256( (const __m256i*)(wr + i) ), lane ) );
+    }
+    _mm256_storeu_si256( (__m256i*)(vall + i),  fl );
+    _mm256_storeu_si256( (__m256i*)(valh + i),  fh );
+    _mm256_storeu_si256( (__m256i*)(xhold + i), _mm256_or_si256( _mm256_andnot_si256( xm, x ), _mm256_and_si256( tl, xm ) ) );
+    _mm256_storeu_si256( (__m256i*)(misc + i),  _mm256_or_si256( m, _mm256_andnot_si256( fh, lane ) ) );
+    any = _mm256_or_si256( any, lane );
+  }
+
+  changed |= !_mm256_testz_si256( any, any );
+  changed |= vector_toggle_words_scalar( vec, scratchl, scratchh, i, last, UL_SET, hmask, tog );
+
+  return( changed );
+
+}
+#endif
+
+/*!
+ \return Returns TRUE if any of the assigned words changed value; otherwise, returns FALSE.
+
+ Selects the fastest implementation of vector_toggle_words that the running CPU supports, installs it
+ and calls it.  This is only called on the first signal or memory assignment.
+*/
+static bool vector_toggle_words_select(
+  vector*      vec,       /*!< Pointer to signal or memory vector to assign */
+  const ulong* scratchl,  /*!< Pointer to scratch array containing new lower data */
+  const ulong* scratchh,  /*!< Pointer to scratch array containing new upper data */
+  unsigned int first,     /*!< Index of first word to assign */
+  unsigned int last,      /*!< Index of last word to assign */
+  ulong        lmask,     /*!< Mask of bits to assign in the first word */
+  ulong        hmask,     /*!< Mask of bits to assign in the last word */
+  bool         tog        /*!< Set to TRUE if toggles should be recorded */
+) {
+
+#ifdef VECTOR_TOGGLE_SIMD
+  __builtin_cpu_init();
+  vector_toggle_words = __builtin_cpu_supports( "avx2" ) ? vector_toggle_words_avx2 : vector_toggle_words_sse2;
+#else
+  vector_toggle_words = vector_toggle_words_scalar;
+#endif
+
+  return( vector_toggle_words( vec, scratchl, scratchh, first, last, lmask, hmask, tog ) );
+
+}
+
+/*!
+ \return Returns TRUE if the assigned value has changed; otherwise, returns FALSE.
+
+ This function is called after a value has been stored in the SCRATCH arrays.  This
+ function calculates the vector coverage information based on the vector type and performs the assignment
+ from the SCRATCH array to the 
+*/
+bool vector_set_coverage_and_assign_ulong(
   vector*      vec,       /*!< Pointer to vector to calculate coverage metrics for and perform scratch -> actual assignment */
   const ulong* scratchl,  /*!< Pointer to scratch array containing new lower data */
   const ulong* scratchh,  /*!< Pointer to scratch array containing new upper data */
@@ -1559,88 +2220,81 @@ bool vector_set_coverage_and_assign_ulong(
   ulong        lmask   = UL_LMASK(lsb);  /* Mask to be used in lower element */
   ulong        hmask   = UL_HMASK(msb);  /* Mask to be used in upper element */
   unsigned int i;                        /* Loop iterator */
-  uint8        prev_set;                 /* Specifies if this vector value has previously been set */
 
   /* If the lindex and hindex are the same, set lmask to the AND of the high and low masks */
   if( lindex == hindex ) {
     lmask &= hmask;
   }
 
-  switch( vec->suppl.part.type ) {
-    case VTYPE_VAL :
-      for( i=lindex; i<=hindex; i++ ) {
-        ulong* tvall = &(vec->value.ul[i][VTYPE_INDEX_SIG_VALL]);
-        ulong* tvalh = &(vec->value.ul[i][VTYPE_INDEX_SIG_VALH]);
-        ulong  mask  = (i==lindex) ? lmask : (i==hindex ? hmask : UL_SET);
-        *tvall = (*tvall & ~mask) | (scratchl[i] & mask);
-        *tvalh = (*tvalh & ~mask) | (scratchh[i] & mask);
-      }
-      changed = TRUE;
-      break;
-    case VTYPE_SIG :
-      prev_set = vec->suppl.part.set;
-      for( i=lindex; i<=hindex; i++ ) {
-        ulong* entry = vec->value.ul[i];
-        ulong  mask  = (i==lindex) ? lmask : (i==hindex ? hmask : UL_SET);
-        ulong  fvall = scratchl[i] & mask;
-        ulong  fvalh = scratchh[i] & mask;
-        ulong  tvall = entry[VTYPE_INDEX_SIG_VALL];
-        ulong  tvalh = entry[VTYPE_INDEX_SIG_VALH];
-        if( (fvall != (tvall & mask)) || (fvalh != (tvalh & mask)) ) {
-          ulong tvalx = tvalh & ~tvall & entry[VTYPE_INDEX_SIG_MISC];
-          ulong xval  = entry[VTYPE_INDEX_SIG_XHOLD];
-          ulong xmask = mask & ~tvalh;
-          if( prev_set == 1 ) {
-            entry[VTYPE_INDEX_SIG_TOG01] |= ((~tvalh & ~tvall) | (tvalx & ~xval)) & (~fvalh &  fvall) & mask;
-            entry[VTYPE_INDEX_SIG_TOG10] |= ((~tvalh &  tvall) | (tvalx &  xval)) & (~fvalh & ~fvall) & mask;
-          }
-          entry[VTYPE_INDEX_SIG_VALL]  = (tvall & ~mask)  | fvall;
-          entry[VTYPE_INDEX_SIG_VALH]  = (tvalh & ~mask)  | fvalh;
-          entry[VTYPE_INDEX_SIG_XHOLD] = (xval  & ~xmask) | (tvall & xmask);
-          entry[VTYPE_INDEX_SIG_MISC] |= ~fvalh & mask;
-          changed = TRUE;
+  /* Single-word signal and expression values (the common case) are handled without the word loop */
+  if( (lindex == hindex) && ((vec->suppl.part.type == VTYPE_SIG) || (vec->suppl.part.type == VTYPE_EXP)) ) {
+
+    ulong* vall  = &(VEC_PLANE( vec, VTYPE_INDEX_SIG_VALL )[lindex]);
+    ulong* valh  = &(VEC_PLANE( vec, VTYPE_INDEX_SIG_VALH )[lindex]);
+    ulong  fvall = scratchl[lindex] & lmask;
+    ulong  fvalh = scratchh[lindex] & lmask;
+    ulong  tvall = *vall;
+    ulong  tvalh = *valh;
+
+    if( (fvall != (tvall & lmask)) || (fvalh != (tvalh & lmask)) ) {
+      if( vec->suppl.part.type == VTYPE_SIG ) {
+        ulong* xhold = &(VEC_PLANE( vec, VTYPE_INDEX_SIG_XHOLD )[lindex]);
+        ulong* misc  = &(VEC_PLANE( vec, VTYPE_INDEX_SIG_MISC )[lindex]);
+        ulong  tvalx = tvalh & ~tvall & *misc;
+        ulong  xval  = *xhold;
+        ulong  xmask = lmask & ~tvalh;
+        if( vec->suppl.part.set == 1 ) {
+          VEC_PLANE( vec, VTYPE_INDEX_SIG_TOG01 )[lindex] |= ((~tvalh & ~tvall) | (tvalx & ~xval)) & (~fvalh &  fvall) & lmask;
+          VEC_PLANE( vec, VTYPE_INDEX_SIG_TOG10 )[lindex] |= ((~tvalh &  tvall) | (tvalx &  xval)) & (~fvalh & ~fvall) & lmask;
         }
+        *xhold = (xval & ~xmask) | (tvall & xmask);
+        *misc |= ~fvalh & lmask;
       }
-      break;
-    case VTYPE_MEM :
-      for( i=lindex; i<=hindex; i++ ) {
-        ulong* entry = vec->value.ul[i];
-        ulong  mask  = (i==lindex) ? lmask : (i==hindex ? hmask : UL_SET);
-        ulong  fvall = scratchl[i] & mask;
-        ulong  fvalh = scratchh[i] & mask;
-        ulong  tvall = entry[VTYPE_INDEX_MEM_VALL];
-        ulong  tvalh = entry[VTYPE_INDEX_MEM_VALH];
-        if( (fvall != (tvall & mask)) || (fvalh != (tvalh & mask)) ) {
-          ulong tvalx = tvalh & ~tvall & entry[VTYPE_INDEX_MEM_MISC];
-          ulong xval  = entry[VTYPE_INDEX_MEM_XHOLD];
-          ulong xmask = mask & ~tvalh;
-          entry[VTYPE_INDEX_MEM_TOG01] |= ((~tvalh & ~tvall) | (tvalx & ~xval)) & (~fvalh &  fvall) & mask;
-          entry[VTYPE_INDEX_MEM_TOG10] |= ((~tvalh &  tvall) | (tvalx &  xval)) & (~fvalh & ~fvall) & mask;
-          entry[VTYPE_INDEX_MEM_WR]    |= mask;
-          entry[VTYPE_INDEX_MEM_VALL]   = (tvall & ~mask)  | fvall;
-          entry[VTYPE_INDEX_MEM_VALH]   = (tvalh & ~mask)  | fvalh;
-          entry[VTYPE_INDEX_MEM_XHOLD]  = (xval  & ~xmask) | (tvall & xmask);
-          entry[VTYPE_INDEX_MEM_MISC]  |= ~fvalh & mask;
-          changed = TRUE;
+      *vall   = (tvall & ~lmask) | fvall;
+      *valh   = (tvalh & ~lmask) | fvalh;
+      changed = TRUE;
+    }
+
+  } else {
+
+    switch( vec->suppl.part.type ) {
+      case VTYPE_VAL :
+        for( i=lindex; i<=hindex; i++ ) {
+          ulong* tvall = &(VEC_PLANE( vec, VTYPE_INDEX_SIG_VALL )[i]);
+          ulong* tvalh = &(VEC_PLANE( vec, VTYPE_INDEX_SIG_VALH )[i]);
+          ulong  mask  = (i==lindex) ? lmask : (i==hindex ? hmask : UL_SET);
+          *tvall = (*tvall & ~mask) | (scratchl[i] & mask);
+          *tvalh = (*tvalh & ~mask) | (scratchh[i] & mask);
         }
-      }
-      break;
-    case VTYPE_EXP :
-      for( i=lindex; i<=hindex; i++ ) {
-        ulong* entry = vec->value.ul[i];
-        ulong  mask  = (i==lindex) ? lmask : (i==hindex ? hmask : UL_SET);
-        ulong  fvall = scratchl[i] & mask;
-        ulong  fvalh = scratchh[i] & mask;
-        ulong  tvall = entry[VTYPE_INDEX_EXP_VALL];
-        ulong  tvalh = entry[VTYPE_INDEX_EXP_VALH];
-        if( (fvall != (tvall & mask)) || (fvalh != (tvalh & mask)) ) {
-          entry[VTYPE_INDEX_EXP_VALL] = (tvall & ~mask) | fvall;
-          entry[VTYPE_INDEX_EXP_VALH] = (tvalh & ~mask) | fvalh;
-          changed = TRUE;
+        changed = TRUE;
+        break;
+      case VTYPE_SIG :
+        changed = vector_toggle_words( vec, scratchl, scratchh, lindex, hindex, lmask, hmask, (vec->suppl.part.set == 1) );
+        break;
+      case VTYPE_MEM :
+        changed = vector_toggle_words( vec, scratchl, scratchh, lindex, hindex, lmask, hmask, TRUE );
+        break;
+      case VTYPE_EXP :
+        {
+          ulong* vall = VEC_PLANE( vec, VTYPE_INDEX_EXP_VALL );
+          ulong* valh = VEC_PLANE( vec, VTYPE_INDEX_EXP_VALH );
+          for( i=lindex; i<=hindex; i++ ) {
+            ulong  mask  = (i==lindex) ? lmask : (i==hindex ? hmask : UL_SET);
+            ulong  fvall = scratchl[i] & mask;
+            ulong  fvalh = scratchh[i] & mask;
+            ulong  tvall = vall[i];
+            ulong  tvalh = valh[i];
+            if( (fvall != (tvall & mask)) || (fvalh != (tvalh & mask)) ) {
+              vall[i] = (tvall & ~mask) | fvall;
+              valh[i] = (tvalh & ~mask) | fvalh;
+              changed = TRUE;
+            }
+          }
         }
-      }
-      break;
-    default :  assert( 0 );  break;
+        break;
+      default :  assert( 0 );  break;
+    }
+
   }
 
   PROFILE_END;
@@ -1658,11 +2312,11 @@ inline static void vector_get_sign_extend_vector_ulong(
   /*@out@*/ ulong*        signh   /*!< Pointer to value that will contain the upper value vector */
 ) { PROFILE(VECTOR_GET_SIGN_EXTEND_VECTOR_ULONG);
 
-  ulong* entry     = vec->value.ul[UL_DIV(vec->width - 1)];
-  ulong  last_mask = (ulong)1 << UL_MOD(vec->width - 1);
+  unsigned int last      = UL_DIV(vec->width - 1);
+  ulong        last_mask = (ulong)1 << UL_MOD(vec->width - 1);
 
-  *signl = ((entry[VTYPE_INDEX_VAL_VALL] & last_mask) != 0) ? UL_SET : 0;
-  *signh = ((entry[VTYPE_INDEX_VAL_VALH] & last_mask) != 0) ? UL_SET : 0;
+  *signl = ((VEC_PLANE( vec, VTYPE_INDEX_VAL_VALL )[last] & last_mask) != 0) ? UL_SET : 0;
+  *signh = ((VEC_PLANE( vec, VTYPE_INDEX_VAL_VALH )[last] & last_mask) != 0) ? UL_SET : 0;
 
   PROFILE_END;
 
@@ -1723,8 +2377,8 @@ static void vector_lshift_ulong(
     int   i;
     ulong uset = xfill ? ~UL_LMASK(lsb) : 0;
     
-    vall[diff] = (vec->value.ul[0][VTYPE_INDEX_VAL_VALL] << (unsigned int)lsb);
-    valh[diff] = (vec->value.ul[0][VTYPE_INDEX_VAL_VALH] << (unsigned int)lsb) | uset;
+    vall[diff] = (VEC_PLANE( vec, VTYPE_INDEX_VAL_VALL )[0] << (unsigned int)lsb);
+    valh[diff] = (VEC_PLANE( vec, VTYPE_INDEX_VAL_VALH )[0] << (unsigned int)lsb) | uset;
 
     for( i=(diff-1); i>=0; i-- ) {
       vall[i] = 0;
@@ -1739,8 +2393,8 @@ static void vector_lshift_ulong(
     
     /* Transfer the vector value to the val array */
     for( i=0; i<=hindex; i++ ) {
-      vall[i] = vec->value.ul[i][VTYPE_INDEX_VAL_VALL];
-      valh[i] = vec->value.ul[i][VTYPE_INDEX_VAL_VALH];
+      vall[i] = VEC_PLANE( vec, VTYPE_INDEX_VAL_VALL )[i];
+      valh[i] = VEC_PLANE( vec, VTYPE_INDEX_VAL_VALH )[i];
     }
     
     if( use_vec ) {
@@ -1875,8 +2529,8 @@ static void vector_rshift_ulong(
     
     /* Transfer the vector value to the val array */
     for( i=0; i<=hindex; i++ ) {
-      vall[i] = vec->value.ul[i][VTYPE_INDEX_VAL_VALL];
-      valh[i] = vec->value.ul[i][VTYPE_INDEX_VAL_VALH];
+      vall[i] = VEC_PLANE( vec, VTYPE_INDEX_VAL_VALL )[i];
+      valh[i] = VEC_PLANE( vec, VTYPE_INDEX_VAL_VALH )[i];
     }
     
     if( use_vec ) {
@@ -1958,23 +2612,32 @@ static void vector_rshift_ulong(
  toggle values, sets the new value to this value and returns.
 */
 bool vector_set_value_ulong(
-  vector*      vec,    /*!< Pointer to vector to set value to */
-  ulong**      value,  /*!< New value to set vector value to */
-  unsigned int width   /*!< Width of new value */
+  vector*       vec,    /*!< Pointer to vector to set value to */
+  const vector* value,  /*!< Pointer to vector containing the new value */
+  unsigned int  width   /*!< Width of new value */
 ) { PROFILE(VECTOR_SET_VALUE);
 
-  bool  retval = FALSE;                   /* Return value for this function */
-  int   i;                                /* Loop iterator */
-  int   v2st;                             /* Value to AND with from value bit if the target is a 2-state value */
-  ulong scratchl[UL_DIV(MAX_BIT_WIDTH)];  /* Lower scratch array */
-  ulong scratchh[UL_DIV(MAX_BIT_WIDTH)];  /* Upper scratch array */
+  bool         retval = FALSE;                   /* Return value for this function */
+  int          i;                                /* Loop iterator */
+  int          v2st;                             /* Value to AND with from value bit if the target is a 2-state value */
+  const ulong* vall;                             /* Lower value plane of the new value */
+  const ulong* valh;                             /* Upper value plane of the new value */
+  ulong        scratchl[UL_DIV(MAX_BIT_WIDTH)];  /* Lower scratch array */
+  ulong        scratchh[UL_DIV(MAX_BIT_WIDTH)];  /* Upper scratch array */
 
   assert( vec != NULL );
+  assert( value != NULL );
 
-  /* Adjust the width if it exceeds our width */
+  vall = VEC_PLANE( value, VTYPE_INDEX_VAL_VALL );
+  valh = VEC_PLANE( value, VTYPE_INDEX_VAL_VALH );
+
+  /* Adjust the width if it exceeds our width or the width of the new value */
   if( vec->width < width ) {
     width = vec->width;
   }
+  if( value->width < width ) {
+    width = value->width;
+  }
 
   /* Get some information from the vector */
   v2st = vec->suppl.part.is_2state << 1;
@@ -1987,8 +2650,8 @@ bool vector_set_value_ulong(
 
   /* Calculate the new values and place them in the scratch arrays */
   for( ; i>=0; i-- ) {
-    scratchl[i] = v2st ? (~value[i][VTYPE_INDEX_VAL_VALH] & value[i][VTYPE_INDEX_VAL_VALL]) : value[i][VTYPE_INDEX_VAL_VALL];
-    scratchh[i] = v2st ? 0 : value[i][VTYPE_INDEX_VAL_VALH];
+    scratchl[i] = v2st ? (~valh[i] & vall[i]) : vall[i];
+    scratchh[i] = v2st ? 0 : valh[i];
   }
 
   /* Calculate the coverage and perform the actual assignment */
@@ -2011,14 +2674,14 @@ void vector_set_mem_rd_ulong(
 
   if( vec->suppl.part.type == VTYPE_MEM ) {
     if( UL_DIV(msb) == UL_DIV(lsb) ) {
-      vec->value.ul[UL_DIV(lsb)][VTYPE_INDEX_MEM_RD] |= UL_HMASK(msb) & UL_LMASK(lsb);
+      VEC_PLANE( vec, VTYPE_INDEX_MEM_RD )[UL_DIV(lsb)] |= UL_HMASK(msb) & UL_LMASK(lsb);
     } else {
       int i;
-      vec->value.ul[UL_DIV(lsb)][VTYPE_INDEX_MEM_RD] |= UL_LMASK(lsb);
+      VEC_PLANE( vec, VTYPE_INDEX_MEM_RD )[UL_DIV(lsb)] |= UL_LMASK(lsb);
       for( i=(UL_DIV(lsb) + 1); i<UL_DIV(msb); i++ ) {
-        vec->value.ul[UL_DIV(msb)][VTYPE_INDEX_MEM_RD] = UL_SET;
+        VEC_PLANE( vec, VTYPE_INDEX_MEM_RD )[UL_DIV(msb)] = UL_SET;
       }
-      vec->value.ul[UL_DIV(msb)][VTYPE_INDEX_MEM_RD] |= UL_HMASK(msb);
+      VEC_PLANE( vec, VTYPE_INDEX_MEM_RD )[UL_DIV(msb)] |= UL_HMASK(msb);
     } 
   }
 
@@ -2160,12 +2823,15 @@ void vector_set_unary_evals(
       {
         unsigned int i;
         unsigned int size = UL_SIZE(vec->width);
+        ulong*       vall   = VEC_PLANE( vec, VTYPE_INDEX_EXP_VALL );
+        ulong*       valh   = VEC_PLANE( vec, VTYPE_INDEX_EXP_VALH );
+        ulong*       eval_a = VEC_PLANE( vec, VTYPE_INDEX_EXP_EVAL_A );
+        ulong*       eval_b = VEC_PLANE( vec, VTYPE_INDEX_EXP_EVAL_B );
         for( i=0; i<size; i++ ) {
-          ulong* entry = vec->value.ul[i];
-          ulong  lval  =  entry[VTYPE_INDEX_EXP_VALL];
-          ulong  nhval = ~entry[VTYPE_INDEX_EXP_VALH];
-          entry[VTYPE_INDEX_EXP_EVAL_A] |= nhval & ~lval;
-          entry[VTYPE_INDEX_EXP_EVAL_B] |= nhval &  lval;
+          ulong  lval  =  vall[i];
+          ulong  nhval = ~valh[i];
+          eval_a[i] |= nhval & ~lval;
+          eval_b[i] |= nhval &  lval;
         }
       }
       break;
@@ -2197,19 +2863,23 @@ void vector_set_and_comb_evals(
         unsigned int size  = UL_SIZE( tgt->width );
         unsigned int lsize = UL_SIZE( left->width );
         unsigned int rsize = UL_SIZE( right->width );
+        ulong*       lval_l = VEC_PLANE( left, VTYPE_INDEX_EXP_VALL );
+        ulong*       lval_h = VEC_PLANE( left, VTYPE_INDEX_EXP_VALH );
+        ulong*       rval_l = VEC_PLANE( right, VTYPE_INDEX_EXP_VALL );
+        ulong*       rval_h = VEC_PLANE( right, VTYPE_INDEX_EXP_VALH );
+        ulong*       eval_a = VEC_PLANE( tgt, VTYPE_INDEX_EXP_EVAL_A );
+        ulong*       eval_b = VEC_PLANE( tgt, VTYPE_INDEX_EXP_EVAL_B );
+        ulong*       eval_c = VEC_PLANE( tgt, VTYPE_INDEX_EXP_EVAL_C );
 
         for( i=0; i<size; i++ ) {
-          ulong* val    = tgt->value.ul[i];
-          ulong* lval   = (i < lsize) ? left->value.ul[i]  : 0;
-          ulong* rval   = (i < rsize) ? right->value.ul[i] : 0;
-          ulong  lvall  = (i < lsize) ?  lval[VTYPE_INDEX_EXP_VALL] : 0;
-          ulong  nlvalh = (i < lsize) ? ~lval[VTYPE_INDEX_EXP_VALH] : UL_SET;
-          ulong  rvall  = (i < rsize) ?  rval[VTYPE_INDEX_EXP_VALL] : 0;
-          ulong  nrvalh = (i < rsize) ? ~rval[VTYPE_INDEX_EXP_VALH] : UL_SET;
+          ulong  lvall  = (i < lsize) ?  lval_l[i] : 0;
+          ulong  nlvalh = (i < lsize) ? ~lval_h[i] : UL_SET;
+          ulong  rvall  = (i < rsize) ?  rval_l[i] : 0;
+          ulong  nrvalh = (i < rsize) ? ~rval_h[i] : UL_SET;
           
-          val[VTYPE_INDEX_EXP_EVAL_A] |= nlvalh & ~lvall;
-          val[VTYPE_INDEX_EXP_EVAL_B] |= nrvalh & ~rvall;
-          val[VTYPE_INDEX_EXP_EVAL_C] |= nlvalh & nrvalh & lvall & rvall;
+          eval_a[i] |= nlvalh & ~lvall;
+          eval_b[i] |= nrvalh & ~rvall;
+          eval_c[i] |= nlvalh & nrvalh & lvall & rvall;
         }
       }
       break;
@@ -2241,19 +2911,23 @@ void vector_set_or_comb_evals(
         unsigned int size  = UL_SIZE( tgt->width );
         unsigned int lsize = UL_SIZE( left->width );
         unsigned int rsize = UL_SIZE( right->width );
+        ulong*       lval_l = VEC_PLANE( left, VTYPE_INDEX_EXP_VALL );
+        ulong*       lval_h = VEC_PLANE( left, VTYPE_INDEX_EXP_VALH );
+        ulong*       rval_l = VEC_PLANE( right, VTYPE_INDEX_EXP_VALL );
+        ulong*       rval_h = VEC_PLANE( right, VTYPE_INDEX_EXP_VALH );
+        ulong*       eval_a = VEC_PLANE( tgt, VTYPE_INDEX_EXP_EVAL_A );
+        ulong*       eval_b = VEC_PLANE( tgt, VTYPE_INDEX_EXP_EVAL_B );
+        ulong*       eval_c = VEC_PLANE( tgt, VTYPE_INDEX_EXP_EVAL_C );
 
         for( i=0; i<size; i++ ) {
-          ulong* val    = tgt->value.ul[i];
-          ulong* lval   = (i < lsize) ? left->value.ul[i]  : 0;
-          ulong* rval   = (i < rsize) ? right->value.ul[i] : 0;
-          ulong  lvall  = (i < lsize) ?  lval[VTYPE_INDEX_EXP_VALL] : 0;
-          ulong  nlvalh = (i < lsize) ? ~lval[VTYPE_INDEX_EXP_VALH] : UL_SET;
-          ulong  rvall  = (i < rsize) ?  rval[VTYPE_INDEX_EXP_VALL] : 0;
-          ulong  nrvalh = (i < rsize) ? ~rval[VTYPE_INDEX_EXP_VALH] : UL_SET;
-
-          val[VTYPE_INDEX_EXP_EVAL_A] |= nlvalh & lvall;
-          val[VTYPE_INDEX_EXP_EVAL_B] |= nrvalh & rvall;
-          val[VTYPE_INDEX_EXP_EVAL_C] |= nlvalh & nrvalh & ~lvall & ~rvall;
+          ulong  lvall  = (i < lsize) ?  lval_l[i] : 0;
+          ulong  nlvalh = (i < lsize) ? ~lval_h[i] : UL_SET;
+          ulong  rvall  = (i < rsize) ?  rval_l[i] : 0;
+          ulong  nrvalh = (i < rsize) ? ~rval_h[i] : UL_SET;
+
+          eval_a[i] |= nlvalh & lvall;
+          eval_b[i] |= nrvalh & rvall;
+          eval_c[i] |= nlvalh & nrvalh & ~lvall & ~rvall;
         }
       }
       break;
@@ -2285,21 +2959,26 @@ void vector_set_other_comb_evals(
         unsigned int size  = UL_SIZE( tgt->width );
         unsigned int lsize = UL_SIZE( left->width );
         unsigned int rsize = UL_SIZE( right->width );
+        ulong*       lval_l = VEC_PLANE( left, VTYPE_INDEX_EXP_VALL );
+        ulong*       lval_h = VEC_PLANE( left, VTYPE_INDEX_EXP_VALH );
+        ulong*       rval_l = VEC_PLANE( right, VTYPE_INDEX_EXP_VALL );
+        ulong*       rval_h = VEC_PLANE( right, VTYPE_INDEX_EXP_VALH );
+        ulong*       eval_a = VEC_PLANE( tgt, VTYPE_INDEX_EXP_EVAL_A );
+        ulong*       eval_b = VEC_PLANE( tgt, VTYPE_INDEX_EXP_EVAL_B );
+        ulong*       eval_c = VEC_PLANE( tgt, VTYPE_INDEX_EXP_EVAL_C );
+        ulong*       eval_d = VEC_PLANE( tgt, VTYPE_INDEX_EXP_EVAL_D );
 
         for( i=0; i<size; i++ ) { 
-          ulong* val    = tgt->value.ul[i];
-          ulong* lval   = (i < lsize) ? left->value.ul[i]  : 0;
-          ulong* rval   = (i < rsize) ? right->value.ul[i] : 0;
-          ulong  lvall  = (i < lsize) ?  lval[VTYPE_INDEX_EXP_VALL] : 0;
-          ulong  nlvalh = (i < lsize) ? ~lval[VTYPE_INDEX_EXP_VALH] : UL_SET;
-          ulong  rvall  = (i < rsize) ?  rval[VTYPE_INDEX_EXP_VALL] : 0;
-          ulong  nrvalh = (i < rsize) ? ~rval[VTYPE_INDEX_EXP_VALH] : UL_SET;
+          ulong  lvall  = (i < lsize) ?  lval_l[i] : 0;
+          ulong  nlvalh = (i < lsize) ? ~lval_h[i] : UL_SET;
+          ulong  rvall  = (i < rsize) ?  rval_l[i] : 0;
+          ulong  nrvalh = (i < rsize) ? ~rval_h[i] : UL_SET;
           ulong  nvalh  = nlvalh & nrvalh;
 
-          val[VTYPE_INDEX_EXP_EVAL_A] |= nvalh & ~lvall & ~rvall;
-          val[VTYPE_INDEX_EXP_EVAL_B] |= nvalh & ~lvall &  rvall;
-          val[VTYPE_INDEX_EXP_EVAL_C] |= nvalh &  lvall & ~rvall;
-          val[VTYPE_INDEX_EXP_EVAL_D] |= nvalh &  lvall &  rvall;
+          eval_a[i] |= nvalh & ~lvall & ~rvall;
+          eval_b[i] |= nvalh & ~lvall &  rvall;
+          eval_c[i] |= nvalh &  lvall & ~rvall;
+          eval_d[i] |= nvalh &  lvall &  rvall;
         }
       }
       break;
@@ -2329,7 +3008,7 @@ bool vector_is_unknown(
     switch( vec->suppl.part.data_type ) {
       case VDATA_UL :
         size = UL_SIZE( vec->width );
-        while( (i < size) && (vec->value.ul[i][VTYPE_INDEX_VAL_VALH] == 0) ) i++;
+        while( (i < size) && (VEC_PLANE( vec, VTYPE_INDEX_VAL_VALH )[i] == 0) ) i++;
         break;
       case VDATA_R64 :
       case VDATA_R32 :
@@ -2363,7 +3042,7 @@ bool vector_is_not_zero(
     switch( vec->suppl.part.data_type ) {
       case VDATA_UL :
         size = UL_SIZE( vec->width );
-        while( (i < size) && (vec->value.ul[i][VTYPE_INDEX_VAL_VALL] == 0) ) i++;
+        while( (i < size) && (VEC_PLANE( vec, VTYPE_INDEX_VAL_VALL )[i] == 0) ) i++;
         break;
       case VDATA_R64 :
         size = DEQ( vec->value.r64->val, 0.0 ) ? 1 : 0;
@@ -2440,7 +3119,7 @@ int vector_to_int(
   assert( width > 0 );
 
   switch( vec->suppl.part.data_type ) {
-    case VDATA_UL  :  retval = vec->value.ul[0][VTYPE_INDEX_VAL_VALL];  break;
+    case VDATA_UL  :  retval = VEC_PLANE( vec, VTYPE_INDEX_VAL_VALL )[0];  break;
     case VDATA_R64 :  retval = (int)round( vec->value.r64->val );       break;
     case VDATA_R32 :  retval = (int)roundf( vec->value.r32->val );       break;
     default        :  assert( 0 );  break;
@@ -2475,9 +3154,9 @@ uint64 vector_to_uint64(
   switch( vec->suppl.part.data_type ) {
     case VDATA_UL :
       if( (vec->width > 32) && (sizeof( ulong ) == 4) ) {
-        retval = ((uint64)vec->value.ul[1][VTYPE_INDEX_VAL_VALL] << 32) | (uint64)vec->value.ul[0][VTYPE_INDEX_VAL_VALL];
+        retval = ((uint64)VEC_PLANE( vec, VTYPE_INDEX_VAL_VALL )[1] << 32) | (uint64)VEC_PLANE( vec, VTYPE_INDEX_VAL_VALL )[0];
       } else {
-        retval = (uint64)vec->value.ul[0][VTYPE_INDEX_VAL_VALL];
+        retval = (uint64)VEC_PLANE( vec, VTYPE_INDEX_VAL_VALL )[0];
       }
       break;
     case VDATA_R64 :
@@ -2548,15 +3227,15 @@ void vector_to_sim_time(
   /* Calculate the full (64-bit) time value */
   switch( vec->suppl.part.data_type ) {
     case VDATA_UL  :
-      assert( vec->value.ul[0][VTYPE_INDEX_VAL_VALH] == 0 );
+      assert( VEC_PLANE( vec, VTYPE_INDEX_VAL_VALH )[0] == 0 );
 #if SIZEOF_LONG == 4
-      time_u.u32.lo = vec->value.ul[0][VTYPE_INDEX_VAL_VALL];
+      time_u.u32.lo = VEC_PLANE( vec, VTYPE_INDEX_VAL_VALL )[0];
       if( UL_SIZE( vec->width ) > 1 ) {
-        assert( vec->value.ul[1][VTYPE_INDEX_VAL_VALH] == 0 );
-        time_u.u32.hi = vec->value.ul[1][VTYPE_INDEX_VAL_VALL];
+        assert( VEC_PLANE( vec, VTYPE_INDEX_VAL_VALH )[1] == 0 );
+        time_u.u32.hi = VEC_PLANE( vec, VTYPE_INDEX_VAL_VALL )[1];
       }
 #elif SIZEOF_LONG == 8
-      time_u.full = vec->value.ul[0][VTYPE_INDEX_VAL_VALL];
+      time_u.full = VEC_PLANE( vec, VTYPE_INDEX_VAL_VALL )[0];
 #else
 #error "Unsupported long size"
 #endif
@@ -2722,6 +3401,133 @@ bool vector_from_real64(
 
 }
 
+/*!
+ Decodes the len 4-state value characters of str (the last character being the least-significant)
+ into bit positions lsb through lsb + len - 1 of the vall/valh arrays, ORing each bit into the
+ existing contents.  The characters '1', 'x'/'X' and 'z'/'Z'/'?' set the bit in vall only, valh only
+ and both arrays, respectively; all other characters leave the bit clear.  Where SSE2 is available,
+ sixteen characters are classified at a time and the scalar loop only decodes the remainder.
+*/
+static void vector_decode_4state_ulong(
+  const char*  str,   /*!< Pointer to value characters to decode */
+  unsigned int len,   /*!< Number of characters to decode */
+  ulong*       vall,  /*!< Lower value array to OR bits into */
+  ulong*       valh,  /*!< Upper value array to OR bits into */
+  unsigned int lsb    /*!< Bit position to store the last character of str into */
+) { PROFILE(VECTOR_DECODE_4STATE_ULONG);
+
+  const char*  ptr = str + len;  /* Pointer to the character after the next one to decode */
+  unsigned int i   = lsb;        /* Bit position of next character */
+
+#ifdef VECTOR_DECODE_SSE2
+  __m128i lower = _mm_set1_epi8( 0x20 );
+  __m128i one   = _mm_set1_epi8( '1' );
+  __m128i x     = _mm_set1_epi8( 'x' );
+  __m128i z     = _mm_set1_epi8( 'z' );
+  __m128i q     = _mm_set1_epi8( '?' );
+
+  while( (ptr - str) >= 16 ) {
+
+    __m128i      c = _mm_loadu_si128( (const __m128i*)(ptr - 16) );
+    __m128i      cz;
+    ulong        lbits, hbits;
+    unsigned int index  = UL_DIV(i);
+    unsigned int offset = UL_MOD(i);
+
+    /* Reverse the characters so that the last one lands in the least-significant mask bit */
+    c = _mm_shuffle_epi32( c, _MM_SHUFFLE( 0, 1, 2, 3 ) );
+    c = _mm_shufflelo_epi16( c, _MM_SHUFFLE( 2, 3, 0, 1 ) );
+    c = _mm_shufflehi_epi16( c, _MM_SHUFFLE( 2, 3, 0, 1 ) );
+    c = _mm_or_si128( _mm_slli_epi16( c, 8 ), _mm_srli_epi16( c, 8 ) );
+
+    /* Classify the characters (folding upper-case letters to lower-case) */
+    c     = _mm_or_si128( c, lower );
+    cz    = _mm_or_si128( _mm_cmpeq_epi8( c, z ), _mm_cmpeq_epi8( c, q ) );
+    lbits = (ulong)_mm_movemask_epi8( _mm_or_si128( _mm_cmpeq_epi8( c, one ), cz ) );
+    hbits = (ulong)_mm_movemask_epi8( _mm_or_si128( _mm_cmpeq_epi8( c, x ), cz ) );
+
+    vall[index] |= lbits << offset;
+    valh[index] |= hbits << offset;
+    if( offset > (UL_BITS - 16) ) {
+      vall[index+1] |= lbits >> (UL_BITS - offset);
+      valh[index+1] |= hbits >> (UL_BITS - offset);
+    }
+
+    ptr -= 16;
+    i   += 16;
+
+  }
+#endif
+
+  while( ptr > str ) {
+    char  c   = *(--ptr) | 0x20;
+    ulong bit = (ulong)1 << UL_MOD(i);
+    if( (c == 'z') || (c == '?') ) {
+      vall[UL_DIV(i)] |= bit;
+      valh[UL_DIV(i)] |= bit;
+    } else if( c == '1' ) {
+      vall[UL_DIV(i)] |= bit;
+    } else if( c == 'x' ) {
+      valh[UL_DIV(i)] |= bit;
+    }
+    i++;
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ Decodes the len characters of a VCD value (which does not need to be NULL-terminated) into the
+ width-bit packed 4-state value stored in the UL_SIZE(width) words of vall and valh.  Characters
+ beyond width are dropped.  Values that are shorter than width are extended as the VCD format
+ specifies:  with x or z if the left-most character is x or z and with zeroes otherwise.
+*/
+void vector_decode_vcd_value(
+  const char*  value,  /*!< VCD value characters (the last character being the least-significant) */
+  unsigned int len,    /*!< Number of characters in value */
+  ulong*       vall,   /*!< Lower value array to store the decoded value into */
+  ulong*       valh,   /*!< Upper value array to store the decoded value into */
+  unsigned int width   /*!< Number of bits in the packed value */
+) { PROFILE(VECTOR_DECODE_VCD_VALUE);
+
+  unsigned int size = UL_SIZE(width);
+  unsigned int i;
+
+  for( i=0; i<size; i++ ) {
+    vall[i] = 0;
+    valh[i] = 0;
+  }
+
+  if( len >= width ) {
+
+    vector_decode_4state_ulong( (value + (len - width)), width, vall, valh, 0 );
+
+  } else if( len > 0 ) {
+
+    ulong fillh = ((value[0] == 'x') || (value[0] == 'X') || (value[0] == 'z') || (value[0] == 'Z')) ? UL_SET : 0;
+    ulong filll = ((value[0] == 'z') || (value[0] == 'Z')) ? UL_SET : 0;
+
+    vector_decode_4state_ulong( value, len, vall, valh, 0 );
+
+    /* Bit-fill */
+    if( fillh ) {
+      for( i=UL_DIV(len); i<size; i++ ) {
+        ulong mask = (i == UL_DIV(len)) ? UL_LMASK(len) : UL_SET;
+        if( i == (size - 1) ) {
+          mask &= UL_HMASK(width - 1);
+        }
+        vall[i] |= filll & mask;
+        valh[i] |= fillh & mask;
+      }
+    }
+
+  }
+
+  PROFILE_END;
+
+}
+
 /*!
  Iterates through string str starting at the left-most character, calculates the int value
  of the character and sets the appropriate number of bits in the specified vector locations.
@@ -2737,6 +3543,15 @@ static void vector_set_static(
   unsigned int i;                                      /* Loop iterator */
   int          data_type = vec->suppl.part.data_type;  /* Copy of data type for performance reasons */
 
+  /* Binary strings without separators are decoded as a block (any characters past the vector width are dropped) */
+  if( (bits_per_char == 1) && (data_type == VDATA_UL) && (strchr( str, '_' ) == NULL) ) {
+    unsigned int len = strlen( str );
+    unsigned int num = (len < vec->width) ? len : vec->width;
+    vector_decode_4state_ulong( (str + (len - num)), num, VEC_PLANE( vec, VTYPE_INDEX_VAL_VALL ), VEC_PLANE( vec, VTYPE_INDEX_VAL_VALH ), 0 );
+    pos = len;
+    ptr = str - 1;
+  }
+
   while( ptr >= str ) {
     if( *ptr != '_' ) {
       if( (*ptr == 'x') || (*ptr == 'X') ) {
@@ -2744,7 +3559,7 @@ static void vector_set_static(
           case VDATA_UL :
             for( i=0; i<bits_per_char; i++ ) {
               if( (i + pos) < vec->width ) {
-                vec->value.ul[UL_DIV(i+pos)][VTYPE_INDEX_VAL_VALH] |= ((ulong)1 << UL_MOD(i+pos));
+                VEC_PLANE( vec, VTYPE_INDEX_VAL_VALH )[UL_DIV(i+pos)] |= ((ulong)1 << UL_MOD(i+pos));
               }
             }
             break;
@@ -2757,8 +3572,8 @@ static void vector_set_static(
               if( (i + pos) < vec->width ) {
                 unsigned int index = UL_DIV(i + pos);
                 ulong        value = ((ulong)1 << UL_MOD(i + pos));
-                vec->value.ul[index][VTYPE_INDEX_VAL_VALL] |= value;
-                vec->value.ul[index][VTYPE_INDEX_VAL_VALH] |= value;
+                VEC_PLANE( vec, VTYPE_INDEX_VAL_VALL )[index] |= value;
+                VEC_PLANE( vec, VTYPE_INDEX_VAL_VALH )[index] |= value;
               }
             }
             break;
@@ -2778,7 +3593,7 @@ static void vector_set_static(
           case VDATA_UL :
             for( i=0; i<bits_per_char; i++ ) {
               if( (i + pos) < vec->width ) {
-                vec->value.ul[UL_DIV(i+pos)][VTYPE_INDEX_VAL_VALL] |= ((val >> i) & 0x1) << UL_MOD(i + pos);
+                VEC_PLANE( vec, VTYPE_INDEX_VAL_VALL )[UL_DIV(i+pos)] |= ((val >> i) & 0x1) << UL_MOD(i + pos);
               }
             }
             break;
@@ -2795,23 +3610,23 @@ static void vector_set_static(
     switch( data_type ) {
       case VDATA_UL :
         {
-          ulong hfill = (vec->value.ul[UL_DIV(pos)][VTYPE_INDEX_VAL_VALH] & ((ulong)1 << UL_MOD(pos - 1))) ? UL_SET : 0x0;
-          ulong lfill = (vec->value.ul[UL_DIV(pos)][VTYPE_INDEX_VAL_VALL] & ((ulong)1 << UL_MOD(pos - 1))) ? hfill  : 0x0;
+          ulong hfill = (VEC_PLANE( vec, VTYPE_INDEX_VAL_VALH )[UL_DIV(pos)] & ((ulong)1 << UL_MOD(pos - 1))) ? UL_SET : 0x0;
+          ulong lfill = (VEC_PLANE( vec, VTYPE_INDEX_VAL_VALL )[UL_DIV(pos)] & ((ulong)1 << UL_MOD(pos - 1))) ? hfill  : 0x0;
           ulong lmask = UL_LMASK(pos);
           ulong hmask = UL_HMASK(vec->width - 1);
           if( UL_DIV(pos) == UL_DIV(vec->width - 1) ) {
             ulong mask = lmask & hmask;
-            vec->value.ul[UL_DIV(pos)][VTYPE_INDEX_VAL_VALL] |= lfill & mask;
-            vec->value.ul[UL_DIV(pos)][VTYPE_INDEX_VAL_VALH] |= hfill & mask;
+            VEC_PLANE( vec, VTYPE_INDEX_VAL_VALL )[UL_DIV(pos)] |= lfill & mask;
+            VEC_PLANE( vec, VTYPE_INDEX_VAL_VALH )[UL_DIV(pos)] |= hfill & mask;
           } else {
-            vec->value.ul[UL_DIV(pos)][VTYPE_INDEX_VAL_VALL] |= lfill & lmask;
-            vec->value.ul[UL_DIV(pos)][VTYPE_INDEX_VAL_VALH] |= hfill & lmask;
+            VEC_PLANE( vec, VTYPE_INDEX_VAL_VALL )[UL_DIV(pos)] |= lfill & lmask;
+            VEC_PLANE( vec, VTYPE_INDEX_VAL_VALH )[UL_DIV(pos)] |= hfill & lmask;
             for( i=(UL_DIV(pos) + 1); i<(UL_SIZE( vec->width ) - 1); i++ ) {
-              vec->value.ul[i][VTYPE_INDEX_VAL_VALL] = lfill;
-              vec->value.ul[i][VTYPE_INDEX_VAL_VALH] = hfill;
+              VEC_PLANE( vec, VTYPE_INDEX_VAL_VALL )[i] = lfill;
+              VEC_PLANE( vec, VTYPE_INDEX_VAL_VALH )[i] = hfill;
             }
-            vec->value.ul[i][VTYPE_INDEX_VAL_VALL] = lfill & hmask;
-            vec->value.ul[i][VTYPE_INDEX_VAL_VALH] = hfill & hmask;
+            VEC_PLANE( vec, VTYPE_INDEX_VAL_VALL )[i] = lfill & hmask;
+            VEC_PLANE( vec, VTYPE_INDEX_VAL_VALH )[i] = hfill & hmask;
           }
         }
         break;
@@ -2858,7 +3673,7 @@ char* vector_to_string(
         {
           int offset = (((width >> 3) & (UL_MOD_VAL >> 3)) == 0) ? SIZEOF_LONG : ((width >> 3) & (UL_MOD_VAL >> 3));
           for( i=UL_SIZE(width); i--; ) {
-            ulong val = vec->value.ul[i][VTYPE_INDEX_VAL_VALL]; 
+            ulong val = VEC_PLANE( vec, VTYPE_INDEX_VAL_VALL )[i]; 
             for( j=(offset - 1); j>=0; j-- ) {
               str[pos] = (val >> ((unsigned int)j * 8)) & 0xff;
               pos++;
@@ -2955,10 +3770,11 @@ char* vector_to_string(
           ulong value = 0;
           int    i;
           for( i=(width - 1); i>=0; i-- ) {
-            ulong* entry = vec->value.ul[UL_DIV(i)];
-            if( ((entry[VTYPE_INDEX_VAL_VALH] >> UL_MOD(i)) & 0x1) == 1 ) {
-              value = ((entry[VTYPE_INDEX_VAL_VALL] >> UL_MOD(i)) & 0x1) + 16;
-            } else if( ((entry[VTYPE_INDEX_VAL_VALL] >> UL_MOD(i)) & 0x1) == 1 ) {
+            ulong vall = VEC_PLANE( vec, VTYPE_INDEX_VAL_VALL )[UL_DIV(i)];
+            ulong valh = VEC_PLANE( vec, VTYPE_INDEX_VAL_VALH )[UL_DIV(i)];
+            if( ((valh >> UL_MOD(i)) & 0x1) == 1 ) {
+              value = ((vall >> UL_MOD(i)) & 0x1) + 16;
+            } else if( ((vall >> UL_MOD(i)) & 0x1) == 1 ) {
               value = (value < 16) ? (((ulong)1 << (UL_MOD(i) % group)) | value) : value;
             }
             assert( pos < vec_size );
@@ -3035,7 +3851,7 @@ void vector_from_string_fixed(
 
   /* TBD - Not sure if I need to support both endianness values here */
   for( i=(width-1); i>=0; i-- ) {
-    vec->value.ul[pos>>(UL_DIV_VAL-3)][VTYPE_INDEX_VAL_VALL] |= (ulong)(str[i]) << ((pos & (UL_MOD_VAL >> 3)) << 3);
+    VEC_PLANE( vec, VTYPE_INDEX_VAL_VALL )[pos>>(UL_DIV_VAL-3)] |= (ulong)(str[i]) << ((pos & (UL_MOD_VAL >> 3)) << 3);
     pos++;
   }
 
@@ -3087,7 +3903,7 @@ void vector_from_string(
       *base = QSTRING;
 
       for( i=(strlen( *str ) - 1); i>=0; i-- ) {
-        (*vec)->value.ul[pos>>(UL_DIV_VAL-3)][VTYPE_INDEX_VAL_VALL] |= (ulong)((*str)[i]) << ((pos & (UL_MOD_VAL >> 3)) << 3);
+        VEC_PLANE( (*vec), VTYPE_INDEX_VAL_VALL )[pos>>(UL_DIV_VAL-3)] |= (ulong)((*str)[i]) << ((pos & (UL_MOD_VAL >> 3)) << 3);
         pos++;
       }
 
@@ -3211,9 +4027,9 @@ bool vector_vcd_assign(
   int         lsb     /*!< Least significant bit to assign to */
 ) { PROFILE(VECTOR_VCD_ASSIGN);
 
-  bool        retval = FALSE;  /* Return value for this function */
-  const char* ptr;             /* Pointer to current character under evaluation */
-  int         i;               /* Loop iterator */
+  bool retval = FALSE;  /* Return value for this function */
+  int  len;             /* Number of characters in value string */
+  int  i;               /* Loop iterator */
 
   /* Make adjust ment to MSB if necessary */
   msb = (msb > 0) ? msb : -msb;
@@ -3222,42 +4038,35 @@ bool vector_vcd_assign(
   assert( value != NULL );
   assert( msb <= vec->width );
 
-  /* Set pointer to LSB */
-  ptr = (value + strlen( value )) - 1;
-  i   = lsb;
+  len = strlen( value );
 
   switch( vec->suppl.part.data_type ) {
     case VDATA_UL :
-      {
-        ulong scratchl[UL_DIV(MAX_BIT_WIDTH)];
-        ulong scratchh[UL_DIV(MAX_BIT_WIDTH)];
-        scratchl[UL_DIV(i)] = 0;
-        scratchh[UL_DIV(i)] = 0;
-        while( ptr >= value ) {
-          unsigned int index  = UL_DIV(i);
-          unsigned int offset = UL_MOD(i);
-          ulong        bit    = ((ulong)1 << offset);
-          if( offset == 0 ) {
-            scratchl[index] = 0;
-            scratchh[index] = 0;
-          }
-          scratchl[index] |= ((*ptr == '1') || (*ptr == 'z')) ? bit : 0;
-          scratchh[index] |= ((*ptr == 'x') || (*ptr == 'z')) ? bit : 0;
-          ptr--;
-          i++;
+      /* If the value fits within a single machine word, decode it directly into that word */
+      if( (msb < UL_BITS) && ((lsb + len) <= UL_BITS) ) {
+        ulong scratchl = 0;
+        ulong scratchh = 0;
+        vector_decode_4state_ulong( value, len, &scratchl, &scratchh, lsb );
+        /* Bit-fill */
+        for( i=(lsb + len); i<=msb; i++ ) {
+          ulong bit = ((ulong)1 << i);
+          scratchl |= ((value[0] == 'z') || (value[0] == 'Z')) ? bit : 0;
+          scratchh |= ((value[0] == 'x') || (value[0] == 'X') || (value[0] == 'z') || (value[0] == 'Z')) ? bit : 0;
         }
-        ptr++;
+        retval = vector_set_coverage_and_assign_ulong( vec, &scratchl, &scratchh, lsb, msb );
+      } else {
+        ulong        scratchl[UL_DIV(MAX_BIT_WIDTH)];
+        ulong        scratchh[UL_DIV(MAX_BIT_WIDTH)];
+        unsigned int last = ((lsb + len) > (msb + 1)) ? ((lsb + len) - 1) : msb;
+        unsigned int size = (UL_DIV(last) - UL_DIV(lsb)) + 1;
+        memset( &(scratchl[UL_DIV(lsb)]), 0, (sizeof( ulong ) * size) );
+        memset( &(scratchh[UL_DIV(lsb)]), 0, (sizeof( ulong ) * size) );
+        vector_decode_4state_ulong( value, len, scratchl, scratchh, lsb );
         /* Bit-fill */
-        for( ; i<=msb; i++ ) {
-          unsigned int index  = UL_DIV(i);
-          unsigned int offset = UL_MOD(i);
-          ulong        bit    = ((ulong)1 << offset);
-          if( offset == 0 ) {
-            scratchl[index] = 0;
-            scratchh[index] = 0;
-          }
-          scratchl[index] |= (*ptr == 'z') ? bit : 0;
-          scratchh[index] |= ((*ptr == 'x') || (*ptr == 'z')) ? bit : 0;
+        for( i=(lsb + len); i<=msb; i++ ) {
+          ulong bit = ((ulong)1 << UL_MOD(i));
+          scratchl[UL_DIV(i)] |= ((value[0] == 'z') || (value[0] == 'Z')) ? bit : 0;
+          scratchh[UL_DIV(i)] |= ((value[0] == 'x') || (value[0] == 'X') || (value[0] == 'z') || (value[0] == 'Z')) ? bit : 0;
         }
         retval = vector_set_coverage_and_assign_ulong( vec, scratchl, scratchh, lsb, msb );
       }
@@ -3293,44 +4102,114 @@ bool vector_vcd_assign(
 }
 
 /*!
- \return Returns TRUE if the value has changed from the previous value.
-
- Assigns the given vectors the value from the VCD file (bit-extended as necessary).
+ \return Returns the UL_BITS bits of the width-bit packed value val that start at bit position pos,
+         where bits at or above width are taken from fill.
 */
-bool vector_vcd_assign2(
-               vector* vec1,   /*!< Vector to fill which occupies the low-order bits */
-               vector* vec2,   /*!< Vector to fill which occupies the high-order bits */
-               char*   value,  /*!< VCD value (in string form) */
-  /*@unused@*/ int     msb,    /*!< Most-significant bit from VCD file */
-  /*@unused@*/ int     lsb     /*!< Least-significant bit from VCD file */
-) { PROFILE(VECTOR_VCD_ASSIGN2);
+static ulong vector_get_packed_word(
+  const ulong* val,    /*!< Packed value array */
+  unsigned int width,  /*!< Number of bits in the packed value */
+  unsigned int pos,    /*!< Bit position of the first bit to get */
+  ulong        fill    /*!< Value of the bits past the end of the packed value */
+) { PROFILE(VECTOR_GET_PACKED_WORD);
 
-  bool         retval     = FALSE;
-  unsigned int value_size = strlen( value );
+  ulong word = fill;
 
-  /* If the value string is greater than the low-order vector, split the string and perform two individual VCD assigns */
-  if( value_size > vec1->width ) {
+  if( pos < width ) {
 
-    char* ptr = value + (value_size - vec1->width);
+    unsigned int index = UL_DIV(pos);
+    unsigned int shift = UL_MOD(pos);
 
-    retval |= vector_vcd_assign( vec1, ptr, (vec1->width - 1), 0 );
-    *ptr = '\0';
-    retval |= vector_vcd_assign( vec2, value, (vec2->width - 1), 0 );
-
-  /* Otherwise, assign the low-order vector as normal and assign the high-order vector with only the first character of the value string */
-  } else {
+    word = val[index] >> shift;
+    if( (shift > 0) && (index < UL_DIV(width - 1)) ) {
+      word |= val[index+1] << (UL_BITS - shift);
+    }
 
-    retval |= vector_vcd_assign( vec1, value, (vec1->width - 1), 0 );
-    if( value[0] == '1' ) {
-      value[0] = '0';
+    /* Replace the bits past the end of the value with the fill bits */
+    if( (width - pos) < UL_BITS ) {
+      ulong mask = UL_HMASK((width - pos) - 1);
+      word = (word & mask) | (fill & ~mask);
     }
-    value[1] = '\0';
-    retval |= vector_vcd_assign( vec2, value, (vec2->width - 1), 0 );
 
   }
 
   PROFILE_END;
 
+  return( word );
+
+}
+
+/*!
+ \return Returns TRUE if the value has changed from the previous value.
+
+ Assigns bits offset through (offset + (msb - lsb)) of the width-bit packed 4-state value in vall/valh
+ (as decoded by vector_decode_vcd_value) to bits lsb through msb of the given vector.  Bits past the end
+ of the packed value are extended from its most-significant bit in the same way that a VCD value string
+ is bit-filled.  Real vectors take their value from a double that is stored at the start of vall.
+*/
+bool vector_vcd_assign_packed(
+  vector*      vec,     /*!< Pointer to vector to set value to */
+  const ulong* vall,    /*!< Lower value array of packed value */
+  const ulong* valh,    /*!< Upper value array of packed value */
+  unsigned int width,   /*!< Number of bits in packed value */
+  unsigned int offset,  /*!< Bit position of the packed value to assign to the LSB */
+  int          msb,     /*!< Most significant bit to assign to */
+  int          lsb      /*!< Least significant bit to assign to */
+) { PROFILE(VECTOR_VCD_ASSIGN_PACKED);
+
+  bool retval = FALSE;  /* Return value for this function */
+
+  /* Make adjust ment to MSB if necessary */
+  msb = (msb > 0) ? msb : -msb;
+
+  assert( vec != NULL );
+  assert( msb <= vec->width );
+  assert( width > 0 );
+
+  switch( vec->suppl.part.data_type ) {
+    case VDATA_UL :
+      /* If the packed value lines up with the assigned bits, assign it without copying */
+      if( (lsb == 0) && (offset == 0) && (msb < width) ) {
+        retval = vector_set_coverage_and_assign_ulong( vec, vall, valh, lsb, msb );
+      } else {
+        ulong        scratchl[UL_DIV(MAX_BIT_WIDTH)];
+        ulong        scratchh[UL_DIV(MAX_BIT_WIDTH)];
+        unsigned int top   = width - 1;
+        ulong        fillh = ((valh[UL_DIV(top)] >> UL_MOD(top)) & 1) ? UL_SET : 0;
+        ulong        filll = ((vall[UL_DIV(top)] >> UL_MOD(top)) & 1) ? fillh : 0;
+        unsigned int i;
+        for( i=UL_DIV(lsb); i<=UL_DIV(msb); i++ ) {
+          unsigned int first = ((i << UL_DIV_VAL) < (unsigned int)lsb) ? (unsigned int)lsb : (i << UL_DIV_VAL);
+          unsigned int shift = UL_MOD(first);
+          scratchl[i] = vector_get_packed_word( vall, width, (offset + (first - lsb)), filll ) << shift;
+          scratchh[i] = vector_get_packed_word( valh, width, (offset + (first - lsb)), fillh ) << shift;
+        }
+        retval = vector_set_coverage_and_assign_ulong( vec, scratchl, scratchh, lsb, msb );
+      }
+      break;
+    case VDATA_R64 :
+      {
+        double real;
+        memcpy( &real, vall, sizeof( double ) );
+        retval = !DEQ( vec->value.r64->val, real );
+        vec->value.r64->val = real;
+      }
+      break;
+    case VDATA_R32 :
+      {
+        double real;
+        memcpy( &real, vall, sizeof( double ) );
+        retval = !FEQ( vec->value.r32->val, (float)real );
+        vec->value.r32->val = (float)real;
+      }
+      break;
+    default :  assert( 0 );  break;
+  }
+
+  /* Set the set bit to indicate that this vector has been evaluated */
+  vec->suppl.part.set = 1;
+
+  PROFILE_END;
+
   return( retval );
 
 }
@@ -3358,15 +4237,26 @@ bool vector_bitwise_and_op(
         unsigned int src1_size = UL_SIZE(src1->width);
         unsigned int src2_size = UL_SIZE(src2->width);
         unsigned int i;
-        for( i=0; i<UL_SIZE(tgt->width); i++ ) {
-          ulong* entry1 = src1->value.ul[i];
-          ulong* entry2 = src2->value.ul[i];
-          ulong  val1_l = (i<src1_size) ? entry1[VTYPE_INDEX_VAL_VALL] : 0;
-          ulong  val1_h = (i<src1_size) ? entry1[VTYPE_INDEX_VAL_VALH] : 0;
-          ulong  val2_l = (i<src2_size) ? entry2[VTYPE_INDEX_VAL_VALL] : 0;
-          ulong  val2_h = (i<src2_size) ? entry2[VTYPE_INDEX_VAL_VALH] : 0;
-          scratchl[i]   = ~(val1_h | val2_h) & (val1_l & val2_l);
-          scratchh[i]   = (val1_h & val2_h) | (val1_h & val2_l) | (val2_h & val1_l);
+        ulong*       src1_l    = VEC_PLANE( src1, VTYPE_INDEX_VAL_VALL );
+        ulong*       src1_h    = VEC_PLANE( src1, VTYPE_INDEX_VAL_VALH );
+        ulong*       src2_l    = VEC_PLANE( src2, VTYPE_INDEX_VAL_VALL );
+        ulong*       src2_h    = VEC_PLANE( src2, VTYPE_INDEX_VAL_VALH );
+        if( tgt->width <= UL_BITS ) {
+          ulong  val1_l = src1_l[0];
+          ulong  val1_h = src1_h[0];
+          ulong  val2_l = src2_l[0];
+          ulong  val2_h = src2_h[0];
+          scratchl[0]   = ~(val1_h | val2_h) & (val1_l & val2_l);
+          scratchh[0]   = (val1_h & val2_h) | (val1_h & val2_l) | (val2_h & val1_l);
+        } else {
+          for( i=0; i<UL_SIZE(tgt->width); i++ ) {
+            ulong  val1_l = (i<src1_size) ? src1_l[i] : 0;
+            ulong  val1_h = (i<src1_size) ? src1_h[i] : 0;
+            ulong  val2_l = (i<src2_size) ? src2_l[i] : 0;
+            ulong  val2_h = (i<src2_size) ? src2_h[i] : 0;
+            scratchl[i]   = ~(val1_h | val2_h) & (val1_l & val2_l);
+            scratchh[i]   = (val1_h & val2_h) | (val1_h & val2_l) | (val2_h & val1_l);
+          }
         }
         retval = vector_set_coverage_and_assign_ulong( tgt, scratchl, scratchh, 0, (tgt->width - 1) );
       }
@@ -3403,15 +4293,26 @@ bool vector_bitwise_nand_op(
         unsigned int src1_size = UL_SIZE(src1->width);
         unsigned int src2_size = UL_SIZE(src2->width);
         unsigned int i;
-        for( i=0; i<UL_SIZE(tgt->width); i++ ) {
-          ulong* entry1 = src1->value.ul[i];
-          ulong* entry2 = src2->value.ul[i];
-          ulong  val1_l = (i<src1_size) ? entry1[VTYPE_INDEX_VAL_VALL] : 0;
-          ulong  val1_h = (i<src1_size) ? entry1[VTYPE_INDEX_VAL_VALH] : 0;
-          ulong  val2_l = (i<src2_size) ? entry2[VTYPE_INDEX_VAL_VALL] : 0;
-          ulong  val2_h = (i<src2_size) ? entry2[VTYPE_INDEX_VAL_VALH] : 0;
-          scratchl[i] = ~(val1_h | val2_h) & ~(val1_l & val2_l);
-          scratchh[i] = (val1_h & val2_h) | (val1_h & ~val2_l) | (val2_h & ~val1_l);
+        ulong*       src1_l    = VEC_PLANE( src1, VTYPE_INDEX_VAL_VALL );
+        ulong*       src1_h    = VEC_PLANE( src1, VTYPE_INDEX_VAL_VALH );
+        ulong*       src2_l    = VEC_PLANE( src2, VTYPE_INDEX_VAL_VALL );
+        ulong*       src2_h    = VEC_PLANE( src2, VTYPE_INDEX_VAL_VALH );
+        if( tgt->width <= UL_BITS ) {
+          ulong  val1_l = src1_l[0];
+          ulong  val1_h = src1_h[0];
+          ulong  val2_l = src2_l[0];
+          ulong  val2_h = src2_h[0];
+          scratchl[0] = ~(val1_h | val2_h) & ~(val1_l & val2_l);
+          scratchh[0] = (val1_h & val2_h) | (val1_h & ~val2_l) | (val2_h & ~val1_l);
+        } else {
+          for( i=0; i<UL_SIZE(tgt->width); i++ ) {
+            ulong  val1_l = (i<src1_size) ? src1_l[i] : 0;
+            ulong  val1_h = (i<src1_size) ? src1_h[i] : 0;
+            ulong  val2_l = (i<src2_size) ? src2_l[i] : 0;
+            ulong  val2_h = (i<src2_size) ? src2_h[i] : 0;
+            scratchl[i] = ~(val1_h | val2_h) & ~(val1_l & val2_l);
+            scratchh[i] = (val1_h & val2_h) | (val1_h & ~val2_l) | (val2_h & ~val1_l);
+          }
         }
         retval = vector_set_coverage_and_assign_ulong( tgt, scratchl, scratchh, 0, (tgt->width - 1) );
       }
@@ -3448,15 +4349,26 @@ bool vector_bitwise_or_op(
         unsigned int src1_size = UL_SIZE(src1->width);
         unsigned int src2_size = UL_SIZE(src2->width);
         unsigned int i;
-        for( i=0; i<UL_SIZE(tgt->width); i++ ) {
-          ulong* entry1 = src1->value.ul[i];
-          ulong* entry2 = src2->value.ul[i];
-          ulong  val1_l = (i<src1_size) ? entry1[VTYPE_INDEX_VAL_VALL] : 0;
-          ulong  val1_h = (i<src1_size) ? entry1[VTYPE_INDEX_VAL_VALH] : 0;
-          ulong  val2_l = (i<src2_size) ? entry2[VTYPE_INDEX_VAL_VALL] : 0;
-          ulong  val2_h = (i<src2_size) ? entry2[VTYPE_INDEX_VAL_VALH] : 0;
-          scratchl[i] = (val1_l & ~val1_h) | (val2_l & ~val2_h);
-          scratchh[i] = ~scratchl[i] & (val1_h | val2_h);
+        ulong*       src1_l    = VEC_PLANE( src1, VTYPE_INDEX_VAL_VALL );
+        ulong*       src1_h    = VEC_PLANE( src1, VTYPE_INDEX_VAL_VALH );
+        ulong*       src2_l    = VEC_PLANE( src2, VTYPE_INDEX_VAL_VALL );
+        ulong*       src2_h    = VEC_PLANE( src2, VTYPE_INDEX_VAL_VALH );
+        if( tgt->width <= UL_BITS ) {
+          ulong  val1_l = src1_l[0];
+          ulong  val1_h = src1_h[0];
+          ulong  val2_l = src2_l[0];
+          ulong  val2_h = src2_h[0];
+          scratchl[0] = (val1_l & ~val1_h) | (val2_l & ~val2_h);
+          scratchh[0] = ~scratchl[0] & (val1_h | val2_h);
+        } else {
+          for( i=0; i<UL_SIZE(tgt->width); i++ ) {
+            ulong  val1_l = (i<src1_size) ? src1_l[i] : 0;
+            ulong  val1_h = (i<src1_size) ? src1_h[i] : 0;
+            ulong  val2_l = (i<src2_size) ? src2_l[i] : 0;
+            ulong  val2_h = (i<src2_size) ? src2_h[i] : 0;
+            scratchl[i] = (val1_l & ~val1_h) | (val2_l & ~val2_h);
+            scratchh[i] = ~scratchl[i] & (val1_h | val2_h);
+          }
         }
         retval = vector_set_coverage_and_assign_ulong( tgt, scratchl, scratchh, 0, (tgt->width - 1) );
       }
@@ -3493,15 +4405,26 @@ bool vector_bitwise_nor_op(
         unsigned int src1_size = UL_SIZE(src1->width);
         unsigned int src2_size = UL_SIZE(src2->width);
         unsigned int i;
-        for( i=0; i<UL_SIZE(tgt->width); i++ ) {
-          ulong* entry1 = src1->value.ul[i];
-          ulong* entry2 = src2->value.ul[i];
-          ulong  val1_l = (i<src1_size) ? entry1[VTYPE_INDEX_VAL_VALL] : 0;
-          ulong  val1_h = (i<src1_size) ? entry1[VTYPE_INDEX_VAL_VALH] : 0;
-          ulong  val2_l = (i<src2_size) ? entry2[VTYPE_INDEX_VAL_VALL] : 0;
-          ulong  val2_h = (i<src2_size) ? entry2[VTYPE_INDEX_VAL_VALH] : 0;
-          scratchl[i] = ~(val1_h | val2_h) & ~(val1_l | val2_l);
-          scratchh[i] =  (val1_h & val2_h) |  (val1_h & val2_l) | (val2_h & val1_l);
+        ulong*       src1_l    = VEC_PLANE( src1, VTYPE_INDEX_VAL_VALL );
+        ulong*       src1_h    = VEC_PLANE( src1, VTYPE_INDEX_VAL_VALH );
+        ulong*       src2_l    = VEC_PLANE( src2, VTYPE_INDEX_VAL_VALL );
+        ulong*       src2_h    = VEC_PLANE( src2, VTYPE_INDEX_VAL_VALH );
+        if( tgt->width <= UL_BITS ) {
+          ulong  val1_l = src1_l[0];
+          ulong  val1_h = src1_h[0];
+          ulong  val2_l = src2_l[0];
+          ulong  val2_h = src2_h[0];
+          scratchl[0] = ~(val1_h | val2_h) & ~(val1_l | val2_l);
+          scratchh[0] =  (val1_h & val2_h) |  (val1_h & val2_l) | (val2_h & val1_l);
+        } else {
+          for( i=0; i<UL_SIZE(tgt->width); i++ ) {
+            ulong  val1_l = (i<src1_size) ? src1_l[i] : 0;
+            ulong  val1_h = (i<src1_size) ? src1_h[i] : 0;
+            ulong  val2_l = (i<src2_size) ? src2_l[i] : 0;
+            ulong  val2_h = (i<src2_size) ? src2_h[i] : 0;
+            scratchl[i] = ~(val1_h | val2_h) & ~(val1_l | val2_l);
+            scratchh[i] =  (val1_h & val2_h) |  (val1_h & val2_l) | (val2_h & val1_l);
+          }
         }
         retval = vector_set_coverage_and_assign_ulong( tgt, scratchl, scratchh, 0, (tgt->width - 1) );
       }
@@ -3538,15 +4461,26 @@ bool vector_bitwise_xor_op(
         unsigned int src1_size = UL_SIZE(src1->width);
         unsigned int src2_size = UL_SIZE(src2->width);
         unsigned int i;
-        for( i=0; i<UL_SIZE(tgt->width); i++ ) {
-          ulong* entry1 = src1->value.ul[i];
-          ulong* entry2 = src2->value.ul[i];
-          ulong  val1_l = (i<src1_size) ? entry1[VTYPE_INDEX_VAL_VALL] : 0;
-          ulong  val1_h = (i<src1_size) ? entry1[VTYPE_INDEX_VAL_VALH] : 0;
-          ulong  val2_l = (i<src2_size) ? entry2[VTYPE_INDEX_VAL_VALL] : 0;
-          ulong  val2_h = (i<src2_size) ? entry2[VTYPE_INDEX_VAL_VALH] : 0;
-          scratchl[i] = (val1_l ^ val2_l) & ~(val1_h | val2_h);
-          scratchh[i] = (val1_h | val2_h);
+        ulong*       src1_l    = VEC_PLANE( src1, VTYPE_INDEX_VAL_VALL );
+        ulong*       src1_h    = VEC_PLANE( src1, VTYPE_INDEX_VAL_VALH );
+        ulong*       src2_l    = VEC_PLANE( src2, VTYPE_INDEX_VAL_VALL );
+        ulong*       src2_h    = VEC_PLANE( src2, VTYPE_INDEX_VAL_VALH );
+        if( tgt->width <= UL_BITS ) {
+          ulong  val1_l = src1_l[0];
+          ulong  val1_h = src1_h[0];
+          ulong  val2_l = src2_l[0];
+          ulong  val2_h = src2_h[0];
+          scratchl[0] = (val1_l ^ val2_l) & ~(val1_h | val2_h);
+          scratchh[0] = (val1_h | val2_h);
+        } else {
+          for( i=0; i<UL_SIZE(tgt->width); i++ ) {
+            ulong  val1_l = (i<src1_size) ? src1_l[i] : 0;
+            ulong  val1_h = (i<src1_size) ? src1_h[i] : 0;
+            ulong  val2_l = (i<src2_size) ? src2_l[i] : 0;
+            ulong  val2_h = (i<src2_size) ? src2_h[i] : 0;
+            scratchl[i] = (val1_l ^ val2_l) & ~(val1_h | val2_h);
+            scratchh[i] = (val1_h | val2_h);
+          }
         }
         retval = vector_set_coverage_and_assign_ulong( tgt, scratchl, scratchh, 0, (tgt->width - 1) );
       }
@@ -3583,15 +4517,26 @@ bool vector_bitwise_nxor_op(
         unsigned int src1_size = UL_SIZE(src1->width);
         unsigned int src2_size = UL_SIZE(src2->width);
         unsigned int i;
-        for( i=0; i<UL_SIZE(tgt->width); i++ ) {
-          ulong* entry1 = src1->value.ul[i];
-          ulong* entry2 = src2->value.ul[i];
-          ulong  val1_l = (i<src1_size) ? entry1[VTYPE_INDEX_VAL_VALL] : 0;
-          ulong  val1_h = (i<src1_size) ? entry1[VTYPE_INDEX_VAL_VALH] : 0;
-          ulong  val2_l = (i<src2_size) ? entry2[VTYPE_INDEX_VAL_VALL] : 0;
-          ulong  val2_h = (i<src2_size) ? entry2[VTYPE_INDEX_VAL_VALH] : 0;
-          scratchl[i] = ~(val1_l ^ val2_l) & ~(val1_h | val2_h);
-          scratchh[i] =  (val1_h | val2_h);
+        ulong*       src1_l    = VEC_PLANE( src1, VTYPE_INDEX_VAL_VALL );
+        ulong*       src1_h    = VEC_PLANE( src1, VTYPE_INDEX_VAL_VALH );
+        ulong*       src2_l    = VEC_PLANE( src2, VTYPE_INDEX_VAL_VALL );
+        ulong*       src2_h    = VEC_PLANE( src2, VTYPE_INDEX_VAL_VALH );
+        if( tgt->width <= UL_BITS ) {
+          ulong  val1_l = src1_l[0];
+          ulong  val1_h = src1_h[0];
+          ulong  val2_l = src2_l[0];
+          ulong  val2_h = src2_h[0];
+          scratchl[0] = ~(val1_l ^ val2_l) & ~(val1_h | val2_h);
+          scratchh[0] =  (val1_h | val2_h);
+        } else {
+          for( i=0; i<UL_SIZE(tgt->width); i++ ) {
+            ulong  val1_l = (i<src1_size) ? src1_l[i] : 0;
+            ulong  val1_h = (i<src1_size) ? src1_h[i] : 0;
+            ulong  val2_l = (i<src2_size) ? src2_l[i] : 0;
+            ulong  val2_h = (i<src2_size) ? src2_h[i] : 0;
+            scratchl[i] = ~(val1_l ^ val2_l) & ~(val1_h | val2_h);
+            scratchh[i] =  (val1_h | val2_h);
+          }
         }
         retval = vector_set_coverage_and_assign_ulong( tgt, scratchl, scratchh, 0, (tgt->width - 1) );
       }
@@ -3614,8 +4559,8 @@ inline static bool vector_reverse_for_cmp_ulong(
 ) {
 
   return( left->suppl.part.is_signed && right->suppl.part.is_signed &&
-          (((left->value.ul[UL_DIV(left->width-1)][VTYPE_INDEX_VAL_VALL]   >> UL_MOD(left->width  - 1)) & 0x1) !=
-           ((right->value.ul[UL_DIV(right->width-1)][VTYPE_INDEX_VAL_VALL] >> UL_MOD(right->width - 1)) & 0x1)) );
+          (((VEC_PLANE( left, VTYPE_INDEX_VAL_VALL )[UL_DIV(left->width-1)]   >> UL_MOD(left->width  - 1)) & 0x1) !=
+           ((VEC_PLANE( right, VTYPE_INDEX_VAL_VALL )[UL_DIV(right->width-1)] >> UL_MOD(right->width - 1)) & 0x1)) );
 
 }
 
@@ -3635,8 +4580,8 @@ inline static void vector_copy_val_and_sign_extend_ulong(
   /* If we are at or exceeding the size of the current vector, it is a signed vector and the MSB is one, sign extend */
   if( (index >= last_index) && (vec->suppl.part.is_signed == 1) && msb_is_one ) {
     if( index == last_index ) {
-      *vall = vec->value.ul[index][VTYPE_INDEX_VAL_VALL] | UL_LMASK(vec->width);
-      *valh = vec->value.ul[index][VTYPE_INDEX_VAL_VALH];
+      *vall = VEC_PLANE( vec, VTYPE_INDEX_VAL_VALL )[index] | UL_LMASK(vec->width);
+      *valh = VEC_PLANE( vec, VTYPE_INDEX_VAL_VALH )[index];
     } else {
       *vall = UL_SET;
       *valh = 0;
@@ -3649,8 +4594,8 @@ inline static void vector_copy_val_and_sign_extend_ulong(
 
   /* Otherwise, just copy the value */
   } else {
-    *vall = vec->value.ul[index][VTYPE_INDEX_VAL_VALL];
-    *valh = vec->value.ul[index][VTYPE_INDEX_VAL_VALH];
+    *vall = VEC_PLANE( vec, VTYPE_INDEX_VAL_VALL )[index];
+    *valh = VEC_PLANE( vec, VTYPE_INDEX_VAL_VALH )[index];
   }
   
 }
@@ -3685,8 +4630,8 @@ bool vector_op_lt(
             int          i           = ((lsize < rsize) ? rsize : lsize);
             unsigned int lmsb        = (left->width - 1);
             unsigned int rmsb        = (right->width - 1);
-            bool         lmsb_is_one = (((left->value.ul[UL_DIV(lmsb)][VTYPE_INDEX_VAL_VALL]  >> UL_MOD(lmsb)) & 1) == 1);
-            bool         rmsb_is_one = (((right->value.ul[UL_DIV(rmsb)][VTYPE_INDEX_VAL_VALL] >> UL_MOD(rmsb)) & 1) == 1);
+            bool         lmsb_is_one = (((VEC_PLANE( left, VTYPE_INDEX_VAL_VALL )[UL_DIV(lmsb)]  >> UL_MOD(lmsb)) & 1) == 1);
+            bool         rmsb_is_one = (((VEC_PLANE( right, VTYPE_INDEX_VAL_VALL )[UL_DIV(rmsb)] >> UL_MOD(rmsb)) & 1) == 1);
             ulong        lvall;
             ulong        lvalh;
             ulong        rvall;
@@ -3744,8 +4689,8 @@ bool vector_op_le(
             int          i           = ((lsize < rsize) ? rsize : lsize);
             unsigned int lmsb        = (left->width - 1);
             unsigned int rmsb        = (right->width - 1);
-            bool         lmsb_is_one = (((left->value.ul[UL_DIV(lmsb)][VTYPE_INDEX_VAL_VALL]  >> UL_MOD(lmsb)) & 1) == 1);
-            bool         rmsb_is_one = (((right->value.ul[UL_DIV(rmsb)][VTYPE_INDEX_VAL_VALL] >> UL_MOD(rmsb)) & 1) == 1);
+            bool         lmsb_is_one = (((VEC_PLANE( left, VTYPE_INDEX_VAL_VALL )[UL_DIV(lmsb)]  >> UL_MOD(lmsb)) & 1) == 1);
+            bool         rmsb_is_one = (((VEC_PLANE( right, VTYPE_INDEX_VAL_VALL )[UL_DIV(rmsb)] >> UL_MOD(rmsb)) & 1) == 1);
             ulong        lvall;
             ulong        lvalh;
             ulong        rvall;
@@ -3803,8 +4748,8 @@ bool vector_op_gt(
             int          i           = ((lsize < rsize) ? rsize : lsize);
             unsigned int lmsb        = (left->width - 1);
             unsigned int rmsb        = (right->width - 1);
-            bool         lmsb_is_one = (((left->value.ul[UL_DIV(lmsb)][VTYPE_INDEX_VAL_VALL]  >> UL_MOD(lmsb)) & 1) == 1);
-            bool         rmsb_is_one = (((right->value.ul[UL_DIV(rmsb)][VTYPE_INDEX_VAL_VALL] >> UL_MOD(rmsb)) & 1) == 1);
+            bool         lmsb_is_one = (((VEC_PLANE( left, VTYPE_INDEX_VAL_VALL )[UL_DIV(lmsb)]  >> UL_MOD(lmsb)) & 1) == 1);
+            bool         rmsb_is_one = (((VEC_PLANE( right, VTYPE_INDEX_VAL_VALL )[UL_DIV(rmsb)] >> UL_MOD(rmsb)) & 1) == 1);
             ulong        lvall;
             ulong        lvalh;
             ulong        rvall;
@@ -3862,8 +4807,8 @@ bool vector_op_ge(
             int          i           = ((lsize < rsize) ? rsize : lsize);
             unsigned int lmsb        = (left->width - 1);
             unsigned int rmsb        = (right->width - 1);
-            bool         lmsb_is_one = (((left->value.ul[UL_DIV(lmsb)][VTYPE_INDEX_VAL_VALL]  >> UL_MOD(lmsb)) & 1) == 1);
-            bool         rmsb_is_one = (((right->value.ul[UL_DIV(rmsb)][VTYPE_INDEX_VAL_VALL] >> UL_MOD(rmsb)) & 1) == 1);
+            bool         lmsb_is_one = (((VEC_PLANE( left, VTYPE_INDEX_VAL_VALL )[UL_DIV(lmsb)]  >> UL_MOD(lmsb)) & 1) == 1);
+            bool         rmsb_is_one = (((VEC_PLANE( right, VTYPE_INDEX_VAL_VALL )[UL_DIV(rmsb)] >> UL_MOD(rmsb)) & 1) == 1);
             ulong        lvall;
             ulong        lvalh;
             ulong        rvall;
@@ -3921,8 +4866,8 @@ bool vector_op_eq(
             int          i           = ((lsize < rsize) ? rsize : lsize);
             unsigned int lmsb        = (left->width - 1);
             unsigned int rmsb        = (right->width - 1);
-            bool         lmsb_is_one = (((left->value.ul[UL_DIV(lmsb)][VTYPE_INDEX_VAL_VALL]  >> UL_MOD(lmsb)) & 1) == 1);
-            bool         rmsb_is_one = (((right->value.ul[UL_DIV(rmsb)][VTYPE_INDEX_VAL_VALL] >> UL_MOD(rmsb)) & 1) == 1);
+            bool         lmsb_is_one = (((VEC_PLANE( left, VTYPE_INDEX_VAL_VALL )[UL_DIV(lmsb)]  >> UL_MOD(lmsb)) & 1) == 1);
+            bool         rmsb_is_one = (((VEC_PLANE( right, VTYPE_INDEX_VAL_VALL )[UL_DIV(rmsb)] >> UL_MOD(rmsb)) & 1) == 1);
             ulong        lvall;
             ulong        lvalh;
             ulong        rvall;
@@ -3964,8 +4909,8 @@ bool vector_ceq_ulong(
   int          i           = ((lsize < rsize) ? rsize : lsize);
   unsigned int lmsb        = (left->width - 1);
   unsigned int rmsb        = (right->width - 1);
-  bool         lmsb_is_one = (((left->value.ul[UL_DIV(lmsb)][VTYPE_INDEX_VAL_VALL]  >> UL_MOD(lmsb)) & 1) == 1);
-  bool         rmsb_is_one = (((right->value.ul[UL_DIV(rmsb)][VTYPE_INDEX_VAL_VALL] >> UL_MOD(rmsb)) & 1) == 1);
+  bool         lmsb_is_one = (((VEC_PLANE( left, VTYPE_INDEX_VAL_VALL )[UL_DIV(lmsb)]  >> UL_MOD(lmsb)) & 1) == 1);
+  bool         rmsb_is_one = (((VEC_PLANE( right, VTYPE_INDEX_VAL_VALL )[UL_DIV(rmsb)] >> UL_MOD(rmsb)) & 1) == 1);
   ulong        lvall;
   ulong        lvalh;
   ulong        rvall;
@@ -4036,8 +4981,8 @@ bool vector_op_cxeq(
         int          i           = ((lsize < rsize) ? rsize : lsize);
         unsigned int lmsb        = (left->width - 1);
         unsigned int rmsb        = (right->width - 1);
-        bool         lmsb_is_one = (((left->value.ul[UL_DIV(lmsb)][VTYPE_INDEX_VAL_VALL]  >> UL_MOD(lmsb)) & 1) == 1);
-        bool         rmsb_is_one = (((right->value.ul[UL_DIV(rmsb)][VTYPE_INDEX_VAL_VALL] >> UL_MOD(rmsb)) & 1) == 1);
+        bool         lmsb_is_one = (((VEC_PLANE( left, VTYPE_INDEX_VAL_VALL )[UL_DIV(lmsb)]  >> UL_MOD(lmsb)) & 1) == 1);
+        bool         rmsb_is_one = (((VEC_PLANE( right, VTYPE_INDEX_VAL_VALL )[UL_DIV(rmsb)] >> UL_MOD(rmsb)) & 1) == 1);
         ulong        mask        = (left->width < right->width) ? UL_HMASK(left->width - 1) : UL_HMASK(right->width - 1);
         ulong        lvall;
         ulong        lvalh;
@@ -4084,8 +5029,8 @@ bool vector_op_czeq(
         int          i           = ((lsize < rsize) ? rsize : lsize) - 1;
         unsigned int lmsb        = (left->width - 1);
         unsigned int rmsb        = (right->width - 1);
-        bool         lmsb_is_one = (((left->value.ul[UL_DIV(lmsb)][VTYPE_INDEX_VAL_VALL]  >> UL_MOD(lmsb)) & 1) == 1);
-        bool         rmsb_is_one = (((right->value.ul[UL_DIV(rmsb)][VTYPE_INDEX_VAL_VALL] >> UL_MOD(rmsb)) & 1) == 1);
+        bool         lmsb_is_one = (((VEC_PLANE( left, VTYPE_INDEX_VAL_VALL )[UL_DIV(lmsb)]  >> UL_MOD(lmsb)) & 1) == 1);
+        bool         rmsb_is_one = (((VEC_PLANE( right, VTYPE_INDEX_VAL_VALL )[UL_DIV(rmsb)] >> UL_MOD(rmsb)) & 1) == 1);
         ulong        mask        = (left->width < right->width) ? UL_HMASK(left->width - 1) : UL_HMASK(right->width - 1);
         ulong        lvall;
         ulong        lvalh;
@@ -4142,8 +5087,8 @@ bool vector_op_ne(
             int          i           = ((lsize < rsize) ? rsize : lsize);
             unsigned int lmsb        = (left->width - 1);
             unsigned int rmsb        = (right->width - 1);
-            bool         lmsb_is_one = (((left->value.ul[UL_DIV(lmsb)][VTYPE_INDEX_VAL_VALL]  >> UL_MOD(lmsb)) & 1) == 1);
-            bool         rmsb_is_one = (((right->value.ul[UL_DIV(rmsb)][VTYPE_INDEX_VAL_VALL] >> UL_MOD(rmsb)) & 1) == 1);
+            bool         lmsb_is_one = (((VEC_PLANE( left, VTYPE_INDEX_VAL_VALL )[UL_DIV(lmsb)]  >> UL_MOD(lmsb)) & 1) == 1);
+            bool         rmsb_is_one = (((VEC_PLANE( right, VTYPE_INDEX_VAL_VALL )[UL_DIV(rmsb)] >> UL_MOD(rmsb)) & 1) == 1);
             ulong        lvall;
             ulong        lvalh;
             ulong        rvall;
@@ -4427,17 +5372,24 @@ bool vector_op_add(
           ulong        vall[UL_DIV(MAX_BIT_WIDTH)];
           ulong        valh[UL_DIV(MAX_BIT_WIDTH)];
           ulong        carry = 0;
-          bool         lmsb_is_one = (((left->value.ul[UL_DIV(left->width-1)][VTYPE_INDEX_VAL_VALL]   >> UL_MOD(left->width  - 1)) & 1) == 1);
-          bool         rmsb_is_one = (((right->value.ul[UL_DIV(right->width-1)][VTYPE_INDEX_VAL_VALL] >> UL_MOD(right->width - 1)) & 1) == 1);
+          bool         lmsb_is_one = (((VEC_PLANE( left, VTYPE_INDEX_VAL_VALL )[UL_DIV(left->width-1)]   >> UL_MOD(left->width  - 1)) & 1) == 1);
+          bool         rmsb_is_one = (((VEC_PLANE( right, VTYPE_INDEX_VAL_VALL )[UL_DIV(right->width-1)] >> UL_MOD(right->width - 1)) & 1) == 1);
           ulong        lvall, lvalh;
           ulong        rvall, rvalh;
           unsigned int i;
-          for( i=0; i<UL_SIZE( tgt->width ); i++ ) {
-            vector_copy_val_and_sign_extend_ulong( left,  i, lmsb_is_one, &lvall, &lvalh ); 
-            vector_copy_val_and_sign_extend_ulong( right, i, rmsb_is_one, &rvall, &rvalh ); 
-            vall[i] = lvall + rvall + carry;
-            valh[i] = 0;
-            carry   = ((lvall & rvall) | ((lvall | rvall) & ~vall[i])) >> (UL_BITS - 1);
+          if( tgt->width <= UL_BITS ) {
+            vector_copy_val_and_sign_extend_ulong( left,  0, lmsb_is_one, &lvall, &lvalh );
+            vector_copy_val_and_sign_extend_ulong( right, 0, rmsb_is_one, &rvall, &rvalh );
+            vall[0] = lvall + rvall;
+            valh[0] = 0;
+          } else {
+            for( i=0; i<UL_SIZE( tgt->width ); i++ ) {
+              vector_copy_val_and_sign_extend_ulong( left,  i, lmsb_is_one, &lvall, &lvalh ); 
+              vector_copy_val_and_sign_extend_ulong( right, i, rmsb_is_one, &rvall, &rvalh ); 
+              vall[i] = lvall + rvall + carry;
+              valh[i] = 0;
+              carry   = ((lvall & rvall) | ((lvall | rvall) & ~vall[i])) >> (UL_BITS - 1);
+            }
           }
           retval = vector_set_coverage_and_assign_ulong( tgt, vall, valh, 0, (tgt->width - 1) );
         }
@@ -4489,7 +5441,7 @@ bool vector_op_negate(
       case VDATA_UL :
         {
           if( src->width <= UL_BITS ) {
-            ulong vall = ~src->value.ul[0][VTYPE_INDEX_EXP_VALL] + 1;
+            ulong vall = ~VEC_PLANE( src, VTYPE_INDEX_EXP_VALL )[0] + 1;
             ulong valh = 0;
 
             retval = vector_set_coverage_and_assign_ulong( tgt, &vall, &valh, 0, (tgt->width - 1) );
@@ -4502,7 +5454,7 @@ bool vector_op_negate(
             ulong        val;
 
             for( i=0; i<(size - 1); i++ ) {
-              val     = ~src->value.ul[i][VTYPE_INDEX_EXP_VALL];
+              val     = ~VEC_PLANE( src, VTYPE_INDEX_EXP_VALL )[i];
               vall[i] = 0;
               valh[i] = 0;
               for( j=0; j<UL_BITS; j++ ) {
@@ -4511,7 +5463,7 @@ bool vector_op_negate(
                 vall[i]  |= (bit & 0x1) << j;
               }
             }
-            val     = ~src->value.ul[i][VTYPE_INDEX_EXP_VALL];
+            val     = ~VEC_PLANE( src, VTYPE_INDEX_EXP_VALL )[i];
             vall[i] = 0;
             valh[i] = 0;
             for( j=0; j<(tgt->width - (i << UL_DIV_VAL)); j++ ) {
@@ -4578,18 +5530,25 @@ bool vector_op_subtract(
           ulong        vall[UL_DIV(MAX_BIT_WIDTH)];
           ulong        valh[UL_DIV(MAX_BIT_WIDTH)];
           ulong        carry = 1;
-          bool         lmsb_is_one = (((left->value.ul[UL_DIV(left->width-1)][VTYPE_INDEX_VAL_VALL]   >> UL_MOD(left->width  - 1)) & 1) == 1);
-          bool         rmsb_is_one = (((right->value.ul[UL_DIV(right->width-1)][VTYPE_INDEX_VAL_VALL] >> UL_MOD(right->width - 1)) & 1) == 1);
+          bool         lmsb_is_one = (((VEC_PLANE( left, VTYPE_INDEX_VAL_VALL )[UL_DIV(left->width-1)]   >> UL_MOD(left->width  - 1)) & 1) == 1);
+          bool         rmsb_is_one = (((VEC_PLANE( right, VTYPE_INDEX_VAL_VALL )[UL_DIV(right->width-1)] >> UL_MOD(right->width - 1)) & 1) == 1);
           ulong        lvall, lvalh;
           ulong        rvall, rvalh;
           unsigned int i;
-          for( i=0; i<UL_SIZE( tgt->width ); i++ ) {
-            vector_copy_val_and_sign_extend_ulong( left,  i, lmsb_is_one, &lvall, &lvalh );
-            vector_copy_val_and_sign_extend_ulong( right, i, rmsb_is_one, &rvall, &rvalh ); 
-            rvall   = ~rvall;
-            vall[i] = lvall + rvall + carry;
-            valh[i] = 0;
-            carry   = ((lvall & rvall) | ((lvall | rvall) & ~vall[i])) >> (UL_BITS - 1);
+          if( tgt->width <= UL_BITS ) {
+            vector_copy_val_and_sign_extend_ulong( left,  0, lmsb_is_one, &lvall, &lvalh );
+            vector_copy_val_and_sign_extend_ulong( right, 0, rmsb_is_one, &rvall, &rvalh );
+            vall[0] = lvall - rvall;
+            valh[0] = 0;
+          } else {
+            for( i=0; i<UL_SIZE( tgt->width ); i++ ) {
+              vector_copy_val_and_sign_extend_ulong( left,  i, lmsb_is_one, &lvall, &lvalh );
+              vector_copy_val_and_sign_extend_ulong( right, i, rmsb_is_one, &rvall, &rvalh ); 
+              rvall   = ~rvall;
+              vall[i] = lvall + rvall + carry;
+              valh[i] = 0;
+              carry   = ((lvall & rvall) | ((lvall | rvall) & ~vall[i])) >> (UL_BITS - 1);
+            }
           }
           retval = vector_set_coverage_and_assign_ulong( tgt, vall, valh, 0, (tgt->width - 1) );
         }
@@ -4619,14 +5578,564 @@ bool vector_op_subtract(
 
 }
 
+/*!
+ \return Returns the lower machine word of the product of a and b.
+
+ Multiplies two machine words, storing the upper word of the double-word product in hi.
+*/
+inline static ulong vector_mul_word_ulong(
+            ulong  a,  /*!< First operand */
+            ulong  b,  /*!< Second operand */
+  /*@out@*/ ulong* hi  /*!< Upper word of product */
+) {
+
+#if (UL_BITS == 64) && defined(__SIZEOF_INT128__)
+  unsigned __int128 p = (unsigned __int128)a * b;
+  *hi = (ulong)(p >> 64);
+  return( (ulong)p );
+#else
+  ulong al  = a & UL_HALF_MASK;
+  ulong ah  = a >> UL_HALF_BITS;
+  ulong bl  = b & UL_HALF_MASK;
+  ulong bh  = b >> UL_HALF_BITS;
+  ulong ll  = al * bl;
+  ulong lh  = al * bh;
+  ulong hl  = ah * bl;
+  ulong mid = (ll >> UL_HALF_BITS) + (lh & UL_HALF_MASK) + (hl & UL_HALF_MASK);
+  *hi = (ah * bh) + (lh >> UL_HALF_BITS) + (hl >> UL_HALF_BITS) + (mid >> UL_HALF_BITS);
+  return( (mid << UL_HALF_BITS) | (ll & UL_HALF_MASK) );
+#endif
+
+}
+
+/*!
+ Copies the lower value plane of the given vector into a size word array, sign extending the value
+ if sign_extend is TRUE and the vector is signed; otherwise, the value is zero extended.
+*/
+static void vector_get_words_ulong(
+            const vector* vec,          /*!< Pointer to vector to get value words from */
+  /*@out@*/ ulong*        words,        /*!< Array of size words to store the value in */
+            unsigned int  size,         /*!< Number of words to fill in the words array */
+            bool          sign_extend   /*!< Set to TRUE if a signed vector should be sign extended */
+) { PROFILE(VECTOR_GET_WORDS_ULONG);
+
+  const ulong* vall = VEC_PLANE( vec, VTYPE_INDEX_VAL_VALL );
+  unsigned int last = UL_DIV(vec->width - 1);
+  ulong        fill = 0;
+  unsigned int i;
+
+  if( sign_extend && (vec->suppl.part.is_signed == 1) && (((vall[last] >> UL_MOD(vec->width - 1)) & 0x1) == 1) ) {
+    fill = UL_SET;
+  }
+
+  for( i=0; (i<size) && (i<last); i++ ) {
+    words[i] = vall[i];
+  }
+  if( i < size ) {
+    words[i] = (vall[i] & UL_HMASK(vec->width - 1)) | (fill & ~UL_HMASK(vec->width - 1));
+    for( i++; i<size; i++ ) {
+      words[i] = fill;
+    }
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ Performs an unsigned schoolbook multiplication of the an word array a and the bn word array b,
+ storing the lower rn words of the product in r.  The r array must not overlap either operand.
+*/
+static void vector_mul_school_ulong(
+  /*@out@*/ ulong*       r,   /*!< Array of rn words to store product in */
+            unsigned int rn,  /*!< Number of words of the product to calculate */
+            const ulong* a,   /*!< First operand */
+            unsigned int an,  /*!< Number of words in first operand */
+            const ulong* b,   /*!< Second operand */
+            unsigned int bn   /*!< Number of words in second operand */
+) { PROFILE(VECTOR_MUL_SCHOOL_ULONG);
+
+  unsigned int i, j;
+
+  memset( r, 0, (sizeof( ulong ) * rn) );
+
+  for( i=0; (i<an) && (i<rn); i++ ) {
+    ulong carry = 0;
+    if( a[i] == 0 ) {
+      continue;
+    }
+    for( j=0; (j<bn) && ((i + j) < rn); j++ ) {
+      ulong hi;
+      ulong lo = vector_mul_word_ulong( a[i], b[j], &hi );
+      lo       += carry;
+      hi       += (lo < carry);
+      r[i+j]   += lo;
+      hi       += (r[i+j] < lo);
+      carry     = hi;
+    }
+    if( (i + j) < rn ) {
+      r[i+j] = carry;
+    }
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns the number of scratch words needed by vector_mul_karatsuba_ulong for n word operands.
+*/
+static unsigned int vector_karatsuba_scratch_size(
+  unsigned int n  /*!< Number of words in each operand */
+) {
+
+  unsigned int h = n - (n / 2);
+
+  return( (n < VECTOR_KARATSUBA_THRESHOLD) ? 0 : ((4 * (h + 1)) + vector_karatsuba_scratch_size( h + 1 )) );
+
+}
+
+/*!
+ Performs an unsigned Karatsuba multiplication of the two n word arrays a and b, storing the full 2n
+ word product in r.  Operands smaller than VECTOR_KARATSUBA_THRESHOLD words are multiplied with the
+ schoolbook algorithm.  The ws array must contain at least vector_karatsuba_scratch_size( n ) words.
+*/
+static void vector_mul_karatsuba_ulong(
+  /*@out@*/ ulong*       r,   /*!< Array of 2n words to store product in */
+            const ulong* a,   /*!< First operand */
+            const ulong* b,   /*!< Second operand */
+            unsigned int n,   /*!< Number of words in each operand */
+            ulong*       ws   /*!< Scratch words */
+) { PROFILE(VECTOR_MUL_KARATSUBA_ULONG);
+
+  if( n < VECTOR_KARATSUBA_THRESHOLD ) {
+
+    vector_mul_school_ulong( r, (2 * n), a, n, b, n );
+
+  } else {
+
+    unsigned int m    = n / 2;
+    unsigned int h    = n - m;
+    ulong*       sa   = ws;
+    ulong*       sb   = sa + (h + 1);
+    ulong*       z1   = sb + (h + 1);
+    ulong*       next = z1 + (2 * (h + 1));
+    ulong        ca   = 0;
+    ulong        cb   = 0;
+    unsigned int i;
+
+    /* z0 = a0 * b0 and z2 = a1 * b1 go directly into the lower and upper halves of the result */
+    vector_mul_karatsuba_ulong( r, a, b, m, next );
+    vector_mul_karatsuba_ulong( (r + (2 * m)), (a + m), (b + m), h, next );
+
+    /* Calculate (a0 + a1) and (b0 + b1) */
+    for( i=0; i<h; i++ ) {
+      ulong ta = ((i < m) ? a[i] : 0) + a[m+i];
+      ulong tb = ((i < m) ? b[i] : 0) + b[m+i];
+      ulong c;
+      c     = (ta < a[m+i]) ? 1 : 0;
+      sa[i] = ta + ca;
+      ca    = c | ((sa[i] < ta) ? 1 : 0);
+      c     = (tb < b[m+i]) ? 1 : 0;
+      sb[i] = tb + cb;
+      cb    = c | ((sb[i] < tb) ? 1 : 0);
+    }
+    sa[h] = ca;
+    sb[h] = cb;
+
+    /* z1 = (a0 + a1) * (b0 + b1) - z0 - z2 */
+    vector_mul_karatsuba_ulong( z1, sa, sb, (h + 1), next );
+    ca = 0;
+    cb = 0;
+    for( i=0; i<(2 * (h + 1)); i++ ) {
+      ulong z0 = (i < (2 * m)) ? r[i] : 0;
+      ulong z2 = (i < (2 * h)) ? r[(2 * m) + i] : 0;
+      ulong t  = z1[i] - z0 - ca;
+      ca       = (z1[i] < z0) || ((z1[i] - z0) < ca) ? 1 : 0;
+      z1[i]    = t - z2 - cb;
+      cb       = (t < z2) || ((t - z2) < cb) ? 1 : 0;
+    }
+
+    /* Add z1 into the middle of the result */
+    ca = 0;
+    for( i=m; i<(2 * n); i++ ) {
+      ulong v = ((i - m) < (2 * (h + 1))) ? z1[i-m] : 0;
+      ulong t = r[i] + v;
+      ulong c = (t < v) ? 1 : 0;
+      r[i]    = t + ca;
+      ca      = c | ((r[i] < t) ? 1 : 0);
+    }
+
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns the number of scratch words needed by vector_mullo_karatsuba_ulong for n word operands.
+*/
+static unsigned int vector_mullo_scratch_size(
+  unsigned int n  /*!< Number of words in each operand */
+) {
+
+  unsigned int m = n / 2;
+  unsigned int h = n - m;
+
+  return( (n < VECTOR_KARATSUBA_THRESHOLD) ? 0 : ((2 * h) + vector_karatsuba_scratch_size( m ) + vector_mullo_scratch_size( h )) );
+
+}
+
+/*!
+ Calculates the lower n words of the product of the two n word arrays a and b.  The lower half of
+ the product is a0 * b0 (calculated with Karatsuba) plus the lower halves of a1 * b0 and a0 * b1
+ (calculated recursively), so only about half of the work of a full product is performed.  The ws
+ array must contain at least vector_mullo_scratch_size( n ) words.
+*/
+static void vector_mullo_karatsuba_ulong(
+  /*@out@*/ ulong*       r,   /*!< Array of n words to store product in */
+            const ulong* a,   /*!< First operand */
+            const ulong* b,   /*!< Second operand */
+            unsigned int n,   /*!< Number of words in operands and result */
+            ulong*       ws   /*!< Scratch words */
+) { PROFILE(VECTOR_MULLO_KARATSUBA_ULONG);
+
+  if( n < VECTOR_KARATSUBA_THRESHOLD ) {
+
+    vector_mul_school_ulong( r, n, a, n, b, n );
+
+  } else {
+
+    unsigned int m     = n / 2;
+    unsigned int h     = n - m;
+    ulong*       t     = ws;
+    ulong*       lo    = t + h;
+    ulong*       next  = lo + h;
+    unsigned int i, k;
+
+    /* Full product of the lower halves (plus the only word of a1 * b1 that is kept if n is odd) */
+    vector_mul_karatsuba_ulong( r, a, b, m, (next + vector_mullo_scratch_size( h )) );
+    if( n > (2 * m) ) {
+      r[2*m] = a[m] * b[m];
+    }
+
+    /* Add the lower h words of a1 * b0 and a0 * b1 to the upper h words of the result (a0 and b0 zero-padded to h words) */
+    for( k=0; k<2; k++ ) {
+      const ulong* hi = (k == 0) ? (a + m) : (b + m);
+      const ulong* ls = (k == 0) ? b : a;
+      ulong        c  = 0;
+      memcpy( lo, ls, (sizeof( ulong ) * m) );
+      if( h > m ) {
+        lo[m] = 0;
+      }
+      vector_mullo_karatsuba_ulong( t, hi, lo, h, next );
+      for( i=0; i<h; i++ ) {
+        ulong v = r[m+i] + t[i];
+        ulong c2 = (v < t[i]) ? 1 : 0;
+        r[m+i] = v + c;
+        c      = c2 | ((r[m+i] < v) ? 1 : 0);
+      }
+    }
+
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ Calculates r = a * b, truncated to size words.  The r array must not overlap either operand.
+*/
+static void vector_mul_ulong(
+  /*@out@*/ ulong*       r,    /*!< Array of size words to store the product in */
+            const ulong* a,    /*!< First operand of size words */
+            const ulong* b,    /*!< Second operand of size words */
+            unsigned int size  /*!< Number of words in operands and result */
+) { PROFILE(VECTOR_MUL_ULONG);
+
+  unsigned int an = size;
+  unsigned int bn = size;
+
+  /* Leading zero words do not contribute to the product */
+  while( (an > 0) && (a[an-1] == 0) ) an--;
+  while( (bn > 0) && (b[bn-1] == 0) ) bn--;
+
+  if( (an < VECTOR_KARATSUBA_THRESHOLD) || (bn < VECTOR_KARATSUBA_THRESHOLD) ) {
+
+    vector_mul_school_ulong( r, size, a, an, b, bn );
+
+  } else {
+
+    unsigned int n     = (an > bn) ? an : bn;
+    bool         full  = (size >= (2 * n));
+    unsigned int wsize = full ? ((4 * n) + vector_karatsuba_scratch_size( n )) : vector_mullo_scratch_size( size );
+    ulong*       ws    = (ulong*)malloc_safe_nolimit( sizeof( ulong ) * wsize );
+
+    /* If the whole product fits in the result, calculate it; otherwise, only calculate the lower words */
+    if( full ) {
+
+      ulong* pa = ws;
+      ulong* pb = pa + n;
+      ulong* pr = pb + n;
+
+      memcpy( pa, a, (sizeof( ulong ) * an) );
+      memset( (pa + an), 0, (sizeof( ulong ) * (n - an)) );
+      memcpy( pb, b, (sizeof( ulong ) * bn) );
+      memset( (pb + bn), 0, (sizeof( ulong ) * (n - bn)) );
+
+      vector_mul_karatsuba_ulong( pr, pa, pb, n, (pr + (2 * n)) );
+
+      memcpy( r, pr, (sizeof( ulong ) * (2 * n)) );
+      memset( (r + (2 * n)), 0, (sizeof( ulong ) * (size - (2 * n))) );
+
+    } else {
+
+      vector_mullo_karatsuba_ulong( r, a, b, size, ws );
+
+    }
+
+    free_safe( ws, (sizeof( ulong ) * wsize) );
+
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ Replaces the size word array with its twos complement.
+*/
+static void vector_negate_words_ulong(
+  ulong*       words,  /*!< Array of words to negate */
+  unsigned int size    /*!< Number of words in array */
+) {
+
+  ulong        carry = 1;
+  unsigned int i;
+
+  for( i=0; i<size; i++ ) {
+    words[i] = ~words[i] + carry;
+    carry    = ((carry == 1) && (words[i] == 0)) ? 1 : 0;
+  }
+
+}
+
+/*!
+ Performs an unsigned multi-word division of the size word arrays u and v (Knuth, TAOCP Vol. 2,
+ Algorithm D), storing the quotient in q and the remainder in r.  The division is performed on
+ half-word digits so that each partial quotient can be calculated with a single machine word
+ division.  The divisor must be non-zero.
+*/
+static void vector_divmod_ulong(
+  /*@out@*/ ulong*       q,    /*!< Array of size words to store the quotient in */
+  /*@out@*/ ulong*       r,    /*!< Array of size words to store the remainder in */
+            const ulong* u,    /*!< Dividend */
+            const ulong* v,    /*!< Divisor */
+            unsigned int size  /*!< Number of words in all arrays */
+) { PROFILE(VECTOR_DIVMOD_ULONG);
+
+  ulong        un[(UL_DIV(MAX_BIT_WIDTH) * 2) + 1];
+  ulong        vn[UL_DIV(MAX_BIT_WIDTH) * 2];
+  ulong        qn[UL_DIV(MAX_BIT_WIDTH) * 2];
+  unsigned int m = size * 2;
+  unsigned int n = size * 2;
+  unsigned int s = 0;
+  unsigned int i;
+  int          j;
+
+  /* Split the operands into half-word digits, shifting the divisor and dividend left so that the most-significant digit of the divisor has its upper bit set */
+  for( i=0; i<size; i++ ) {
+    vn[2*i]     = v[i] & UL_HALF_MASK;
+    vn[(2*i)+1] = v[i] >> UL_HALF_BITS;
+  }
+  while( (n > 0) && (vn[n-1] == 0) ) n--;
+  assert( n > 0 );
+  while( ((vn[n-1] << s) & (UL_HALF_MASK ^ (UL_HALF_MASK >> 1))) == 0 ) s++;
+  for( i=0; i<size; i++ ) {
+    un[2*i]     = u[i] & UL_HALF_MASK;
+    un[(2*i)+1] = u[i] >> UL_HALF_BITS;
+  }
+  while( (m > 0) && (un[m-1] == 0) ) m--;
+
+  memset( qn, 0, (sizeof( ulong ) * size * 2) );
+
+  if( m < n ) {
+
+    /* The dividend is smaller than the divisor, so the quotient is zero and the remainder is the dividend */
+    memcpy( r, u, (sizeof( ulong ) * size) );
+
+  } else if( n == 1 ) {
+
+    ulong rem = 0;
+
+    for( j=(m - 1); j>=0; j-- ) {
+      ulong num = (rem << UL_HALF_BITS) | un[j];
+      qn[j] = num / vn[0];
+      rem   = num - (qn[j] * vn[0]);
+    }
+    memset( r, 0, (sizeof( ulong ) * size) );
+    r[0] = rem;
+
+  } else {
+
+    un[m] = 0;
+    if( s > 0 ) {
+      for( i=(n - 1); i>0; i-- ) {
+        vn[i] = ((vn[i] << s) | (vn[i-1] >> (UL_HALF_BITS - s))) & UL_HALF_MASK;
+      }
+      vn[0] = (vn[0] << s) & UL_HALF_MASK;
+      un[m] = un[m-1] >> (UL_HALF_BITS - s);
+      for( i=(m - 1); i>0; i-- ) {
+        un[i] = ((un[i] << s) | (un[i-1] >> (UL_HALF_BITS - s))) & UL_HALF_MASK;
+      }
+      un[0] = (un[0] << s) & UL_HALF_MASK;
+    }
+
+    for( j=(m - n); j>=0; j-- ) {
+
+      ulong num  = (un[j+n] << UL_HALF_BITS) | un[j+n-1];
+      ulong qhat = num / vn[n-1];
+      ulong rhat = num - (qhat * vn[n-1]);
+      long  k    = 0;
+      long  t;
+
+      /* Estimate the quotient digit, correcting it if it is too large */
+      while( (qhat > UL_HALF_MASK) || ((qhat * vn[n-2]) > ((rhat << UL_HALF_BITS) | un[j+n-2])) ) {
+        qhat--;
+        rhat += vn[n-1];
+        if( rhat > UL_HALF_MASK ) {
+          break;
+        }
+      }
+
+      /* Multiply and subtract */
+      for( i=0; i<n; i++ ) {
+        ulong p = qhat * vn[i];
+        t       = (long)un[i+j] - k - (long)(p & UL_HALF_MASK);
+        un[i+j] = (ulong)t & UL_HALF_MASK;
+        k       = (long)(p >> UL_HALF_BITS) - (t >> UL_HALF_BITS);
+      }
+      t       = (long)un[j+n] - k;
+      un[j+n] = (ulong)t & UL_HALF_MASK;
+      qn[j]   = qhat;
+
+      /* If we subtracted too much, add the divisor back */
+      if( t < 0 ) {
+        qn[j]--;
+        k = 0;
+        for( i=0; i<n; i++ ) {
+          t       = (long)un[i+j] + (long)vn[i] + k;
+          un[i+j] = (ulong)t & UL_HALF_MASK;
+          k       = t >> UL_HALF_BITS;
+        }
+        un[j+n] = (un[j+n] + k) & UL_HALF_MASK;
+      }
+
+    }
+
+    /* Unnormalize the remainder */
+    memset( r, 0, (sizeof( ulong ) * size) );
+    for( i=0; i<n; i++ ) {
+      ulong d = (s == 0) ? un[i] : (((un[i] >> s) | (un[i+1] << (UL_HALF_BITS - s))) & UL_HALF_MASK);
+      r[i/2] |= d << ((i & 0x1) * UL_HALF_BITS);
+    }
+
+  }
+
+  /* Join the quotient digits back into words */
+  for( i=0; i<size; i++ ) {
+    q[i] = qn[2*i] | (qn[(2*i)+1] << UL_HALF_BITS);
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns TRUE if the assigned value differs from the original value; otherwise, returns FALSE.
+
+ Performs a multi-word division or modulus of two known vectors, storing the quotient (if
+ want_quotient is TRUE) or the remainder in the target vector.  If both operands are signed, the
+ division is performed on their magnitudes, the quotient is negative if exactly one operand is
+ negative and the remainder takes the sign of the dividend.  Division by zero results in an X value.
+*/
+static bool vector_op_divmod_ulong(
+  vector*       tgt,           /*!< Pointer to vector that will store the result */
+  const vector* left,          /*!< Pointer to dividend vector */
+  const vector* right,         /*!< Pointer to divisor vector */
+  bool          want_quotient  /*!< Set to TRUE to store the quotient; set to FALSE to store the remainder */
+) { PROFILE(VECTOR_OP_DIVMOD_ULONG);
+
+  bool         retval;
+  ulong        u[UL_DIV(MAX_BIT_WIDTH)];
+  ulong        v[UL_DIV(MAX_BIT_WIDTH)];
+  ulong        q[UL_DIV(MAX_BIT_WIDTH)];
+  ulong        r[UL_DIV(MAX_BIT_WIDTH)];
+  ulong        valh[UL_DIV(MAX_BIT_WIDTH)];
+  bool         is_signed = (left->suppl.part.is_signed == 1) && (right->suppl.part.is_signed == 1);
+  unsigned int lsize     = UL_SIZE( left->width );
+  unsigned int rsize     = UL_SIZE( right->width );
+  unsigned int tsize     = UL_SIZE( tgt->width );
+  unsigned int size      = (lsize > rsize) ? lsize : rsize;
+  bool         lneg      = FALSE;
+  bool         rneg      = FALSE;
+  unsigned int i;
+
+  size = (size > tsize) ? size : tsize;
+
+  vector_get_words_ulong( left,  u, size, is_signed );
+  vector_get_words_ulong( right, v, size, is_signed );
+
+  /* Divide the magnitudes of signed operands */
+  if( is_signed ) {
+    if( (u[size-1] >> (UL_BITS - 1)) == 1 ) {
+      vector_negate_words_ulong( u, size );
+      lneg = TRUE;
+    }
+    if( (v[size-1] >> (UL_BITS - 1)) == 1 ) {
+      vector_negate_words_ulong( v, size );
+      rneg = TRUE;
+    }
+  }
+
+  for( i=0; (i<size) && (v[i] == 0); i++ );
+
+  if( i == size ) {
+
+    retval = vector_set_to_x( tgt );
+
+  } else {
+
+    vector_divmod_ulong( q, r, u, v, size );
+
+    if( want_quotient ) {
+      if( lneg != rneg ) {
+        vector_negate_words_ulong( q, size );
+      }
+    } else {
+      if( lneg ) {
+        vector_negate_words_ulong( r, size );
+      }
+    }
+
+    memset( valh, 0, (sizeof( ulong ) * tsize) );
+    retval = vector_set_coverage_and_assign_ulong( tgt, (want_quotient ? q : r), valh, 0, (tgt->width - 1) );
+
+  }
+
+  PROFILE_END;
+
+  return( retval );
+
+}
+
 /*!
  \return Returns TRUE if assigned value differs from original value; otherwise, returns FALSE.
 
- Performs 4-state conversion multiplication.  If both values
- are known (non-X, non-Z), vectors are converted to integers, multiplication
- occurs and values are converted back into vectors.  If one of the values
- is equal to zero, the value is 0.  If one of the values is equal to one,
- the value is that of the other vector.
+ Performs 4-state multiplication.  If either value contains an X or Z, the result is X.  Otherwise
+ the operands are extended to the width of the target (sign extended if both are signed) and
+ multiplied, keeping the lower bits of the product that fit in the target.  Products wider than a
+ machine word use the schoolbook algorithm, switching to Karatsuba for very wide operands.
 */
 bool vector_op_multiply(
   vector*       tgt,   /*!< Target vector for storage of results */
@@ -4634,7 +6143,8 @@ bool vector_op_multiply(
   const vector* right  /*!< Expression value on right side of * sign */
 ) { PROFILE(VECTOR_OP_MULTIPLY);
 
-  bool retval;  /* Return value for this function */
+  bool retval;                                                                                  /* Return value for this function */
+  bool is_signed = (left->suppl.part.is_signed == 1) && (right->suppl.part.is_signed == 1);  /* Set to TRUE if operands are sign extended */
 
   if( vector_is_unknown( left ) || vector_is_unknown( right ) ) {
 
@@ -4645,9 +6155,26 @@ bool vector_op_multiply(
     switch( tgt->suppl.part.data_type ) {
       case VDATA_UL :
         {
-          ulong vall = left->value.ul[0][VTYPE_INDEX_VAL_VALL] * right->value.ul[0][VTYPE_INDEX_VAL_VALL];
-          ulong valh = 0;
-          retval = vector_set_coverage_and_assign_ulong( tgt, &vall, &valh, 0, (tgt->width - 1) );
+          if( tgt->width <= UL_BITS ) {
+            ulong lval, rval;
+            ulong vall;
+            ulong valh = 0;
+            vector_get_words_ulong( left,  &lval, 1, is_signed );
+            vector_get_words_ulong( right, &rval, 1, is_signed );
+            vall   = lval * rval;
+            retval = vector_set_coverage_and_assign_ulong( tgt, &vall, &valh, 0, (tgt->width - 1) );
+          } else {
+            ulong        lval[UL_DIV(MAX_BIT_WIDTH)];
+            ulong        rval[UL_DIV(MAX_BIT_WIDTH)];
+            ulong        vall[UL_DIV(MAX_BIT_WIDTH)];
+            ulong        valh[UL_DIV(MAX_BIT_WIDTH)];
+            unsigned int size = UL_SIZE( tgt->width );
+            vector_get_words_ulong( left,  lval, size, is_signed );
+            vector_get_words_ulong( right, rval, size, is_signed );
+            vector_mul_ulong( vall, lval, rval, size );
+            memset( valh, 0, (sizeof( ulong ) * size) );
+            retval = vector_set_coverage_and_assign_ulong( tgt, vall, valh, 0, (tgt->width - 1) );
+          }
         }
         break;
       case VDATA_R64 :
@@ -4678,7 +6205,8 @@ bool vector_op_multiply(
 /*!
  \return Returns TRUE if value changes; otherwise, returns FALSE.
 
- Performs vector divide operation.
+ Performs vector divide operation.  Multi-word values are divided with vector_divmod_ulong.  Division
+ by zero results in an X value.
 */
 bool vector_op_divide(
   vector*       tgt,   /*!< Pointer to vector that will store divide result */
@@ -4696,17 +6224,7 @@ bool vector_op_divide(
 
     switch( tgt->suppl.part.data_type ) {
       case VDATA_UL :
-        {
-          ulong vall;
-          ulong valh = 0;
-          ulong rval = right->value.ul[0][VTYPE_INDEX_EXP_VALL];
-          if( rval == 0 ) {
-            retval = vector_set_to_x( tgt );
-          } else {
-            vall = left->value.ul[0][VTYPE_INDEX_EXP_VALL] / rval;
-            retval = vector_set_coverage_and_assign_ulong( tgt, &vall, &valh, 0, (UL_BITS - 1) );
-          }
-        }
+        retval = vector_op_divmod_ulong( tgt, left, right, TRUE );
         break;
       case VDATA_R64 :
         {
@@ -4736,7 +6254,8 @@ bool vector_op_divide(
 /*!
  \return Returns TRUE if value changes; otherwise, returns FALSE.
 
- Performs vector modulus operation.
+ Performs vector modulus operation.  Multi-word values are divided with vector_divmod_ulong.  A modulus
+ by zero results in an X value.
 */
 bool vector_op_modulus(
   vector*       tgt,   /*!< Pointer to vector that will store divide result */
@@ -4746,6 +6265,43 @@ bool vector_op_modulus(
 
   bool retval;  /* Return value for this function */
 
+  if( vector_is_unknown( left ) || vector_is_unknown( right ) ) {
+
+    retval = vector_set_to_x( tgt );
+
+  } else {
+
+    switch( tgt->suppl.part.data_type ) {
+      case VDATA_UL :
+        retval = vector_op_divmod_ulong( tgt, left, right, FALSE );
+        break;
+      default :  assert( 0 );  break;
+    }
+
+  }
+
+  PROFILE_END;
+
+  return( retval );
+
+}
+
+/*!
+ \return Returns TRUE if value changes; otherwise, returns FALSE.
+
+ Performs vector exponent (power) operation by repeated squaring, keeping the lower bits of each
+ product that fit in the target.  If either value contains an X or Z, the result is X.  A negative
+ exponent (right is signed with its MSB set) results in X for a zero base, 1 for a base of 1, 1 or -1
+ for a signed base of -1 (depending on whether the exponent is even or odd) and 0 otherwise.
+*/
+bool vector_op_exponent(
+  vector*       tgt,   /*!< Pointer to vector that will store the exponent result */
+  const vector* left,  /*!< Pointer to base vector */
+  const vector* right  /*!< Pointer to exponent vector */
+) { PROFILE(VECTOR_OP_EXPONENT);
+
+  bool retval;  /* Return value for this function */
+
   if( vector_is_unknown( left ) || vector_is_unknown( right ) ) {
 
     retval = vector_set_to_x( tgt );
@@ -4755,17 +6311,73 @@ bool vector_op_modulus(
     switch( tgt->suppl.part.data_type ) {
       case VDATA_UL :
         {
-          ulong vall;
-          ulong valh = 0;
-          ulong rval = right->value.ul[0][VTYPE_INDEX_EXP_VALL];
-          if( rval == 0 ) {
+          ulong        base[UL_DIV(MAX_BIT_WIDTH)];
+          ulong        vall[UL_DIV(MAX_BIT_WIDTH)];
+          ulong        valh[UL_DIV(MAX_BIT_WIDTH)];
+          ulong        tmp[UL_DIV(MAX_BIT_WIDTH)];
+          const ulong* exp   = VEC_PLANE( right, VTYPE_INDEX_VAL_VALL );
+          unsigned int size  = UL_SIZE( tgt->width );
+          int          ebit  = right->width - 1;
+          bool         neg   = (right->suppl.part.is_signed == 1) && (((exp[UL_DIV(ebit)] >> UL_MOD(ebit)) & 0x1) == 1);
+          bool         is_zero = TRUE;
+          unsigned int i;
+
+          vector_get_words_ulong( left, base, size, TRUE );
+          memset( vall, 0, (sizeof( ulong ) * size) );
+          memset( valh, 0, (sizeof( ulong ) * size) );
+
+          if( neg ) {
+
+            bool is_one  = (left->width == 1) ? (left->suppl.part.is_signed == 0) : TRUE;
+            bool is_mone = (left->suppl.part.is_signed == 1);
+            for( i=0; i<size; i++ ) {
+              is_zero &= (base[i] == 0);
+              is_one  &= (base[i] == ((i == 0) ? 1 : 0));
+              is_mone &= (base[i] == UL_SET);
+            }
+            if( is_one || (is_mone && ((exp[0] & 0x1) == 0)) ) {
+              vall[0] = 1;
+            } else if( is_mone ) {
+              memset( vall, 0xff, (sizeof( ulong ) * size) );
+            }
+
+          } else {
+
+            /* Square-and-multiply from the most-significant exponent bit down */
+            vall[0] = 1;
+            for( ; (ebit >= 0) && (((exp[UL_DIV(ebit)] >> UL_MOD(ebit)) & 0x1) == 0); ebit-- );
+            for( ; ebit >= 0; ebit-- ) {
+              vector_mul_ulong( tmp, vall, vall, size );
+              if( ((exp[UL_DIV(ebit)] >> UL_MOD(ebit)) & 0x1) == 1 ) {
+                vector_mul_ulong( vall, tmp, base, size );
+              } else {
+                memcpy( vall, tmp, (sizeof( ulong ) * size) );
+              }
+            }
+
+          }
+
+          if( neg && is_zero ) {
             retval = vector_set_to_x( tgt );
           } else {
-            vall = left->value.ul[0][VTYPE_INDEX_EXP_VALL] % rval;
-            retval = vector_set_coverage_and_assign_ulong( tgt, &vall, &valh, 0, (UL_BITS - 1) );
+            retval = vector_set_coverage_and_assign_ulong( tgt, vall, valh, 0, (tgt->width - 1) );
           }
         }
         break;
+      case VDATA_R64 :
+        {
+          double result       = pow( vector_to_real64( left ), vector_to_real64( right ) );
+          retval              = !DEQ( tgt->value.r64->val, result );
+          tgt->value.r64->val = result;
+        }
+        break;
+      case VDATA_R32 :
+        {
+          float result        = (float)pow( vector_to_real64( left ), vector_to_real64( right ) );
+          retval              = !FEQ( tgt->value.r32->val, result );
+          tgt->value.r32->val = result;
+        }
+        break;
       default :  assert( 0 );  break;
     }
 
@@ -4793,7 +6405,7 @@ bool vector_op_inc(
         vector* tmp1 = &(tvb->vec[tvb->index++]);
         vector* tmp2 = &(tvb->vec[tvb->index++]);
         vector_copy( tgt, tmp1 );
-        tmp2->value.ul[0][VTYPE_INDEX_VAL_VALL] = 1;
+        VEC_PLANE( tmp2, VTYPE_INDEX_VAL_VALL )[0] = 1;
         (void)vector_op_add( tgt, tmp1, tmp2 );
       }
       break;
@@ -4828,7 +6440,7 @@ bool vector_op_dec(
         vector* tmp1 = &(tvb->vec[tvb->index++]);
         vector* tmp2 = &(tvb->vec[tvb->index++]);
         vector_copy( tgt, tmp1 );
-        tmp2->value.ul[0][VTYPE_INDEX_VAL_VALL] = 1;
+        VEC_PLANE( tmp2, VTYPE_INDEX_VAL_VALL )[0] = 1;
         (void)vector_op_subtract( tgt, tmp1, tmp2 );
       }
     case VDATA_R64 :
@@ -4869,12 +6481,12 @@ bool vector_unary_inv(
         unsigned int size = UL_SIZE( src->width );
 
         for( i=0; i<(size-1); i++ ) {
-          tvalh   = src->value.ul[i][VTYPE_INDEX_EXP_VALH];
-          vall[i] = ~tvalh & ~src->value.ul[i][VTYPE_INDEX_EXP_VALL];
+          tvalh   = VEC_PLANE( src, VTYPE_INDEX_EXP_VALH )[i];
+          vall[i] = ~tvalh & ~VEC_PLANE( src, VTYPE_INDEX_EXP_VALL )[i];
           valh[i] = tvalh;
         }
-        tvalh   = src->value.ul[i][VTYPE_INDEX_EXP_VALH];
-        vall[i] = ~tvalh & ~src->value.ul[i][VTYPE_INDEX_EXP_VALL] & mask;
+        tvalh   = VEC_PLANE( src, VTYPE_INDEX_EXP_VALH )[i];
+        vall[i] = ~tvalh & ~VEC_PLANE( src, VTYPE_INDEX_EXP_VALL )[i] & mask;
         valh[i] = tvalh & mask;
 
         retval = vector_set_coverage_and_assign_ulong( tgt, vall, valh, 0, (tgt->width - 1) );
@@ -4910,11 +6522,11 @@ bool vector_unary_and(
         ulong        vall  = 1;
         ulong        lmask = UL_HMASK(src->width - 1);
         for( i=0; i<(ssize-1); i++ ) {
-          valh |= (src->value.ul[i][VTYPE_INDEX_VAL_VALH] != 0) ? 1 : 0;
-          vall &= ~valh & ((src->value.ul[i][VTYPE_INDEX_VAL_VALL] == UL_SET) ? 1 : 0);
+          valh |= (VEC_PLANE( src, VTYPE_INDEX_VAL_VALH )[i] != 0) ? 1 : 0;
+          vall &= ~valh & ((VEC_PLANE( src, VTYPE_INDEX_VAL_VALL )[i] == UL_SET) ? 1 : 0);
         }
-        valh |= (src->value.ul[i][VTYPE_INDEX_VAL_VALH] != 0) ? 1 : 0;
-        vall &= ~valh & ((src->value.ul[i][VTYPE_INDEX_VAL_VALL] == lmask) ? 1 : 0);
+        valh |= (VEC_PLANE( src, VTYPE_INDEX_VAL_VALH )[i] != 0) ? 1 : 0;
+        vall &= ~valh & ((VEC_PLANE( src, VTYPE_INDEX_VAL_VALL )[i] == lmask) ? 1 : 0);
         retval = vector_set_coverage_and_assign_ulong( tgt, &vall, &valh, 0, 0 );
       }
       break;
@@ -4948,11 +6560,11 @@ bool vector_unary_nand(
         ulong        vall  = 0;
         ulong        lmask = UL_HMASK(src->width - 1);
         for( i=0; i<(ssize-1); i++ ) {
-          valh |= (src->value.ul[i][VTYPE_INDEX_VAL_VALH] != 0) ? 1 : 0;
-          vall |= ~valh & ((src->value.ul[i][VTYPE_INDEX_VAL_VALL] == UL_SET) ? 0 : 1);
+          valh |= (VEC_PLANE( src, VTYPE_INDEX_VAL_VALH )[i] != 0) ? 1 : 0;
+          vall |= ~valh & ((VEC_PLANE( src, VTYPE_INDEX_VAL_VALL )[i] == UL_SET) ? 0 : 1);
         }
-        valh |= (src->value.ul[i][VTYPE_INDEX_VAL_VALH] != 0) ? 1 : 0;
-        vall |= ~valh & ((src->value.ul[i][VTYPE_INDEX_VAL_VALL] == lmask) ? 0 : 1);
+        valh |= (VEC_PLANE( src, VTYPE_INDEX_VAL_VALH )[i] != 0) ? 1 : 0;
+        vall |= ~valh & ((VEC_PLANE( src, VTYPE_INDEX_VAL_VALL )[i] == lmask) ? 0 : 1);
         retval = vector_set_coverage_and_assign_ulong( tgt, &vall, &valh, 0, 0 );
       }
       break;
@@ -4985,8 +6597,8 @@ bool vector_unary_or(
         unsigned int i    = 0;
         unsigned int size = UL_SIZE( src->width );
         ulong        x    = 0;
-        while( (i < size) && ((~src->value.ul[i][VTYPE_INDEX_VAL_VALH] & src->value.ul[i][VTYPE_INDEX_VAL_VALL]) == 0) ) {
-          x |= src->value.ul[i][VTYPE_INDEX_VAL_VALH];
+        while( (i < size) && ((~VEC_PLANE( src, VTYPE_INDEX_VAL_VALH )[i] & VEC_PLANE( src, VTYPE_INDEX_VAL_VALL )[i]) == 0) ) {
+          x |= VEC_PLANE( src, VTYPE_INDEX_VAL_VALH )[i];
           i++;
         }
         if( i < size ) {
@@ -5028,8 +6640,8 @@ bool vector_unary_nor(
         unsigned int i    = 0;
         unsigned int size = UL_SIZE( src->width );
         ulong        x    = 0;
-        while( (i < size) && ((~src->value.ul[i][VTYPE_INDEX_VAL_VALH] & src->value.ul[i][VTYPE_INDEX_VAL_VALL]) == 0) ) {
-          x |= src->value.ul[i][VTYPE_INDEX_VAL_VALH];
+        while( (i < size) && ((~VEC_PLANE( src, VTYPE_INDEX_VAL_VALH )[i] & VEC_PLANE( src, VTYPE_INDEX_VAL_VALL )[i]) == 0) ) {
+          x |= VEC_PLANE( src, VTYPE_INDEX_VAL_VALH )[i];
           i++;
         }
         if( i < size ) {
@@ -5071,12 +6683,12 @@ bool vector_unary_xor(
         unsigned int i    = 0;
         unsigned int size = UL_SIZE( src->width );
         do {
-          if( src->value.ul[i][VTYPE_INDEX_VAL_VALH] != 0 ) {
+          if( VEC_PLANE( src, VTYPE_INDEX_VAL_VALH )[i] != 0 ) {
             vall = 0;
             valh = 1;
           } else {
             unsigned int j;
-            ulong        tval = src->value.ul[i][VTYPE_INDEX_VAL_VALL];
+            ulong        tval = VEC_PLANE( src, VTYPE_INDEX_VAL_VALL )[i];
             for( j=1; j<UL_BITS; j<<=1 ) {
               tval = tval ^ (tval >> j);
             }
@@ -5116,12 +6728,12 @@ bool vector_unary_nxor(
         unsigned int i    = 0;
         unsigned int size = UL_SIZE( src->width );
         do {
-          if( src->value.ul[i][VTYPE_INDEX_VAL_VALH] != 0 ) {
+          if( VEC_PLANE( src, VTYPE_INDEX_VAL_VALH )[i] != 0 ) {
             vall = 0;
             valh = 1;
           } else {
             unsigned int j;
-            ulong        tval = src->value.ul[i][VTYPE_INDEX_VAL_VALL];
+            ulong        tval = VEC_PLANE( src, VTYPE_INDEX_VAL_VALL )[i];
             for( j=1; j<UL_BITS; j<<=1 ) {
               tval = tval ^ (tval >> j);
             }
@@ -5160,10 +6772,10 @@ bool vector_unary_not(
         ulong        valh;
         unsigned int size = UL_SIZE( src->width );
         unsigned int i    = 0;
-        while( (i < size) && (src->value.ul[i][VTYPE_INDEX_VAL_VALH] == 0) && (src->value.ul[i][VTYPE_INDEX_VAL_VALL] == 0) ) i++;
+        while( (i < size) && (VEC_PLANE( src, VTYPE_INDEX_VAL_VALH )[i] == 0) && (VEC_PLANE( src, VTYPE_INDEX_VAL_VALL )[i] == 0) ) i++;
         if( i < size ) {
           vall = 0;
-          valh = (src->value.ul[i][VTYPE_INDEX_VAL_VALH] != 0);
+          valh = (VEC_PLANE( src, VTYPE_INDEX_VAL_VALH )[i] != 0);
         } else {
           vall = 1;
           valh = 0;
@@ -5202,17 +6814,18 @@ bool vector_op_expand(
         unsigned int rwidth     = right->width;
         unsigned int multiplier = vector_to_int( left );
         unsigned int pos        = 0;
+        ulong*       rvall      = VEC_PLANE( right, VTYPE_INDEX_VAL_VALL );
+        ulong*       rvalh      = VEC_PLANE( right, VTYPE_INDEX_VAL_VALH );
         for( i=0; i<multiplier; i++ ) {
           for( j=0; j<rwidth; j++ ) {
-            ulong*       rval     = right->value.ul[UL_DIV(j)];
             unsigned int my_index = UL_DIV(pos);
             unsigned int offset   = UL_MOD(pos);
             if( offset == 0 ) {
               vall[my_index] = 0;
               valh[my_index] = 0;
             }
-            vall[my_index] |= ((rval[VTYPE_INDEX_VAL_VALL] >> UL_MOD(j)) & 0x1) << offset;
-            valh[my_index] |= ((rval[VTYPE_INDEX_VAL_VALH] >> UL_MOD(j)) & 0x1) << offset;
+            vall[my_index] |= ((rvall[UL_DIV(j)] >> UL_MOD(j)) & 0x1) << offset;
+            valh[my_index] |= ((rvalh[UL_DIV(j)] >> UL_MOD(j)) & 0x1) << offset;
             pos++;
           }
         }
@@ -5253,22 +6866,20 @@ bool vector_op_list(
 
         /* Load right vector directly */
         for( i=0; i<rsize; i++ ) {
-          ulong* rval = right->value.ul[i];
-          vall[i] = rval[VTYPE_INDEX_VAL_VALL];
-          valh[i] = rval[VTYPE_INDEX_VAL_VALH];
+          vall[i] = VEC_PLANE( right, VTYPE_INDEX_VAL_VALL )[i];
+          valh[i] = VEC_PLANE( right, VTYPE_INDEX_VAL_VALH )[i];
         }
 
         /* Load left vector a bit at at time */
         for( i=0; i<lwidth; i++ ) {
-          ulong*       lval     = left->value.ul[UL_DIV(i)];
           unsigned int my_index = UL_DIV(pos);
           unsigned int offset   = UL_MOD(pos);
           if( offset == 0 ) {
             vall[my_index] = 0;
             valh[my_index] = 0;
           }
-          vall[my_index] |= ((lval[VTYPE_INDEX_EXP_VALL] >> UL_MOD(i)) & 0x1) << offset;
-          valh[my_index] |= ((lval[VTYPE_INDEX_EXP_VALH] >> UL_MOD(i)) & 0x1) << offset;
+          vall[my_index] |= ((VEC_PLANE( left, VTYPE_INDEX_EXP_VALL )[UL_DIV(i)] >> UL_MOD(i)) & 0x1) << offset;
+          valh[my_index] |= ((VEC_PLANE( left, VTYPE_INDEX_EXP_VALH )[UL_DIV(i)] >> UL_MOD(i)) & 0x1) << offset;
           pos++;
         }
         retval = vector_set_coverage_and_assign_ulong( tgt, vall, valh, 0, ((left->width + right->width) - 1) );
@@ -5309,7 +6920,7 @@ bool vector_op_clog2(
           unsigned int size     = UL_SIZE(src->width);
           unsigned int num_ones = 0;
           while( size > 0 ) {
-            ulong i = src->value.ul[--size][VTYPE_INDEX_VAL_VALL];
+            ulong i = VEC_PLANE( src, VTYPE_INDEX_VAL_VALL )[--size];
             while( i != 0 ) {
               vall++;
               num_ones += (i & 0x1);
@@ -5318,7 +6929,7 @@ bool vector_op_clog2(
             if( vall != 0 ) {
               vall += (size * UL_BITS);
               if( num_ones == 1 ) {
-                while( (size > 0) && (src->value.ul[--size][VTYPE_INDEX_VAL_VALL] == 0) );
+                while( (size > 0) && (VEC_PLANE( src, VTYPE_INDEX_VAL_VALL )[--size] == 0) );
                 if( size == 0 ) {
                   vall--;
                 }
@@ -5366,13 +6977,9 @@ void vector_dealloc_value(
   switch( vec->suppl.part.data_type ) {
     case VDATA_UL :
       if( vec->width > 0 ) {
-        unsigned int i;
-        unsigned int size = UL_SIZE( vec->width );
-
-        for( i=0; i<size; i++ ) {
-          free_safe( vec->value.ul[i], (sizeof( ulong ) * vector_type_sizes[vec->suppl.part.type]) );
+        if( vec->value.ul != vec->small ) {
+          free_safe( vec->value.ul, VECTOR_UL_ALLOC_SIZE( vector_type_sizes[vec->suppl.part.type], UL_SIZE( vec->width ) ) );
         }
-        free_safe( vec->value.ul, (sizeof( ulong* ) * size) );
         vec->value.ul = NULL;
       }
       break;
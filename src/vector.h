@@ -28,10 +28,17 @@
 #include "defines.h"
 
 
+/*! \brief Selects inline or heap storage for the value planes of the specified vector. */
+ulong* vector_alloc_ulong(
+  vector* vec,
+  int     width,
+  int     type
+);
+
 /*! \brief Initializes specified vector. */
 void vector_init_ulong(
   /*@out@*/ vector* vec,
-            ulong** value,
+            ulong*  value,
             ulong   data_l,
             ulong   data_h,
             bool    owns_value,
@@ -97,12 +104,25 @@ void vector_db_write(
   bool    net
 );
 
+/*! \brief Appends vector information to the binary CDD record being built. */
+void vector_db_write_bin(
+  vector* vec,
+  bool    write_data,
+  bool    net
+);
+
 /*! \brief Creates and parses current file line for vector information */
 void vector_db_read(
   /*@out@*/ vector** vec,
             char**   line
 );
 
+/*! \brief Creates a vector from the vector information of a binary CDD record. */
+void vector_db_read_bin(
+  /*@out@*/ vector** vec,
+            char**   line
+);
+
 /*! \brief Reads and merges two vectors, placing the result into base vector. */
 void vector_db_merge(
   vector* base,
@@ -110,6 +130,13 @@ void vector_db_merge(
   bool    same
 );
 
+/*! \brief Merges the vector information of a binary CDD record into the base vector. */
+void vector_db_merge_bin(
+  vector* base,
+  char**  line,
+  bool    same
+);
+
 /*! \brief Merges two vectors, placing the result into the base vector. */
 void vector_merge(
   vector* base,
@@ -151,40 +178,40 @@ int vector_get_eval_abcd_count( vector* vec );
 
 /*! \brief Returns string containing toggle 0 -> 1 information in binary format */
 char* vector_get_toggle01_ulong(
-  ulong** value,
+  ulong*  value,
   int     width
 );
 
 /*! \brief Returns string containing toggle 1 -> 0 information in binary format */
 char* vector_get_toggle10_ulong(
-  ulong** value,
+  ulong*  value,
   int     width
 );
 
 /*! \brief Outputs the toggle01 information from the specified nibble to the specified output stream. */
 void vector_display_toggle01_ulong(
-  ulong** value,
+  ulong*  value,
   int     width,
   FILE*   ofile
 );
 
 /*! \brief Outputs the toggle10 information from the specified nibble to the specified output stream. */
 void vector_display_toggle10_ulong(
-  ulong** value,
+  ulong*  value,
   int     width,
   FILE*   ofile
 );
 
 /*! \brief Outputs the binary value of the specified nibble array to standard output */
 void vector_display_value_ulong(
-  ulong** value,
+  ulong*  value,
   int     width
 );
 
 /*@-exportlocal@*/
 /*! \brief Outputs ulong vector to standard output. */
 void vector_display_ulong(
-  ulong**      value,
+  ulong*       value,
   unsigned int width,
   unsigned int type
 );
@@ -197,9 +224,9 @@ void vector_display(
 
 /*! \brief Sets specified vector value to new value and maintains coverage history. */
 bool vector_set_value_ulong(
-  vector*      vec,
-  ulong**      value,
-  unsigned int width
+  vector*       vec,
+  const vector* value,
+  unsigned int  width
 );
 
 /*! \brief Sets the memory read bit of the given vector. */
@@ -344,13 +371,24 @@ bool vector_vcd_assign(
   int         lsb
 );
 
-/*! \brief Assigns specified VCD value to specified vectors. */
-bool vector_vcd_assign2(
-               vector* vec1,
-               vector* vec2,
-               char*   value,
-  /*@unused@*/ int     msb,
-  /*@unused@*/ int     lsb
+/*! \brief Decodes a VCD value string into a packed 4-state value. */
+void vector_decode_vcd_value(
+  const char*  value,
+  unsigned int len,
+  ulong*       vall,
+  ulong*       valh,
+  unsigned int width
+);
+
+/*! \brief Assigns a range of a packed VCD value to specified vector. */
+bool vector_vcd_assign_packed(
+  vector*      vec,
+  const ulong* vall,
+  const ulong* valh,
+  unsigned int width,
+  unsigned int offset,
+  int          msb,
+  int          lsb
 );
 
 /*! \brief Counts toggle01 and toggle10 information from specifed vector. */
@@ -360,6 +398,13 @@ void vector_toggle_count(
   /*@out@*/ unsigned int* tog10_cnt
 );
 
+/*! \brief Sets toggle01 and toggle10 information of the specified vector from toggle bitmaps. */
+void vector_set_toggles(
+  vector* vec,
+  uint64  tog01,
+  uint64  tog10
+);
+
 /*! \brief Counts memory write and read information from specified vector. */
 void vector_mem_rw_count(
             vector*       vec,
@@ -551,6 +596,13 @@ bool vector_op_modulus(
   const vector* right
 );
 
+/*! \brief Performs exponent operation on left and right vector values. */
+bool vector_op_exponent(
+  vector*       tgt,
+  const vector* left,
+  const vector* right
+);
+
 /*! \brief Performs increment operation on specified vector. */
 bool vector_op_inc(
   vector* tgt,
@@ -33,38 +33,169 @@
 #include "binding.h"
 #include "db.h"
 #include "defines.h"
+#include "expr.h"
+#include "func_iter.h"
+#include "func_unit.h"
 #include "instance.h"
 #include "link.h"
 #include "obfuscate.h"
 #include "profiler.h"
+#include "scope.h"
 #include "symtable.h"
 #include "sys_tasks.h"
 #include "util.h"
+#include "vector.h"
 
-struct sym_value_s;
+#if defined(HAVE_PTHREAD_H) && defined(HAVE_LIBPTHREAD)
+#include <pthread.h>
+/*!
+ Defined if value changes can be handed to a Covered worker thread (see the +covered_async plusarg).
+*/
+#define VPI_WORKER_THREAD
+
+/*!
+ Reads a variable that is shared between the simulator thread and the worker thread.  All shared
+ accesses are sequentially consistent so that a thread that announces it is about to wait always sees
+ the other thread's progress (or is seen by it).
+*/
+#define VQ_LOAD(x)     __atomic_load_n( &(x), __ATOMIC_SEQ_CST )
+
+/*!
+ Writes a variable that is shared between the simulator thread and the worker thread.
+*/
+#define VQ_STORE(x,v)  __atomic_store_n( &(x), (v), __ATOMIC_SEQ_CST )
+#else
+#define VQ_LOAD(x)     (x)
+#define VQ_STORE(x,v)  ((x) = (v))
+#endif
+
+/*!
+ Maximum number of task/function call levels that are followed when deciding if a functional unit
+ can no longer gain coverage.  Deeper (or recursive) calls are treated as still able to gain coverage.
+*/
+#define VPI_SATURATE_MAX_DEPTH  8
+
+/*!
+ Default number of simulation timesteps between checks for signals whose coverage is saturated when
+ the +covered_prune plusarg is given without a value.
+*/
+#define VPI_PRUNE_INTERVAL_DEFAULT  1000
+
+struct vpi_sig_s;
+
+/*!
+ Renaming vpi_sig_s structure for convenience.
+*/
+typedef struct vpi_sig_s vpi_sig;
+
+/*!
+ Structure that is allocated once for each signal that has a value change callback and is passed to
+ that callback.  It holds the symbol table entry that receives the signal's values along with a buffer
+ that the simulator's aval/bval words are converted into, so that value changes are stored without
+ allocating memory or formatting and parsing strings.
+*/
+struct vpi_sig_s {
+  vpiHandle    obj;                  /*!< Simulator handle of signal */
+  vpiHandle    cb;                   /*!< Handle of the signal's value change callback (NULL once removed) */
+  unsigned int index;                /*!< Symbol table index of the signal's symbol */
+  symtable*    symtab;               /*!< Symbol table entry of signal (NULL if the signal does not affect coverage) */
+  unsigned int width;                /*!< Number of bits in signal */
+  bool         real;                 /*!< Set if the signal is a real variable */
+  bool         saturated;            /*!< Set once value changes of this signal can no longer affect coverage */
+  ulong*       value;                /*!< Packed value buffer (lower value words followed by upper value words) */
+  vpi_sig*     next;                 /*!< Pointer to next vpi_sig structure in list */
+};
+
+#ifdef VPI_WORKER_THREAD
+/*!
+ \addtogroup vpi_rec_types VPI record types
+
+ The following defines specify the kinds of records that the simulator thread places in the value
+ change queue for the Covered worker thread.
+
+ @{
+*/
+
+/*! Fills the rest of the queue buffer so that the next record starts at the beginning of the buffer */
+#define VPI_REC_PAD       0
+
+/*! Stores the packed 4-state value that follows the record into a symbol */
+#define VPI_REC_VALUE     1
+
+/*! Stores the real value that follows the record into a symbol */
+#define VPI_REC_REAL      2
+
+/*! Simulates the timestep at the record's time */
+#define VPI_REC_TIMESTEP  3
+
+/*! Assigns the values stored in the current timestep (read-only synch point of the simulator) */
+#define VPI_REC_ASSIGN    4
+
+/*! Stops the worker thread */
+#define VPI_REC_FINISH    5
+
+/*! @} */
+
+struct vpi_rec_s;
 
 /*!
- Renaming sym_value_s structure for convenience.
+ Renaming vpi_rec_s structure for convenience.
 */
-typedef struct sym_value_s sym_value;
+typedef struct vpi_rec_s vpi_rec;
 
 /*!
- Structure used for storing symbol and string value information.
+ Header of a record in the value change queue.  Value records are directly followed by the value words
+ of the symbol.  Every record occupies a multiple of VPI_REC_WORDS queue words so that a padding record
+ always fits at the end of the queue buffer.
 */
-struct sym_value_s {
-  char*      sym;                    /*!< Signal symbol */
-  char*      value;                  /*!< Signal value to assign */
-  sym_value* next;                   /*!< Pointer to next sym_value structure in list */
+struct vpi_rec_s {
+  uint64       time;                 /*!< Simulation time of a timestep or assign record */
+  unsigned int index;                /*!< Symbol table index of the symbol that a value record is stored to */
+  unsigned int width;                /*!< Number of bits in the value of a value record */
+  unsigned int words;                /*!< Number of queue words occupied by the record (including its value) */
+  int          type;                 /*!< Type of record (see \ref vpi_rec_types) */
 };
 
-char       in_db_name[1024];       /*!< Name of input CDD file */
-char       out_db_name[1024];      /*!< Name of output CDD file */
-uint64     last_time     = 0;      /*!< Last simulation time seen from simulator */
-sym_value* sv_head       = NULL;   /*!< Pointer to head of sym_value list */
-sym_value* sv_tail       = NULL;   /*!< Pointer to tail of sym_value list */
+/*!
+ Number of queue words needed to hold a record header.
+*/
+#define VPI_REC_WORDS            ((sizeof( vpi_rec ) + sizeof( ulong ) - 1) / sizeof( ulong ))
+
+/*!
+ Number of queue words occupied by a value record holding a value of the given width.
+*/
+#define VPI_REC_SIZE(width)      ((((2 * UL_SIZE( width )) + (2 * VPI_REC_WORDS) - 1) / VPI_REC_WORDS) * VPI_REC_WORDS)
+
+/*!
+ Default size of the value change queue (in kilobytes) when the +covered_async plusarg is given without a value.
+*/
+#define VPI_QUEUE_SIZE_DEFAULT   4096
+#endif
+
+char         in_db_name[1024];         /*!< Name of input CDD file */
+char         out_db_name[1024];        /*!< Name of output CDD file */
+uint64       last_time      = 0;       /*!< Last simulation time seen from simulator */
+vpi_sig*     vs_head        = NULL;    /*!< Pointer to head of vpi_sig list */
+vpi_sig*     vs_tail        = NULL;    /*!< Pointer to tail of vpi_sig list */
+unsigned int prune_interval = 0;       /*!< Number of timesteps between checks for saturated signals (0 disables pruning) */
+unsigned int prune_count    = 0;       /*!< Number of timesteps simulated since the last check for saturated signals */
+#ifdef VPI_WORKER_THREAD
+unsigned int    queue_kb            = 0;      /*!< Requested size of the value change queue in kilobytes (0 runs Covered in the simulator's thread) */
+ulong*          vq_buf              = NULL;   /*!< Value change queue buffer (NULL if the worker thread is not running) */
+ulong           vq_size             = 0;      /*!< Number of words in the value change queue buffer */
+ulong           vq_head             = 0;      /*!< Queue word index of the next record to write (only written by the simulator thread) */
+ulong           vq_tail             = 0;      /*!< Queue word index of the next record to read (only written by the worker thread) */
+bool            vq_producer_waiting = FALSE;  /*!< Set while the simulator thread waits for space in a full queue */
+bool            vq_consumer_waiting = FALSE;  /*!< Set while the worker thread waits for records in an empty queue */
+bool            vq_stop             = FALSE;  /*!< Set by the worker thread when Covered's simulation asks to finish */
+bool            prune_ready         = FALSE;  /*!< Set by the worker thread when saturated signals have been marked */
+pthread_mutex_t vq_mutex;                     /*!< Mutex used when a thread needs to wait on the queue */
+pthread_cond_t  vq_not_empty;                 /*!< Signaled when records are added to an empty queue */
+pthread_cond_t  vq_not_full;                  /*!< Signaled when records are removed from a full queue */
+pthread_t       vq_thread;                    /*!< Covered worker thread */
+#endif
 
 extern bool        debug_mode;
-extern symtable*   vcd_symtab;
 extern int         vcd_symtab_size;
 extern symtable**  timestep_tab;
 extern char**      curr_inst_scope;
@@ -72,6 +203,7 @@ extern int         curr_inst_scope_size;
 extern funit_inst* curr_instance;
 extern char        user_msg[USER_MSG_LENGTH];
 extern isuppl      info_suppl;
+extern const exp_info exp_op_info[EXP_OP_NUM];
 
 
 /*!
@@ -85,63 +217,275 @@ void vpi_print_output( const char* msg ) {
 
 }
 
+#ifdef VPI_WORKER_THREAD
+/*!
+ \return Returns the number of words that can be written to the value change queue.
+
+ One record header worth of words is always left unused so that a full queue can be told apart from an
+ empty one.
+*/
+static ulong covered_queue_free() { PROFILE(COVERED_QUEUE_FREE);
+
+  ulong used = ((vq_head + vq_size) - VQ_LOAD( vq_tail )) % vq_size;
+
+  PROFILE_END;
+
+  return( vq_size - used - VPI_REC_WORDS );
+
+}
+
+/*!
+ Blocks the simulator thread until the given number of words can be written to the value change queue.
+ This is the queue's backpressure; it is only taken when the worker thread falls behind the simulator.
+*/
+static void covered_queue_wait_space(
+  ulong words  /*!< Number of words needed */
+) { PROFILE(COVERED_QUEUE_WAIT_SPACE);
+
+  if( covered_queue_free() < words ) {
+    pthread_mutex_lock( &vq_mutex );
+    VQ_STORE( vq_producer_waiting, TRUE );
+    while( covered_queue_free() < words ) {
+      pthread_cond_wait( &vq_not_full, &vq_mutex );
+    }
+    VQ_STORE( vq_producer_waiting, FALSE );
+    pthread_mutex_unlock( &vq_mutex );
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ Publishes the given number of words that were written at the head of the value change queue to the
+ worker thread, waking it up if it is waiting for records.
+*/
+static void covered_queue_commit(
+  ulong words  /*!< Number of words to publish */
+) { PROFILE(COVERED_QUEUE_COMMIT);
+
+  /* Storing the new head index makes the record contents visible to the worker thread */
+  VQ_STORE( vq_head, ((vq_head + words) % vq_size) );
+
+  if( VQ_LOAD( vq_consumer_waiting ) ) {
+    pthread_mutex_lock( &vq_mutex );
+    pthread_cond_signal( &vq_not_empty );
+    pthread_mutex_unlock( &vq_mutex );
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns a pointer to the queue words that the next record of the given size is written to.
+
+ If the record does not fit before the end of the queue buffer, the remainder of the buffer is filled
+ with a padding record and the record is written to the beginning of the buffer.
+*/
+static ulong* covered_queue_reserve(
+  ulong words  /*!< Number of words in the record (a multiple of VPI_REC_WORDS) */
+) { PROFILE(COVERED_QUEUE_RESERVE);
+
+  if( (vq_head + words) > vq_size ) {
+    vpi_rec pad;
+    pad.type  = VPI_REC_PAD;
+    pad.words = (unsigned int)(vq_size - vq_head);
+    covered_queue_wait_space( pad.words );
+    memcpy( (vq_buf + vq_head), &pad, sizeof( vpi_rec ) );
+    covered_queue_commit( pad.words );
+  }
+
+  covered_queue_wait_space( words );
+
+  PROFILE_END;
+
+  return( vq_buf + vq_head );
+
+}
+
+/*!
+ Adds a timestep, assign or finish record for the given simulation time to the value change queue.
+*/
+static void covered_queue_push(
+  int    type,  /*!< Type of record to add */
+  uint64 time   /*!< Simulation time of record */
+) { PROFILE(COVERED_QUEUE_PUSH);
+
+  vpi_rec rec;
+
+  rec.time  = time;
+  rec.index = 0;
+  rec.width = 0;
+  rec.words = VPI_REC_WORDS;
+  rec.type  = type;
+
+  memcpy( covered_queue_reserve( rec.words ), &rec, sizeof( vpi_rec ) );
+  covered_queue_commit( rec.words );
+
+  PROFILE_END;
+
+}
+#endif
+
+/*!
+ Converts the given simulator vector value (aval/bval pairs of 32 bits each) into a packed value of
+ the given width.  The aval/bval encoding of a bit (0=00, 1=10, z=01, x=11) maps to Covered's lower/upper
+ value encoding (0=00, 1=10, x=01, z=11) by taking the upper value from bval and the lower value from
+ aval XOR bval.
+*/
+static void covered_convert_vecval(
+  const s_vpi_vecval* vec,    /*!< Vector value from the simulator */
+  unsigned int        width,  /*!< Number of bits in vector value */
+  ulong*              vall,   /*!< Lower value words to fill (UL_SIZE(width) words) */
+  ulong*              valh    /*!< Upper value words to fill (UL_SIZE(width) words) */
+) { PROFILE(COVERED_CONVERT_VECVAL);
+
+  unsigned int size = UL_SIZE( width );
+  unsigned int i;
+
+  for( i=0; i<size; i++ ) {
+    vall[i] = 0;
+    valh[i] = 0;
+  }
+
+  for( i=0; i<width; i+=32 ) {
+    ulong aval = (ulong)(uint32)vec[i>>5].aval;
+    ulong bval = (ulong)(uint32)vec[i>>5].bval;
+    ulong mask = ((width - i) < 32) ? (((ulong)1 << (width - i)) - 1) : (ulong)0xffffffff;
+    vall[UL_DIV(i)] |= ((aval ^ bval) & mask) << UL_MOD(i);
+    valh[UL_DIV(i)] |= (bval & mask) << UL_MOD(i);
+  }
+
+  PROFILE_END;
+
+}
+
 /*!
- Stores the given signal symbol and initial value in the sym_value list that
- will be assigned to the simulator once the timestep table has been allocated.
+ Stores the given simulator vector value into the symbol table entry of the given signal.  When the
+ worker thread is running, the converted value is placed in the value change queue instead.
 */
-void sym_value_store(
-  char* sym,   /*!< Symbol string of signal to store */
-  char* value  /*!< Initial signal value to store */
-) { PROFILE(SYM_VALUE_STORE);
+static void covered_store_vecval(
+  vpi_sig*            vsig,  /*!< Pointer to signal to store value for */
+  const s_vpi_vecval* vec    /*!< Vector value from the simulator */
+) { PROFILE(COVERED_STORE_VECVAL);
+
+  unsigned int size = UL_SIZE( vsig->width );
+
+#ifdef VPI_WORKER_THREAD
+  if( vq_buf != NULL ) {
+    vpi_rec rec;
+    ulong*  slot;
+    rec.time  = 0;
+    rec.index = vsig->index;
+    rec.width = vsig->width;
+    rec.words = VPI_REC_SIZE( vsig->width );
+    rec.type  = VPI_REC_VALUE;
+    slot      = covered_queue_reserve( rec.words );
+    memcpy( slot, &rec, sizeof( vpi_rec ) );
+    covered_convert_vecval( vec, vsig->width, (slot + VPI_REC_WORDS), (slot + VPI_REC_WORDS + size) );
+    covered_queue_commit( rec.words );
+  } else {
+    covered_convert_vecval( vec, vsig->width, vsig->value, (vsig->value + size) );
+    symtable_set_value_ulong( vsig->symtab, vsig->value, (vsig->value + size), vsig->width );
+  }
+#else
+  covered_convert_vecval( vec, vsig->width, vsig->value, (vsig->value + size) );
+  symtable_set_value_ulong( vsig->symtab, vsig->value, (vsig->value + size), vsig->width );
+#endif
 
-  sym_value* sval;  /* Pointer to newly allocated sym_value structure */
+  PROFILE_END;
 
-  /* Allocate and initialize the sym_value structure */
-  sval = (sym_value*)malloc_safe( sizeof( sym_value ) );
-  sval->sym   = strdup_safe( sym );
-  sval->value = strdup_safe( value );
-  sval->next  = NULL; 
+}
 
-  /* Add the newly created sym_value structure to the sv list */
-  if( sv_head == NULL ) {
-    sv_head = sv_tail = sval;
+/*!
+ Stores the given simulator real value into the symbol table entry of the given signal.  When the
+ worker thread is running, the value is placed in the value change queue instead.
+*/
+static void covered_store_real(
+  vpi_sig* vsig,  /*!< Pointer to signal to store value for */
+  double   real   /*!< Real value from the simulator */
+) { PROFILE(COVERED_STORE_REAL);
+
+#ifdef VPI_WORKER_THREAD
+  if( vq_buf != NULL ) {
+    vpi_rec rec;
+    ulong*  slot;
+    rec.time  = 0;
+    rec.index = vsig->index;
+    rec.width = vsig->width;
+    rec.words = VPI_REC_SIZE( vsig->width );
+    rec.type  = VPI_REC_REAL;
+    slot      = covered_queue_reserve( rec.words );
+    memcpy( slot, &rec, sizeof( vpi_rec ) );
+    memcpy( (slot + VPI_REC_WORDS), &real, sizeof( double ) );
+    covered_queue_commit( rec.words );
   } else {
-    sv_tail->next = sval;
-    sv_tail       = sval;
+    symtable_set_value_real( vsig->symtab, real );
   }
+#else
+  symtable_set_value_real( vsig->symtab, real );
+#endif
 
   PROFILE_END;
 
 }
 
 /*!
- Iterates through the sym_value list, adding the information to Covered's simulation
- core and deallocating its memory.  Called by the covered_sim_calltf function.
+ Resolves the symbol table entry of each monitored signal, now that all of their symbols have been
+ added, and stores the initial value of the signal into it.  Called by the covered_sim_calltf function
+ once the timestep table has been allocated.
 */
 void add_sym_values_to_sim() { PROFILE(ADD_SYM_VALUES_TO_SIM);
 
-  sym_value* sval;  /* Pointer to current sym_value structure */
+  vpi_sig* vsig;  /* Pointer to current vpi_sig structure */
+
+  for( vsig = vs_head; vsig != NULL; vsig = vsig->next ) {
 
-  sval = sv_head;
-  while( sv_head != NULL ) {
+    s_vpi_value value;
 
-    /* Assign the current sv_head to the sval pointer */
-    sval    = sv_head;
-    sv_head = sv_head->next;
+    /* Signals whose symbols were not bound to anything in the design are ignored */
+    if( (vsig->symtab = symtable_get_index( vsig->index )) != NULL ) {
 
-    /* Set the given symbol to the given value in Covered's simulator */
-    db_set_symbol_string( sval->sym, sval->value );
+      /* Get initial value of this signal and store it */
+      if( vsig->real ) {
+        value.format = vpiRealVal;
+        vpi_get_value( vsig->obj, &value );
+        covered_store_real( vsig, value.value.real );
+      } else {
+        vsig->value  = (ulong*)malloc_safe( sizeof( ulong ) * 2 * UL_SIZE( vsig->width ) );
+        value.format = vpiVectorVal;
+        vpi_get_value( vsig->obj, &value );
+        covered_store_vecval( vsig, value.value.vector );
+      }
+
+    }
 
-    /* Deallocate all memory associated with this sym_table structure */
-    free_safe( sval->sym, (strlen( sval->sym ) + 1) );
-    free_safe( sval->value, (strlen( sval->value ) + 1) );
-    free_safe( sval, sizeof( sym_value ) );
   }
 
   PROFILE_END;
 
 }
 
+/*!
+ Deallocates the list of monitored signals.
+*/
+static void covered_dealloc_sigs() { PROFILE(COVERED_DEALLOC_SIGS);
+
+  while( vs_head != NULL ) {
+    vpi_sig* vsig = vs_head;
+    vs_head = vs_head->next;
+    if( vsig->value != NULL ) {
+      free_safe( vsig->value, (sizeof( ulong ) * 2 * UL_SIZE( vsig->width )) );
+    }
+    free_safe( vsig, sizeof( vpi_sig ) );
+  }
+  vs_tail = NULL;
+
+  PROFILE_END;
+
+}
+
 /*!
  \return Returns 0.
  
@@ -163,6 +507,13 @@ PLI_INT32 covered_rosynch(
   }
 #endif
 
+#ifdef VPI_WORKER_THREAD
+  /* Let the worker thread perform the assignments once it has caught up with this point */
+  if( vq_buf != NULL ) {
+    covered_queue_push( VPI_REC_ASSIGN, last_time );
+  } else {
+#endif
+
   /* Perform the current timestep with the blocking assignments */
   curr_time.lo    = (last_time & 0xffffffffLL);
   curr_time.hi    = ((last_time >> 32) & 0xffffffffLL);
@@ -172,6 +523,10 @@ PLI_INT32 covered_rosynch(
   /* Assign all stored values in current post-timestep to stored signals */
   symtable_assign( &curr_time );
 
+#ifdef VPI_WORKER_THREAD
+  }
+#endif
+
   PROFILE_END;
   
   return( 0 );
@@ -179,34 +534,464 @@ PLI_INT32 covered_rosynch(
 }
 
 /*!
- \return Returns 0.
+ \return Returns TRUE if the toggle and memory coverage of the given signal can no longer change.
+*/
+static bool covered_is_sig_saturated(
+  vsignal* sig  /*!< Pointer to signal to check */
+) { PROFILE(COVERED_IS_SIG_SATURATED);
+
+  bool saturated = TRUE;
+
+  if( sig->suppl.part.excluded == 0 ) {
+
+    if( sig->suppl.part.type == SSUPPL_TYPE_MEM ) {
+      saturated = (info_suppl.part.scored_memory == 0);
+    } else if( (info_suppl.part.scored_toggle == 1)                 &&
+               (sig->suppl.part.type != SSUPPL_TYPE_PARAM)          &&
+               (sig->suppl.part.type != SSUPPL_TYPE_PARAM_REAL)     &&
+               (sig->suppl.part.type != SSUPPL_TYPE_ENUM)           &&
+               (sig->suppl.part.type != SSUPPL_TYPE_DECL_REAL)      &&
+               (sig->suppl.part.type != SSUPPL_TYPE_DECL_SREAL)     &&
+               (sig->suppl.part.type != SSUPPL_TYPE_IMPLICIT_REAL)  &&
+               (sig->suppl.part.type != SSUPPL_TYPE_IMPLICIT_SREAL) &&
+               (sig->suppl.part.mba == 0) ) {
+      unsigned int hit01 = 0;
+      unsigned int hit10 = 0;
+      vector_toggle_count( sig->value, &hit01, &hit10 );
+      saturated = (hit01 == sig->value->width) && (hit10 == sig->value->width);
+    }
 
- This callback function is called whenever a signal changes within the simulator.  It places
- this value in the Covered symtable and calls the db_do_timestep if this value change occurred
- on a new timestep.
+  }
+
+  PROFILE_END;
+
+  return( saturated );
+
+}
+
+static bool covered_is_funit_saturated( func_unit* funit, unsigned int depth );
+
+/*!
+ \return Returns TRUE if none of the combinational logic or event coverage points in the given expression
+         tree (or in any task/function that it calls) can change.
+
+ Both the per-expression and the bitwise combinations are checked so that the result holds regardless of
+ the options that the coverage is later reported with.
 */
-PLI_INT32 covered_value_change_bin(
-  p_cb_data cb  /*!< Pointer to callback data structure from vpi_user.h */
-) { PROFILE(COVERED_VALUE_CHANGE_BIN);
+static bool covered_is_expr_saturated(
+  expression*  exp,    /*!< Pointer to root of expression tree to check */
+  unsigned int depth   /*!< Current task/function call depth */
+) { PROFILE(COVERED_IS_EXPR_SATURATED);
 
-#ifndef NOIV
-  s_vpi_value value;
+  bool saturated = TRUE;
 
-  /* Setup value */
-  value.format = vpiBinStrVal;
-  vpi_get_value( cb->obj, &value );
+  if( (exp != NULL) && (ESUPPL_EXCLUDED( exp->suppl ) == 0) ) {
+
+    /* Called tasks/functions must not be able to gain coverage either */
+    if( (ESUPPL_TYPE( exp->suppl ) == ETYPE_FUNIT) && (exp->elem.funit != NULL) ) {
+      saturated = covered_is_funit_saturated( exp->elem.funit, (depth + 1) );
+    }
+
+    if( saturated && (EXPR_IS_MEASURABLE( exp ) == 1) && !expression_is_static_only( exp ) ) {
+      if( EXPR_IS_COMB( exp ) == 1 ) {
+        if( info_suppl.part.scored_comb == 1 ) {
+          if( exp_op_info[exp->op].suppl.is_comb == AND_COMB ) {
+            saturated = (exp->suppl.part.eval_01 + exp->suppl.part.eval_10 + exp->suppl.part.eval_11) == 3;
+            saturated = saturated && (vector_get_eval_abc_count( exp->value ) == (3 * exp->value->width));
+          } else if( exp_op_info[exp->op].suppl.is_comb == OR_COMB ) {
+            saturated = (exp->suppl.part.eval_10 + exp->suppl.part.eval_01 + exp->suppl.part.eval_00) == 3;
+            saturated = saturated && (vector_get_eval_abc_count( exp->value ) == (3 * exp->value->width));
+          } else {
+            saturated = (exp->suppl.part.eval_00 + exp->suppl.part.eval_01 + exp->suppl.part.eval_10 + exp->suppl.part.eval_11) == 4;
+            saturated = saturated && (vector_get_eval_abcd_count( exp->value ) == (4 * exp->value->width));
+          }
+        }
+      } else if( EXPR_IS_EVENT( exp ) == 1 ) {
+        saturated = (info_suppl.part.scored_events == 0) || (ESUPPL_WAS_TRUE( exp->suppl ) == 1);
+      } else if( (info_suppl.part.scored_comb == 1) && ((exp->op != EXP_OP_EXPAND) || (exp->value->width > 0)) ) {
+        saturated = (ESUPPL_WAS_TRUE( exp->suppl ) == 1) && (ESUPPL_WAS_FALSE( exp->suppl ) == 1) &&
+                    (vector_get_eval_ab_count( exp->value ) == (2 * exp->value->width));
+      }
+    }
+
+    saturated = saturated && covered_is_expr_saturated( exp->left, depth ) && covered_is_expr_saturated( exp->right, depth );
+
+  }
+
+  PROFILE_END;
+
+  return( saturated );
+
+}
+
+/*!
+ \return Returns TRUE if no coverage point within the given functional unit (including its unnamed
+         scopes and the tasks/functions that it calls) can change anymore.
+
+ Blocking assignments are simulated by Covered itself, so a functional unit whose blocking-assigned
+ signals are read outside of it is never considered saturated.
+*/
+static bool covered_is_funit_saturated(
+  func_unit*   funit,  /*!< Pointer to functional unit to check */
+  unsigned int depth   /*!< Current task/function call depth */
+) { PROFILE(COVERED_IS_FUNIT_SATURATED);
+
+  bool saturated = (depth <= VPI_SATURATE_MAX_DEPTH);
+
+  /* Unnamed scopes are checked as part of the functional unit that contains them */
+  while( funit_is_unnamed( funit ) && (funit->parent != NULL) ) {
+    funit = funit->parent;
+  }
+
+  if( saturated && ((info_suppl.part.scored_fsm == 0) || (funit->fsm_size == 0)) ) {
+
+    func_iter  fi;
+    statement* stmt;
+    vsignal*   sig;
+
+    func_iter_init( &fi, funit, TRUE, TRUE, FALSE );
+
+    while( saturated && ((stmt = func_iter_get_next_statement( &fi )) != NULL) ) {
+      if( stmt->suppl.part.excluded == 0 ) {
+        /* Statements that are not counted for line coverage (see line_get_stats) only need their expressions checked */
+        saturated = (info_suppl.part.scored_line == 0) || (stmt->exp->exec_num > 0) ||
+                    (stmt->exp->op == EXP_OP_DELAY)   ||
+                    (stmt->exp->op == EXP_OP_CASE)    ||
+                    (stmt->exp->op == EXP_OP_CASEX)   ||
+                    (stmt->exp->op == EXP_OP_CASEZ)   ||
+                    (stmt->exp->op == EXP_OP_DEFAULT) ||
+                    (stmt->exp->op == EXP_OP_NB_CALL) ||
+                    (stmt->exp->op == EXP_OP_FORK)    ||
+                    (stmt->exp->op == EXP_OP_JOIN)    ||
+                    (stmt->exp->op == EXP_OP_NOOP)    ||
+                    (stmt->exp->op == EXP_OP_FOREVER) ||
+                    (stmt->exp->op == EXP_OP_RASSIGN) ||
+                    (stmt->exp->line == 0);
+        saturated = saturated && covered_is_expr_saturated( stmt->exp, depth );
+      }
+    }
+
+    while( saturated && ((sig = func_iter_get_next_signal( &fi )) != NULL) ) {
+      saturated = covered_is_sig_saturated( sig );
+      if( saturated && (sig->suppl.part.assigned == 1) ) {
+        unsigned int i;
+        for( i=0; i<sig->exp_size; i++ ) {
+          statement* rstmt = expression_get_root_statement( sig->exps[i] );
+          func_unit* rfunit;
+          if( rstmt == NULL ) {
+            saturated = FALSE;
+          } else {
+            rfunit = rstmt->funit;
+            while( funit_is_unnamed( rfunit ) && (rfunit->parent != NULL) ) {
+              rfunit = rfunit->parent;
+            }
+            saturated = saturated && (rfunit == funit);
+          }
+        }
+      }
+    }
+
+    func_iter_dealloc( &fi );
+
+  } else {
+
+    saturated = FALSE;
+
+  }
+
+  PROFILE_END;
+
+  return( saturated );
+
+}
+
+/*!
+ \return Returns TRUE if no coverage metric can change due to further value changes of the given
+         monitored signal.
+
+ This is the case when the toggle coverage of every signal bound to the signal's symbol is complete
+ and every functional unit that reads one of those signals can no longer gain coverage.  Signals that
+ drive FSMs or inlined coverage expressions are never considered saturated.
+*/
+static bool covered_is_vpi_sig_saturated(
+  vpi_sig* vsig  /*!< Pointer to monitored signal to check */
+) { PROFILE(COVERED_IS_VPI_SIG_SATURATED);
+
+  bool saturated = (vsig->symtab == NULL) || (vsig->symtab->entry_type == 1);
+
+  if( saturated && (vsig->symtab != NULL) ) {
+
+    sym_sig* curr = vsig->symtab->entry.sig;
+
+    while( saturated && (curr != NULL) ) {
+      unsigned int i;
+      saturated = covered_is_sig_saturated( curr->sig );
+      for( i=0; saturated && (i<curr->sig->exp_size); i++ ) {
+        statement* stmt = expression_get_root_statement( curr->sig->exps[i] );
+        saturated = (stmt != NULL) && covered_is_funit_saturated( stmt->funit, 0 );
+      }
+      curr = curr->next;
+    }
+
+  }
+
+  PROFILE_END;
+
+  return( saturated );
+
+}
+
+/*!
+ Marks every monitored signal whose value changes can no longer affect any coverage metric as saturated.
+ Coverage information only accumulates during a run and exclusions cannot change while simulating, so a
+ saturated signal stays saturated.  Called every prune_interval timesteps when the +covered_prune plusarg
+ is given, by whichever thread runs Covered's simulation.
+*/
+static void covered_mark_saturated_sigs() { PROFILE(COVERED_MARK_SATURATED_SIGS);
+
+  vpi_sig* vsig;
+
+  for( vsig = vs_head; vsig != NULL; vsig = vsig->next ) {
+    if( !VQ_LOAD( vsig->saturated ) && covered_is_vpi_sig_saturated( vsig ) ) {
+      VQ_STORE( vsig->saturated, TRUE );
+    }
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ Removes the value change callback of every monitored signal that has been marked as saturated so that
+ the simulator no longer calls into Covered when it changes.  A removed callback never needs to be
+ registered again.
+*/
+static void covered_remove_saturated_cbs() { PROFILE(COVERED_REMOVE_SATURATED_CBS);
+
+  vpi_sig*     vsig;
+  unsigned int removed = 0;
+
+  for( vsig = vs_head; vsig != NULL; vsig = vsig->next ) {
+    if( (vsig->cb != NULL) && VQ_LOAD( vsig->saturated ) ) {
+      vpi_remove_cb( vsig->cb );
+      vsig->cb = NULL;
+      removed++;
+    }
+  }
 
 #ifdef DEBUG_MODE
-  if( debug_mode ) {
-    unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "In covered_value_change_bin, name: %s, time: %" FMT64 "u, value: %s",
-                                obf_sig( vpi_get_str( vpiFullName, cb->obj ) ), (((uint64)cb->time->high << 32) | (uint64)cb->time->low), value.value.str );
+  if( debug_mode && (removed > 0) ) {
+    unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "Removed value change callbacks of %u saturated signals at time %" FMT64 "u", removed, last_time );
     assert( rv < USER_MSG_LENGTH );
     print_output( user_msg, DEBUG, __FILE__, __LINE__ );
   }
 #endif
 
-  if( (cb->time->low  != (PLI_INT32)(last_time & 0xffffffff)) || (cb->time->high != (PLI_INT32)((last_time >> 32) & 0xffffffff)) ) {
-    if( !db_do_timestep( last_time, FALSE ) ) {
+  PROFILE_END;
+
+}
+
+#ifdef VPI_WORKER_THREAD
+/*!
+ \return Returns NULL.
+
+ Main routine of the Covered worker thread.  Takes the records that the simulator callbacks place in the
+ value change queue, in order, and performs the symbol table assignments and timestep simulations that
+ the callbacks would otherwise perform in the simulator's thread.  Returns when a finish record is seen.
+*/
+static void* covered_worker(
+  void* arg  /*!< Not used */
+) { PROFILE(COVERED_WORKER);
+
+  bool done = FALSE;
+
+  while( !done ) {
+
+    vpi_rec rec;
+    ulong*  slot;
+
+    /* Wait for the next record */
+    if( VQ_LOAD( vq_head ) == vq_tail ) {
+      pthread_mutex_lock( &vq_mutex );
+      VQ_STORE( vq_consumer_waiting, TRUE );
+      while( VQ_LOAD( vq_head ) == vq_tail ) {
+        pthread_cond_wait( &vq_not_empty, &vq_mutex );
+      }
+      VQ_STORE( vq_consumer_waiting, FALSE );
+      pthread_mutex_unlock( &vq_mutex );
+    }
+
+    slot = vq_buf + vq_tail;
+    memcpy( &rec, slot, sizeof( vpi_rec ) );
+
+    switch( rec.type ) {
+      case VPI_REC_VALUE :
+        symtable_set_value_ulong( symtable_get_index( rec.index ), (slot + VPI_REC_WORDS), (slot + VPI_REC_WORDS + UL_SIZE( rec.width )), rec.width );
+        break;
+      case VPI_REC_REAL :
+        {
+          double real;
+          memcpy( &real, (slot + VPI_REC_WORDS), sizeof( double ) );
+          symtable_set_value_real( symtable_get_index( rec.index ), real );
+        }
+        break;
+      case VPI_REC_TIMESTEP :
+        if( !VQ_LOAD( vq_stop ) ) {
+          if( !db_do_timestep( rec.time, FALSE ) ) {
+            VQ_STORE( vq_stop, TRUE );
+          } else if( (prune_interval > 0) && (++prune_count >= prune_interval) ) {
+            covered_mark_saturated_sigs();
+            prune_count = 0;
+            VQ_STORE( prune_ready, TRUE );
+          }
+        }
+        break;
+      case VPI_REC_ASSIGN :
+        {
+          sim_time curr_time;
+          curr_time.lo    = (rec.time & 0xffffffffLL);
+          curr_time.hi    = ((rec.time >> 32) & 0xffffffffLL);
+          curr_time.full  = rec.time;
+          curr_time.final = FALSE;
+          symtable_assign( &curr_time );
+        }
+        break;
+      case VPI_REC_FINISH :
+        done = TRUE;
+        break;
+      default :
+        break;
+    }
+
+    /* Release the record's words to the simulator thread */
+    VQ_STORE( vq_tail, ((vq_tail + rec.words) % vq_size) );
+
+    if( VQ_LOAD( vq_producer_waiting ) ) {
+      pthread_mutex_lock( &vq_mutex );
+      pthread_cond_signal( &vq_not_full );
+      pthread_mutex_unlock( &vq_mutex );
+    }
+
+  }
+
+  PROFILE_END;
+
+  return( NULL );
+
+}
+
+/*!
+ Allocates the value change queue and starts the Covered worker thread.  The queue is made large enough
+ to hold several value records of the widest monitored signal.  If the thread cannot be created, Covered
+ keeps running in the simulator's thread.
+*/
+static void covered_worker_start() { PROFILE(COVERED_WORKER_START);
+
+  vpi_sig* vsig;
+  ulong    words = ((ulong)queue_kb * 1024) / sizeof( ulong );
+
+  for( vsig = vs_head; vsig != NULL; vsig = vsig->next ) {
+    if( words < (4 * VPI_REC_SIZE( vsig->width )) ) {
+      words = 4 * VPI_REC_SIZE( vsig->width );
+    }
+  }
+
+  vq_size = ((words + VPI_REC_WORDS - 1) / VPI_REC_WORDS) * VPI_REC_WORDS;
+  vq_head = 0;
+  vq_tail = 0;
+  vq_stop = FALSE;
+  vq_buf  = (ulong*)malloc_safe_nolimit( sizeof( ulong ) * vq_size );
+
+  pthread_mutex_init( &vq_mutex, NULL );
+  pthread_cond_init( &vq_not_empty, NULL );
+  pthread_cond_init( &vq_not_full, NULL );
+
+  if( pthread_create( &vq_thread, NULL, covered_worker, NULL ) != 0 ) {
+    vpi_printf( "covered VPI: Unable to create worker thread, running in the simulator thread\n" );
+    free_safe( vq_buf, (sizeof( ulong ) * vq_size) );
+    vq_buf = NULL;
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ Drains the value change queue, waits for the Covered worker thread to finish and deallocates the queue.
+ Afterwards all of Covered's state is owned by the simulator's thread again.
+*/
+static void covered_worker_stop() { PROFILE(COVERED_WORKER_STOP);
+
+  if( vq_buf != NULL ) {
+
+    covered_queue_push( VPI_REC_FINISH, last_time );
+    pthread_join( vq_thread, NULL );
+
+    pthread_cond_destroy( &vq_not_full );
+    pthread_cond_destroy( &vq_not_empty );
+    pthread_mutex_destroy( &vq_mutex );
+
+    free_safe( vq_buf, (sizeof( ulong ) * vq_size) );
+    vq_buf = NULL;
+
+  }
+
+  PROFILE_END;
+
+}
+#endif
+
+/*!
+ \return Returns TRUE if simulation should continue.
+
+ Simulates the given timestep in the simulator's thread and removes the callbacks of saturated signals
+ when it is time to check for them.
+*/
+static bool covered_do_timestep(
+  uint64 time  /*!< Simulation time of timestep to simulate */
+) { PROFILE(COVERED_DO_TIMESTEP);
+
+  bool simulate = db_do_timestep( time, FALSE );
+
+  if( simulate && (prune_interval > 0) && (++prune_count >= prune_interval) ) {
+    covered_mark_saturated_sigs();
+    covered_remove_saturated_cbs();
+    prune_count = 0;
+  }
+
+  PROFILE_END;
+
+  return( simulate );
+
+}
+
+/*!
+ Simulates the last timestep if the given value change time starts a new timestep and registers a
+ callback that will assign the values of the new timestep at the end of its time slot.  When the
+ worker thread is running, the timestep is queued for it instead and the callbacks of signals that
+ it has marked as saturated are removed.
+*/
+static void covered_check_timestep(
+  p_vpi_time time  /*!< Time of value change from the simulator */
+) { PROFILE(COVERED_CHECK_TIMESTEP);
+
+  if( (time->low  != (PLI_INT32)(last_time & 0xffffffff)) || (time->high != (PLI_INT32)((last_time >> 32) & 0xffffffff)) ) {
+    bool simulate;
+#ifdef VPI_WORKER_THREAD
+    if( vq_buf != NULL ) {
+      covered_queue_push( VPI_REC_TIMESTEP, last_time );
+      if( VQ_LOAD( prune_ready ) ) {
+        VQ_STORE( prune_ready, FALSE );
+        covered_remove_saturated_cbs();
+      }
+      simulate = !VQ_LOAD( vq_stop );
+    } else {
+      simulate = covered_do_timestep( last_time );
+    }
+#else
+    simulate = covered_do_timestep( last_time );
+#endif
+    if( !simulate ) {
       vpi_control( vpiFinish, EXIT_SUCCESS );
     } else {
       p_cb_data new_cb;
@@ -223,43 +1008,55 @@ PLI_INT32 covered_value_change_bin(
       vpi_register_cb( new_cb );
     }
   }
-  last_time = ((uint64)cb->time->high << 32) | (uint64)cb->time->low;
-  
-  /* Set symbol value */
-  db_set_symbol_string( cb->user_data, value.value.str );
+  last_time = ((uint64)time->high << 32) | (uint64)time->low;
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns 0.
+
+ This callback function is called whenever a signal changes within the simulator.  It places
+ this value in the Covered symtable and calls the db_do_timestep if this value change occurred
+ on a new timestep.
+*/
+PLI_INT32 covered_value_change_bin(
+  p_cb_data cb  /*!< Pointer to callback data structure from vpi_user.h */
+) { PROFILE(COVERED_VALUE_CHANGE_BIN);
+
+  vpi_sig* vsig = (vpi_sig*)cb->user_data;
+#ifndef NOIV
+  s_vpi_value value;
+  p_vpi_value pvalue = &value;
+
+  /* Setup value (only signals that affect coverage need their value) */
+  value.format       = vpiVectorVal;
+  value.value.vector = NULL;
+  if( vsig->symtab != NULL ) {
+    vpi_get_value( cb->obj, &value );
+  }
 #else
+  p_vpi_value pvalue = cb->value;
+#endif
+
 #ifdef DEBUG_MODE
   if( debug_mode ) {
-    unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "In covered_value_change_bin, name: %s, time: %" FMT64 "u, value: %s",
-                                obf_sig( vpi_get_str( vpiFullName, cb->obj ) ), (((uint64)cb->time->high << 32) | (uint64)cb->time->low), cb->value->value.str );
+    unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "In covered_value_change_bin, name: %s, time: %" FMT64 "u, aval: %x, bval: %x",
+                                obf_sig( vpi_get_str( vpiFullName, cb->obj ) ), (((uint64)cb->time->high << 32) | (uint64)cb->time->low),
+                                ((pvalue->value.vector != NULL) ? pvalue->value.vector[0].aval : 0),
+                                ((pvalue->value.vector != NULL) ? pvalue->value.vector[0].bval : 0) );
     assert( rv < USER_MSG_LENGTH );
     print_output( user_msg, DEBUG, __FILE__, __LINE__ );
   }
 #endif
 
-  if( (cb->time->low  != (PLI_INT32)(last_time & 0xffffffff)) || (cb->time->high != (PLI_INT32)((last_time >> 32) & 0xffffffff)) ) {
-    if( !db_do_timestep( last_time, FALSE ) ) {
-      vpi_control( vpiFinish, EXIT_SUCCESS );
-    } else {
-      p_cb_data new_cb;
-      new_cb             = (p_cb_data)malloc( sizeof( s_cb_data ) );
-      new_cb->reason     = cbReadOnlySynch;
-      new_cb->cb_rtn     = covered_rosynch;
-      new_cb->obj        = NULL;
-      new_cb->time       = (p_vpi_time)malloc( sizeof( s_vpi_time ) );
-      new_cb->time->type = vpiSimTime;
-      new_cb->time->high = 0;
-      new_cb->time->low  = 0;
-      new_cb->value      = NULL;
-      new_cb->user_data  = NULL;
-      vpi_register_cb( new_cb );
-    }
-  }
-  last_time = ((uint64)cb->time->high << 32) | (uint64)cb->time->low;
+  covered_check_timestep( cb->time );
 
   /* Set symbol value */
-  db_set_symbol_string( cb->user_data, cb->value->value.str );
-#endif
+  if( vsig->symtab != NULL ) {
+    covered_store_vecval( vsig, pvalue->value.vector );
+  }
 
   PROFILE_END;
 
@@ -278,81 +1075,33 @@ PLI_INT32 covered_value_change_real(
   p_cb_data cb  /*!< Pointer to callback data structure from vpi_user.h */
 ) { PROFILE(COVERED_VALUE_CHANGE_REAL);
 
-  char real_str[64];
-
+  vpi_sig* vsig = (vpi_sig*)cb->user_data;
 #ifndef NOIV
   s_vpi_value value;
+  p_vpi_value pvalue = &value;
 
   /* Setup value */
   value.format = vpiRealVal;
   vpi_get_value( cb->obj, &value );
-
-#ifdef DEBUG_MODE
-  if( debug_mode ) {
-    unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "In covered_value_change_real, name: %s, time: %" FMT64 "u, value: %.16f",
-                                obf_sig( vpi_get_str( vpiFullName, cb->obj ) ), (((uint64)cb->time->high << 32) | (uint64)cb->time->low), value.value.real );
-    assert( rv < USER_MSG_LENGTH );
-    print_output( user_msg, DEBUG, __FILE__, __LINE__ );
-  }
+#else
+  p_vpi_value pvalue = cb->value;
 #endif
 
-  if( (cb->time->low  != (PLI_INT32)(last_time & 0xffffffff)) || (cb->time->high != (PLI_INT32)((last_time >> 32) & 0xffffffff)) ) {
-    if( !db_do_timestep( last_time, FALSE ) ) {
-      vpi_control( vpiFinish, EXIT_SUCCESS );
-    } else {
-      p_cb_data new_cb;
-      new_cb             = (p_cb_data)malloc( sizeof( s_cb_data ) );
-      new_cb->reason     = cbReadOnlySynch;
-      new_cb->cb_rtn     = covered_rosynch;
-      new_cb->obj        = NULL;
-      new_cb->time       = (p_vpi_time)malloc( sizeof( s_vpi_time ) );
-      new_cb->time->type = vpiSimTime;
-      new_cb->time->high = 0;
-      new_cb->time->low  = 0;
-      new_cb->value      = NULL;
-      new_cb->user_data  = NULL;
-      vpi_register_cb( new_cb );
-    }
-  }
-  last_time = ((uint64)cb->time->high << 32) | (uint64)cb->time->low;
-
-  /* Set symbol value */
-  snprintf( real_str, 64, "%.16f", value.value.real );
-  db_set_symbol_string( cb->user_data, real_str );
-#else
 #ifdef DEBUG_MODE
   if( debug_mode ) {
     unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "In covered_value_change_real, name: %s, time: %" FMT64 "u, value: %.16f",
-                                obf_sig( vpi_get_str( vpiFullName, cb->obj ) ), (((uint64)cb->time->high << 32) | (uint64)cb->time->low), cb->value->value.real );
+                                obf_sig( vpi_get_str( vpiFullName, cb->obj ) ), (((uint64)cb->time->high << 32) | (uint64)cb->time->low), pvalue->value.real );
     assert( rv < USER_MSG_LENGTH );
     print_output( user_msg, DEBUG, __FILE__, __LINE__ );
   }
 #endif
 
-  if( (cb->time->low  != (PLI_INT32)(last_time & 0xffffffff)) || (cb->time->high != (PLI_INT32)((last_time >> 32) & 0xffffffff)) ) {
-    if( !db_do_timestep( last_time, FALSE ) ) {
-      vpi_control( vpiFinish, EXIT_SUCCESS );
-    } else {
-      p_cb_data new_cb;
-      new_cb             = (p_cb_data)malloc( sizeof( s_cb_data ) );
-      new_cb->reason     = cbReadOnlySynch;
-      new_cb->cb_rtn     = covered_rosynch;
-      new_cb->obj        = NULL;
-      new_cb->time       = (p_vpi_time)malloc( sizeof( s_vpi_time ) );
-      new_cb->time->type = vpiSimTime;
-      new_cb->time->high = 0;
-      new_cb->time->low  = 0;
-      new_cb->value      = NULL;
-      new_cb->user_data  = NULL;
-      vpi_register_cb( new_cb );
-    }
-  }
-  last_time = ((uint64)cb->time->high << 32) | (uint64)cb->time->low;
+  covered_check_timestep( cb->time );
 
   /* Set symbol value */
-  snprintf( real_str, 64, "%.16f", cb->value->value.real );
-  db_set_symbol_string( cb->user_data, real_str );
-#endif
+  if( vsig->symtab != NULL ) {
+    covered_store_real( vsig, pvalue->value.real );
+  }
 
   PROFILE_END;
 
@@ -368,6 +1117,11 @@ PLI_INT32 covered_end_of_sim(
 
   p_vpi_time final_time;
 
+#ifdef VPI_WORKER_THREAD
+  /* Let the worker thread finish all queued records before simulating the remaining timesteps here */
+  covered_worker_stop();
+#endif
+
   (void)db_do_timestep( last_time, FALSE );
 
   /* Get the final simulation time */
@@ -402,7 +1156,8 @@ PLI_INT32 covered_end_of_sim(
     free_safe( curr_inst_scope, sizeof( char* ) );
     curr_inst_scope_size = 0;
   }
-  symtable_dealloc( vcd_symtab );
+  symtable_dealloc();
+  covered_dealloc_sigs();
   sim_dealloc();
   sys_task_dealloc();
   db_close();
@@ -450,46 +1205,49 @@ PLI_INT32 covered_cb_error_handler( p_cb_data cb ) { PROFILE(COVERED_CB_ERROR_HA
 
 }
 
-char* gen_next_symbol() { PROFILE(GEN_NEXT_SYMBOL);
-
-  static char symbol[21]   = {32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,'\0'};
-  static int  symbol_index = 19;
-  int         i            = 19;
+/*!
+ \return Returns a newly allocated VCD symbol that has not been used yet or NULL if all symbols are used.
 
-  while( (i >= symbol_index) && (symbol[i] == 126) ) {
-    symbol[i] = 33;
-    if( (i - 1) < symbol_index ) {
-      symbol_index--;
-      if( symbol_index < 0 ) {
-        return( NULL );
-      }
-    }
-    i--;
+ Symbols are handed out in symbol table index order so that the symbol table stays dense.
+*/
+char* gen_next_symbol(
+  unsigned int* index  /*!< Set to the symbol table index of the returned symbol */
+) { PROFILE(GEN_NEXT_SYMBOL);
+
+  static unsigned int next_index = 0;
+  char                symbol[8];
+  char*               new_symbol = NULL;
+
+  if( next_index != 0xffffffff ) {
+    symtable_index_to_symbol( next_index, symbol );
+    *index = next_index;
+    next_index++;
+    new_symbol = strdup_safe( symbol );
   }
-  symbol[i]++;
 
   PROFILE_END;
 
-  return( strdup_safe( symbol + symbol_index ) );
+  return( new_symbol );
 
 }
 
 /*!
  Finds the given VPI signal in Covered's database and creates a callback function that will
- be called whenever this signal changes value during simulation.  Also retrieves the initial
- value of the signal and stores it in the sym_value list and creates a symbol in the symtable
- structure for this signal.
+ be called whenever this signal changes value during simulation.  Also creates a symbol in the
+ symtable structure for this signal and adds the signal to the vpi_sig list so that its initial
+ value is stored once the symbol table is complete.
 */
 void covered_create_value_change_cb(
   vpiHandle sig  /*!< Pointer to vpiHandle for a given signal */
 ) { PROFILE(COVERED_CREATE_VALUE_CHANGE_CB);
 
-  p_cb_data   cb;
-  vsignal*    vsig  = NULL;
-  func_unit*  found_funit;
-  char*       symbol;
-  s_vpi_value value;
-  char*       name  = strdup_safe( vpi_get_str( vpiName, sig ) );
+  p_cb_data    cb;
+  vsignal*     vsig  = NULL;
+  func_unit*   found_funit;
+  char*        symbol;
+  unsigned int index;
+  vpi_sig*     vs;
+  char*        name  = strdup_safe( vpi_get_str( vpiName, sig ) );
 
   /* Only add the signal if it is in our database and needs to be assigned from the simulator */
   if( (curr_instance->funit != NULL) &&
@@ -509,9 +1267,8 @@ void covered_create_value_change_cb(
 #endif
 
     /* Generate new symbol */
-    if( (symbol = gen_next_symbol()) == NULL ) {
+    if( (symbol = gen_next_symbol( &index )) == NULL ) {
       vpi_printf( "covered VPI: INTERNAL ERROR:  Unable to generate unique symbol name\n" );
-      /* Need to increase number of characters in symbol array */
       vpi_control( vpiFinish, 0 );
     }
 
@@ -521,28 +1278,30 @@ void covered_create_value_change_cb(
     } else {
       db_assign_symbol( name, symbol, (vpi_get( vpiSize, sig ) - 1), 0 );
     }
-
-    /* Get initial value of this signal and store it for later retrieval */
-    if( vpi_get( vpiType, sig ) == vpiRealVar ) {
-
-      char real_str[64];
-      value.format = vpiRealVal;
-      vpi_get_value( sig, &value );
-      snprintf( real_str, 64, "%f", value.value.real );
-      sym_value_store( symbol, real_str );
-
+    free_safe( symbol, (strlen( symbol ) + 1) );
+
+    /* Create the signal's callback data; its symbol table entry and value buffer are set up by add_sym_values_to_sim */
+    vs         = (vpi_sig*)malloc_safe( sizeof( vpi_sig ) );
+    vs->obj       = sig;
+    vs->cb        = NULL;
+    vs->index     = index;
+    vs->symtab    = NULL;
+    vs->real      = (vpi_get( vpiType, sig ) == vpiRealVar);
+    vs->width     = vs->real ? 64 : vpi_get( vpiSize, sig );
+    vs->saturated = FALSE;
+    vs->value     = NULL;
+    vs->next      = NULL;
+    if( vs_head == NULL ) {
+      vs_head = vs_tail = vs;
     } else {
-
-      value.format = vpiBinStrVal;
-      vpi_get_value( sig, &value );
-      sym_value_store( symbol, value.value.str );
-
+      vs_tail->next = vs;
+      vs_tail       = vs;
     }
 
     /* Add a callback for a value change to this net */
     cb                   = (p_cb_data)malloc( sizeof( s_cb_data ) );
     cb->reason           = cbValueChange;
-    if( vpi_get( vpiType, sig ) == vpiRealVar ) {
+    if( vs->real ) {
       cb->cb_rtn         = covered_value_change_real;
     } else {
       cb->cb_rtn         = covered_value_change_bin;
@@ -554,17 +1313,17 @@ void covered_create_value_change_cb(
     cb->time->low        = 0;
 #ifdef NOIV
     cb->value            = (p_vpi_value)malloc( sizeof( s_vpi_value ) );
-    if( vpi_get( vpiType, sig ) == vpiRealVar ) {
-      cb->value->format    = vpiRealVal;
+    if( vs->real ) {
+      cb->value->format       = vpiRealVal;
     } else {
-      cb->value->format    = vpiBinStrVal;
-      cb->value->value.str = NULL;
+      cb->value->format       = vpiVectorVal;
+      cb->value->value.vector = NULL;
     }
 #else
     cb->value            = NULL;
 #endif
-    cb->user_data        = symbol;
-    vpi_register_cb( cb );
+    cb->user_data        = (PLI_BYTE8*)vs;
+    vs->cb               = vpi_register_cb( cb );
 
   }
 
@@ -869,6 +1628,24 @@ PLI_INT32 covered_sim_calltf( char* name ) {
       } else if( strncmp( "+covered_debug", argvptr, 14 ) == 0 ) {
         vpi_printf( "covered VPI: Turning debug mode on\n" );
         debug_mode = TRUE;
+      } else if( strncmp( "+covered_async=", argvptr, 15 ) == 0 ) {
+#ifdef VPI_WORKER_THREAD
+        queue_kb = (unsigned int)strtoul( (argvptr + 15), NULL, 10 );
+#else
+        vpi_printf( "covered VPI: Worker thread support was not built in, ignoring +covered_async\n" );
+#endif
+      } else if( strncmp( "+covered_async", argvptr, 14 ) == 0 ) {
+#ifdef VPI_WORKER_THREAD
+        queue_kb = VPI_QUEUE_SIZE_DEFAULT;
+#else
+        vpi_printf( "covered VPI: Worker thread support was not built in, ignoring +covered_async\n" );
+#endif
+      } else if( strncmp( "+covered_prune=", argvptr, 15 ) == 0 ) {
+        prune_interval = (unsigned int)strtoul( (argvptr + 15), NULL, 10 );
+        vpi_printf( "covered VPI: Removing callbacks of fully covered signals every %u timesteps\n", prune_interval );
+      } else if( strncmp( "+covered_prune", argvptr, 14 ) == 0 ) {
+        prune_interval = VPI_PRUNE_INTERVAL_DEFAULT;
+        vpi_printf( "covered VPI: Removing callbacks of fully covered signals every %u timesteps\n", prune_interval );
       } else if( strncmp( "+covered_profile=", argvptr, 17 ) == 0 ) {
         vpi_printf( "covered VPI: Turning profiler on.  Outputting to %s\n", argvptr + 17 );
         profiler_set_mode( TRUE );
@@ -903,7 +1680,7 @@ PLI_INT32 covered_sim_calltf( char* name ) {
   sim_initialize();
 
   /* Create initial symbol table */
-  vcd_symtab = symtable_create();
+  symtable_create();
 
   /* Initialize the curr_inst_scope structure */
   curr_inst_scope      = (char**)malloc( sizeof( char* ) );
@@ -926,6 +1703,18 @@ PLI_INT32 covered_sim_calltf( char* name ) {
   /* Perform initial time 0 */
   db_do_timestep( 0, FALSE );
 
+#ifdef VPI_WORKER_THREAD
+  /* Hand the remaining simulation over to the worker thread (the profiler is not thread-safe) */
+  if( queue_kb > 0 ) {
+    if( profiling_mode ) {
+      vpi_printf( "covered VPI: The profiler cannot be used with a worker thread, ignoring +covered_async\n" );
+    } else {
+      vpi_printf( "covered VPI: Simulating coverage in a worker thread with a %u KB value change queue\n", queue_kb );
+      covered_worker_start();
+    }
+  }
+#endif
+
   PROFILE_END;
 
   return 0;
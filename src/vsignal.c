@@ -30,6 +30,7 @@
 #include <stdlib.h>
 #include <assert.h>
 
+#include "db.h"
 #include "defines.h"
 #include "expr.h"
 #include "func_unit.h"
@@ -171,10 +172,14 @@ void vsignal_create_vec(
       default                         :  vtype = VDATA_UL;   break;
     }
 
-    /* Create the vector and assign it to the signal */
-    vec = vector_create( sig->value->width, ((sig->suppl.part.type == SSUPPL_TYPE_MEM) ? VTYPE_MEM : VTYPE_SIG), vtype, TRUE );
-    sig->value->value.ul = vec->value.ul;
-    free_safe( vec, sizeof( vector ) );
+    /* Create the vector and assign it to the signal (bit vectors may be stored inline in the signal's vector) */
+    if( vtype == VDATA_UL ) {
+      sig->value->value.ul = (sig->value->width > 0) ? vector_alloc_ulong( sig->value, sig->value->width, ((sig->suppl.part.type == SSUPPL_TYPE_MEM) ? VTYPE_MEM : VTYPE_SIG) ) : NULL;
+    } else {
+      vec = vector_create( sig->value->width, ((sig->suppl.part.type == SSUPPL_TYPE_MEM) ? VTYPE_MEM : VTYPE_SIG), vtype, TRUE );
+      sig->value->value.ul = vec->value.ul;
+      free_safe( vec, sizeof( vector ) );
+    }
 
     /* Iterate through expression list, setting the expression to this signal */
     for( i=0; i<sig->exp_size; i++ ) {
@@ -283,7 +288,120 @@ void vsignal_db_write(
 }
 
 /*!
- \throws anonymous Throw Throw Throw vector_db_read
+ Appends the specified vsignal to the binary CDD file as a binary record.  The record contains the same
+ information as the line written by vsignal_db_write.
+*/
+void vsignal_db_write_bin(
+  vsignal* sig,  /*!< Signal to write to file */
+  FILE*    file  /*!< Pointer to binary CDD file to write to */
+) { PROFILE(VSIGNAL_DB_WRITE_BIN);
+
+  /* Don't write this vsignal if it isn't usable by Covered */
+  if( (sig->suppl.part.not_handled == 0) &&
+      (sig->value->width != 0) &&
+      (sig->value->width <= MAX_BIT_WIDTH) &&
+      (sig->suppl.part.type != SSUPPL_TYPE_GENVAR) ) {
+
+    uint32       fields[5];  /* Fixed-width fields of signal record */
+    unsigned int i;
+
+    fields[0] = (uint32)sig->id;
+    fields[1] = (uint32)sig->line;
+    fields[2] = sig->suppl.all;
+    fields[3] = sig->pdim_num;
+    fields[4] = sig->udim_num;
+
+    db_bin_start_record( DB_TYPE_SIGNAL );
+    db_bin_put( fields, sizeof( fields ) );
+    db_bin_put_str( sig->name );
+
+    /* Store dimension information */
+    for( i=0; i<(sig->pdim_num + sig->udim_num); i++ ) {
+      int   range[2];
+      range[0] = sig->dim[i].msb;
+      range[1] = sig->dim[i].lsb;
+      db_bin_put( range, sizeof( range ) );
+    }
+
+    vector_db_write_bin( sig->value, ((sig->suppl.part.type == SSUPPL_TYPE_PARAM) || (sig->suppl.part.type == SSUPPL_TYPE_PARAM_REAL) || (sig->suppl.part.type == SSUPPL_TYPE_ENUM)), SIGNAL_IS_NET( sig ) );
+
+    db_bin_end_record( file );
+
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ \throws anonymous Throw
+
+ Creates a new vsignal from the fields of a vsignal that were read from the database file and adds it to the
+ signal array of the specified functional unit.  The new vsignal takes ownership of the given dimension array
+ and vector.
+*/
+static void vsignal_db_build(
+  func_unit*   curr_funit,  /*!< Pointer to current functional unit instantiating this vsignal */
+  const char*  name,        /*!< Name of vsignal */
+  int          id,          /*!< Signal ID */
+  int          sline,       /*!< Declared line number */
+  ssuppl       suppl,       /*!< Supplemental field */
+  unsigned int pdim_num,    /*!< Packed dimension number */
+  unsigned int udim_num,    /*!< Unpacked dimension number */
+  dim_range*   dim,         /*!< Dimensional information */
+  vector*      vec          /*!< Vector value for this vsignal */
+) {
+
+  vsignal* sig;  /* Pointer to the newly created vsignal */
+
+  /* Create new vsignal */
+  sig = vsignal_create( name, suppl.part.type, vec->width, sline, suppl.part.col );
+  sig->id                    = id;
+  sig->suppl.part.assigned   = suppl.part.assigned;
+  sig->suppl.part.mba        = suppl.part.mba;
+  sig->suppl.part.big_endian = suppl.part.big_endian;
+  sig->suppl.part.excluded   = suppl.part.excluded;
+  sig->pdim_num              = pdim_num;
+  sig->udim_num              = udim_num;
+  sig->dim                   = dim;
+
+  /* Copy over vector value */
+  vector_dealloc( sig->value );
+  sig->value = vec;
+
+  /* Add vsignal to vsignal list */
+  if( curr_funit == NULL ) {
+    print_output( "Internal error:  vsignal in database written before its functional unit", FATAL, __FILE__, __LINE__ );
+    Throw 0;
+  } else {
+    sig_link_add( sig, TRUE, &(curr_funit->sigs), &(curr_funit->sig_size), &(curr_funit->sig_no_rm_index) );
+  }
+
+}
+
+/*!
+ \return Returns TRUE if all of the fixed fields of a signal line were parsed; otherwise, returns FALSE.
+
+ Parses the fixed fields of a signal database line (see vsignal_db_write) and advances the line pointer past
+ them.  The returned name points into the (destructively tokenized) line.
+*/
+static bool vsignal_db_scan(
+            char**        line,      /*!< Pointer to line to parse */
+  /*@out@*/ char**        name,      /*!< Name of signal */
+  /*@out@*/ int*          id,        /*!< Signal ID */
+  /*@out@*/ int*          sline,     /*!< Declared line number */
+  /*@out@*/ ssuppl*       suppl,     /*!< Supplemental field */
+  /*@out@*/ unsigned int* pdim_num,  /*!< Number of packed dimensions */
+  /*@out@*/ unsigned int* udim_num   /*!< Number of unpacked dimensions */
+) {
+
+  return( ((*name = util_scan_token( line )) != NULL) && util_scan_int( line, id, 10 ) && util_scan_int( line, sline, 10 ) &&
+          util_scan_uint( line, &(suppl->all), 16 ) && util_scan_uint( line, pdim_num, 10 ) && util_scan_uint( line, udim_num, 10 ) );
+
+}
+
+/*!
+ \throws anonymous Throw Throw vsignal_db_build vector_db_read
 
  Creates a new vsignal structure, parses current file line for vsignal
  information and stores it to the specified vsignal.  If there are any problems
@@ -294,8 +412,7 @@ void vsignal_db_read(
   func_unit* curr_funit  /*!< Pointer to current functional unit instantiating this vsignal */
 ) { PROFILE(VSIGNAL_DB_READ);
 
-  char         name[256];      /* Name of current vsignal */
-  vsignal*     sig;            /* Pointer to the newly created vsignal */
+  char*        name;           /* Name of current vsignal */
   vector*      vec;            /* Vector value for this vsignal */
   int          id;             /* Signal ID */
   int          sline;          /* Declared line number */
@@ -303,13 +420,10 @@ void vsignal_db_read(
   unsigned int udim_num;       /* Unpacked dimension number */
   dim_range*   dim    = NULL;  /* Dimensional information */
   ssuppl       suppl;          /* Supplemental field */
-  int          chars_read;     /* Number of characters read from line */
   unsigned int i;              /* Loop iterator */
 
   /* Get name values. */
-  if( sscanf( *line, "%s %d %d %x %u %u%n", name, &id, &sline, &(suppl.all), &pdim_num, &udim_num, &chars_read ) == 6 ) {
-
-    *line = *line + chars_read;
+  if( vsignal_db_scan( line, &name, &id, &sline, &suppl, &pdim_num, &udim_num ) ) {
 
     /* Allocate dimensional information */
     dim = (dim_range*)malloc_safe( sizeof( dim_range ) * (pdim_num + udim_num) );
@@ -319,9 +433,7 @@ void vsignal_db_read(
       /* Read in dimensional information */
       i = 0;
       while( i < (pdim_num + udim_num) ) {
-        if( sscanf( *line, " %d %d%n", &(dim[i].msb), &(dim[i].lsb), &chars_read ) == 2 ) {
-          *line = *line + chars_read;
-        } else {
+        if( !util_scan_int( line, &(dim[i].msb), 10 ) || !util_scan_int( line, &(dim[i].lsb), 10 ) ) {
           print_output( "Unable to parse signal line in database file.  Unable to read.", FATAL, __FILE__, __LINE__ );
           Throw 0;
         }
@@ -336,28 +448,7 @@ void vsignal_db_read(
       Throw 0;
     }
 
-    /* Create new vsignal */
-    sig = vsignal_create( name, suppl.part.type, vec->width, sline, suppl.part.col );
-    sig->id                    = id;
-    sig->suppl.part.assigned   = suppl.part.assigned;
-    sig->suppl.part.mba        = suppl.part.mba;
-    sig->suppl.part.big_endian = suppl.part.big_endian;
-    sig->suppl.part.excluded   = suppl.part.excluded;
-    sig->pdim_num              = pdim_num;
-    sig->udim_num              = udim_num;
-    sig->dim                   = dim;
-
-    /* Copy over vector value */
-    vector_dealloc( sig->value );
-    sig->value = vec;
-
-    /* Add vsignal to vsignal list */
-    if( curr_funit == NULL ) {
-      print_output( "Internal error:  vsignal in database written before its functional unit", FATAL, __FILE__, __LINE__ );
-      Throw 0;
-    } else {
-      sig_link_add( sig, TRUE, &(curr_funit->sigs), &(curr_funit->sig_size), &(curr_funit->sig_no_rm_index) );
-    }
+    vsignal_db_build( curr_funit, name, id, sline, suppl, pdim_num, udim_num, dim, vec );
 
   } else {
 
@@ -370,9 +461,90 @@ void vsignal_db_read(
 
 }
 
+/*!
+ \throws anonymous Throw vsignal_db_build db_bin_get db_bin_get_str vector_db_read_bin
+
+ Creates a new vsignal from the signal information of the specified binary CDD record (see vsignal_db_write_bin)
+ and adds it to the specified functional unit.
+*/
+void vsignal_db_read_bin(
+  char**     line,       /*!< Pointer to binary record to parse */
+  func_unit* curr_funit  /*!< Pointer to current functional unit instantiating this vsignal */
+) { PROFILE(VSIGNAL_DB_READ_BIN);
+
+  uint32       fields[5];      /* Fixed-width fields of signal record */
+  char*        name;           /* Name of current vsignal */
+  vector*      vec;            /* Vector value for this vsignal */
+  dim_range*   dim    = NULL;  /* Dimensional information */
+  ssuppl       suppl;          /* Supplemental field */
+  unsigned int i;              /* Loop iterator */
+
+  db_bin_get( line, fields, sizeof( fields ) );
+
+  if( (name = db_bin_get_str( line )) == NULL ) {
+    print_output( "Unable to parse signal line in database file.  Unable to read.", FATAL, __FILE__, __LINE__ );
+    Throw 0;
+  }
+
+  suppl.all = fields[2];
+
+  /* Allocate dimensional information */
+  dim = (dim_range*)malloc_safe( sizeof( dim_range ) * (fields[3] + fields[4]) );
+
+  Try {
+
+    /* Read in dimensional information */
+    for( i=0; i<(fields[3] + fields[4]); i++ ) {
+      int   range[2];
+      db_bin_get( line, range, sizeof( range ) );
+      dim[i].msb = range[0];
+      dim[i].lsb = range[1];
+    }
+
+    /* Read in vector information */
+    vector_db_read_bin( &vec, line );
+
+  } Catch_anonymous {
+    free_safe( dim, (sizeof( dim_range ) * (fields[3] + fields[4])) );
+    Throw 0;
+  }
+
+  vsignal_db_build( curr_funit, name, (int)fields[0], (int)fields[1], suppl, fields[3], fields[4], dim, vec );
+
+  PROFILE_END;
+
+}
+
 #ifndef RUNLIB
 /*!
- \throws anonymous vector_db_merge Throw Throw
+ \throws anonymous Throw
+
+ Checks that the name and dimensions of a vsignal read from a CDD file match those of the base vsignal and merges
+ the exclusion information into the base vsignal.
+*/
+static void vsignal_db_merge_fields(
+  vsignal*     base,      /*!< Signal to store result of merge into */
+  const char*  name,      /*!< Read name of vsignal */
+  ssuppl       suppl,     /*!< Read supplemental signal information */
+  unsigned int pdim_num,  /*!< Read number of packed dimensions */
+  unsigned int udim_num   /*!< Read number of unpacked dimensions */
+) {
+
+  if( !scope_compare( base->name, name ) || (base->pdim_num != pdim_num) || (base->udim_num != udim_num) ) {
+
+    print_output( "Attempting to merge two databases derived from different designs.  Unable to merge",
+                  FATAL, __FILE__, __LINE__ );
+    Throw 0;
+
+  }
+
+  /* Make sure that the exclude bit is merged */
+  base->suppl.part.excluded |= suppl.part.excluded;
+
+}
+
+/*!
+ \throws anonymous vector_db_merge vsignal_db_merge_fields Throw
 
  Parses specified line for vsignal information and performs merge 
  of the base and in vsignals, placing the resulting merged vsignal 
@@ -387,7 +559,7 @@ void vsignal_db_merge(
   bool     same   /*!< Specifies if vsignal to merge needs to be exactly the same as the existing vsignal */
 ) { PROFILE(VSIGNAL_DB_MERGE);
  
-  char         name[256];   /* Name of current vsignal */
+  char*        name;        /* Name of current vsignal */
   int          id;          /* Unique ID of current signal */
   int          sline;       /* Declared line number */
   unsigned int pdim_num;    /* Number of packed dimensions */
@@ -395,49 +567,72 @@ void vsignal_db_merge(
   int          msb;         /* MSB of current dimension being read */
   int          lsb;         /* LSB of current dimension being read */
   ssuppl       suppl;       /* Supplemental signal information */
-  int          chars_read;  /* Number of characters read from line */
   unsigned int i;           /* Loop iterator */
 
   assert( base != NULL );
   assert( base->name != NULL );
 
-  if( sscanf( *line, "%s %d %d %x %u %u%n", name, &id, &sline, &(suppl.all), &pdim_num, &udim_num, &chars_read ) == 6 ) {
+  if( vsignal_db_scan( line, &name, &id, &sline, &suppl, &pdim_num, &udim_num ) ) {
 
-    *line = *line + chars_read;
+    vsignal_db_merge_fields( base, name, suppl, pdim_num, udim_num );
 
-    if( !scope_compare( base->name, name ) || (base->pdim_num != pdim_num) || (base->udim_num != udim_num) ) {
+    i = 0;
+    while( (i < (pdim_num + udim_num)) && util_scan_int( line, &msb, 10 ) && util_scan_int( line, &lsb, 10 ) ) {
+      i++;
+    }
 
-      print_output( "Attempting to merge two databases derived from different designs.  Unable to merge",
-                    FATAL, __FILE__, __LINE__ );
-      Throw 0;
+    if( i == (pdim_num + udim_num) ) {
 
-    } else {
+      /* Read in vector information */
+      vector_db_merge( base->value, line, same );
 
-      /* Make sure that the exclude bit is merged */
-      base->suppl.part.excluded |= suppl.part.excluded;
+    }
 
-      i = 0;
-      while( (i < (pdim_num + udim_num)) && (sscanf( *line, " %d %d%n", &msb, &lsb, &chars_read ) == 2) ) {
-        *line = *line + chars_read;
-        i++;
-      }
+  } else {
 
-      if( i == (pdim_num + udim_num) ) {
+    print_output( "Unable to parse vsignal in database file.  Unable to merge.", FATAL, __FILE__, __LINE__ );
+    Throw 0;
 
-        /* Read in vector information */
-        vector_db_merge( base->value, line, same );
+  }
 
-      }
+  PROFILE_END;
 
-    }
+}
 
-  } else {
+/*!
+ \throws anonymous db_bin_get db_bin_get_str vsignal_db_merge_fields vector_db_merge_bin
+
+ Parses the signal information of the specified binary CDD record (see vsignal_db_write_bin) and merges it into
+ the base vsignal (see vsignal_db_merge).
+*/
+void vsignal_db_merge_bin(
+  vsignal* base,  /*!< Signal to store result of merge into */
+  char**   line,  /*!< Pointer to binary record to parse */
+  bool     same   /*!< Specifies if vsignal to merge needs to be exactly the same as the existing vsignal */
+) { PROFILE(VSIGNAL_DB_MERGE_BIN);
 
+  uint32 fields[5];  /* Fixed-width fields of signal record */
+  char*  name;       /* Name of current vsignal */
+  ssuppl suppl;      /* Supplemental signal information */
+
+  assert( base != NULL );
+  assert( base->name != NULL );
+
+  db_bin_get( line, fields, sizeof( fields ) );
+
+  if( (name = db_bin_get_str( line )) == NULL ) {
     print_output( "Unable to parse vsignal in database file.  Unable to merge.", FATAL, __FILE__, __LINE__ );
     Throw 0;
-
   }
 
+  suppl.all = fields[2];
+
+  vsignal_db_merge_fields( base, name, suppl, fields[3], fields[4] );
+
+  /* Skip the dimensional information and merge the vector information */
+  *line += (sizeof( int ) * 2) * (fields[3] + fields[4]);
+  vector_db_merge_bin( base->value, line, same );
+
   PROFILE_END;
 
 }
@@ -498,15 +693,17 @@ void vsignal_propagate(
 }
 
 /*!
- \throws anonymous vector_vcd_assign vector_vcd_assign
+ \throws anonymous vector_vcd_assign_packed vector_vcd_assign_packed
 
- Assigns the associated value to the specified vsignal's vector.  After this, it
+ Assigns the associated packed value to the specified vsignal's vector.  After this, it
  iterates through its expression list, setting the TRUE and FALSE bits accordingly.
  Finally, calls the simulator expr_changed function for each expression.
 */
 void vsignal_vcd_assign(
   vsignal*        sig,    /*!< Pointer to vsignal to assign VCD value to */
-  const char*     value,  /*!< String version of VCD value */
+  const ulong*    vall,   /*!< Lower value array of packed VCD value (or real value for real signals) */
+  const ulong*    valh,   /*!< Upper value array of packed VCD value */
+  unsigned int    width,  /*!< Number of bits in packed VCD value */
   unsigned int    msb,    /*!< Most significant bit to assign to */
   unsigned int    lsb,    /*!< Least significant bit to assign to */
   const sim_time* time    /*!< Current simulation time signal is being assigned */
@@ -533,8 +730,8 @@ void vsignal_vcd_assign(
 
 #ifdef DEBUG_MODE
   if( debug_mode ) {
-    unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "Assigning vsignal %s[%d:%d] (lsb=%d) to value %s",
-                                obf_sig( sig->name ), msb, lsb, sig->dim[0].lsb, value );
+    unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "Assigning vsignal %s[%d:%d] (lsb=%d) to value 'h%lx (xz: 'h%lx, width: %u)",
+                                obf_sig( sig->name ), msb, lsb, sig->dim[0].lsb, vall[0], valh[0], width );
     assert( rv < USER_MSG_LENGTH );
     print_output( user_msg, DEBUG, __FILE__, __LINE__ );
   }
@@ -542,9 +739,9 @@ void vsignal_vcd_assign(
 
   /* Set vsignal value to specified value */
   if( lsb > 0 ) {
-    vec_changed = vector_vcd_assign( sig->value, value, (msb - sig->dim[0].lsb), (lsb - sig->dim[0].lsb) );
+    vec_changed = vector_vcd_assign_packed( sig->value, vall, valh, width, 0, (msb - sig->dim[0].lsb), (lsb - sig->dim[0].lsb) );
   } else {
-    vec_changed = vector_vcd_assign( sig->value, value, msb, lsb );
+    vec_changed = vector_vcd_assign_packed( sig->value, vall, valh, width, 0, msb, lsb );
   }
 
   /* Don't go through the hassle of updating expressions if value hasn't changed */
@@ -53,12 +53,24 @@ void vsignal_db_write(
   FILE*    file
 );
 
+/*! \brief Outputs this vsignal information to specified binary file. */
+void vsignal_db_write_bin(
+  vsignal* sig,
+  FILE*    file
+);
+
 /*! \brief Reads vsignal information from specified file. */
 void vsignal_db_read(
              char** line,
   /*@null@*/ func_unit* curr_funit
 );
 
+/*! \brief Reads vsignal information from a binary database record. */
+void vsignal_db_read_bin(
+             char** line,
+  /*@null@*/ func_unit* curr_funit
+);
+
 /*! \brief Reads and merges two vsignals, placing result into base vsignal. */
 void vsignal_db_merge(
   vsignal* base,
@@ -66,6 +78,13 @@ void vsignal_db_merge(
   bool     same
 );
 
+/*! \brief Merges the vsignal information of a binary database record into the base vsignal. */
+void vsignal_db_merge_bin(
+  vsignal* base,
+  char**   line,
+  bool     same
+);
+
 /*! \brief Merges two vsignals, placing the result into the base vsignal. */
 void vsignal_merge(
   vsignal* base,
@@ -81,7 +100,9 @@ void vsignal_propagate(
 /*! \brief Assigns specified VCD value to specified vsignal. */
 void vsignal_vcd_assign(
   vsignal*        sig,
-  const char*     value,
+  const ulong*    vall,
+  const ulong*    valh,
+  unsigned int    width,
   unsigned int    msb,
   unsigned int    lsb,
   const sim_time* time